@@ -52,6 +52,7 @@
 
 #include "core/math/bvh_tree.h"
 #include "core/math/geometry_3d.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
 
 #include <climits> // INT_MAX
@@ -59,6 +60,10 @@
 #define BVHTREE_CLASS BVH_Tree<T, NUM_TREES, 2, MAX_ITEMS, USER_PAIR_TEST_FUNCTION, USER_CULL_TEST_FUNCTION, USE_PAIRS, BOUNDS, POINT>
 #define BVH_LOCKED_FUNCTION BVHLockedFunction _lock_guard(&_mutex, BVH_THREAD_SAFE &&_thread_safe);
 
+// Below this number of changed items, finding the pairs on the WorkerThreadPool
+// costs more than it saves.
+#define BVH_PARALLEL_PAIR_CHECK_MIN_ITEMS 64
+
 template <typename T, int NUM_TREES = 1, bool USE_PAIRS = false, int MAX_ITEMS = 32, typename USER_PAIR_TEST_FUNCTION = BVH_DummyPairTestFunction<T>, typename USER_CULL_TEST_FUNCTION = BVH_DummyCullTestFunction<T>, typename BOUNDS = AABB, typename POINT = Vector3, bool BVH_THREAD_SAFE = true>
 class BVH_Manager {
 public:
@@ -73,6 +78,14 @@ public:
 		_thread_safe = p_enable;
 	}
 
+	// When enabled, the tree is culled for the changed items on the WorkerThreadPool
+	// during collision checks. Pairing callbacks are still sent from the calling thread,
+	// in the same order as when checking serially.
+	void params_set_parallel_pair_checks(bool p_enable) {
+		BVH_LOCKED_FUNCTION
+		_parallel_pair_checks = p_enable;
+	}
+
 	// these 2 are crucial for fine tuning, and can be applied manually
 	// see the variable declarations for more info.
 	void params_set_node_expansion(real_t p_value) {
@@ -383,6 +396,28 @@ public:
 		return params.result_count_overall;
 	}
 
+	// Same as cull_segment(), but without locking and with the hits gathered in `r_hits`
+	// instead of the tree's own list. Several of these can run at the same time, as long
+	// as nothing modifies the tree meanwhile.
+	int cull_segment_concurrent(const POINT &p_from, const POINT &p_to, T **p_result_array, int p_result_max, LocalVector<uint32_t> &r_hits, const T *p_tester, uint32_t p_tree_collision_mask = 0xFFFFFFFF, int *p_subindex_array = nullptr) {
+		typename BVHTREE_CLASS::CullParams params;
+
+		params.result_count_overall = 0;
+		params.result_max = p_result_max;
+		params.result_array = p_result_array;
+		params.subindex_array = p_subindex_array;
+		params.tester = p_tester;
+		params.tree_collision_mask = p_tree_collision_mask;
+		params.hits = &r_hits;
+
+		params.segment.from = p_from;
+		params.segment.to = p_to;
+
+		tree.cull_segment(params);
+
+		return params.result_count_overall;
+	}
+
 	int cull_point(const POINT &p_point, T **p_result_array, int p_result_max, const T *p_tester, uint32_t p_tree_collision_mask = 0xFFFFFFFF, int *p_subindex_array = nullptr) {
 		BVH_LOCKED_FUNCTION
 		typename BVHTREE_CLASS::CullParams params;
@@ -444,26 +479,43 @@ private:
 		params.result_array = nullptr;
 		params.subindex_array = nullptr;
 
-		for (const BVHHandle &h : changed_items) {
+		// The culls only read the tree, so they can all be done up front on threads,
+		// leaving only the pairing (which calls back into the user) serial.
+		const bool parallel = _parallel_pair_checks && changed_items.size() >= BVH_PARALLEL_PAIR_CHECK_MIN_ITEMS;
+		if (parallel) {
+			if (_changed_item_hits.size() < changed_items.size()) {
+				_changed_item_hits.resize(changed_items.size());
+			}
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &BVH_Manager::_cull_changed_item, nullptr, changed_items.size(), -1, true, SNAME("BVHPairCheck"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		}
+
+		for (uint32_t i = 0; i < changed_items.size(); i++) {
+			const BVHHandle h = changed_items[i];
+
 			// use the expanded aabb for pairing
 			const BOUNDS &expanded_aabb = tree._pairs[h.id()].expanded_aabb;
 			BVHABB_CLASS abb;
 			abb.from(expanded_aabb);
 
-			tree.item_fill_cullparams(h, params);
-
 			// find all the existing paired aabbs that are no longer
 			// paired, and send callbacks
 			_find_leavers(h, abb, p_full_check);
 
 			uint32_t changed_item_ref_id = h.id();
 
-			params.abb = abb;
+			const LocalVector<uint32_t> *cull_hits = &tree._cull_hits;
+			if (parallel) {
+				cull_hits = &_changed_item_hits[i];
+			} else {
+				tree.item_fill_cullparams(h, params);
+				params.abb = abb;
 
-			params.result_count_overall = 0; // might not be needed
-			tree.cull_aabb(params, false);
+				params.result_count_overall = 0; // might not be needed
+				tree.cull_aabb(params, false);
+			}
 
-			for (const uint32_t ref_id : tree._cull_hits) {
+			for (const uint32_t ref_id : *cull_hits) {
 				// don't collide against ourself
 				if (ref_id == changed_item_ref_id) {
 					continue;
@@ -480,6 +532,21 @@ private:
 		_reset();
 	}
 
+	void _cull_changed_item(uint32_t p_index, void *p_userdata) {
+		const BVHHandle h = changed_items[p_index];
+
+		typename BVHTREE_CLASS::CullParams params;
+		params.result_count_overall = 0;
+		params.result_max = INT_MAX;
+		params.result_array = nullptr;
+		params.subindex_array = nullptr;
+		params.hits = &_changed_item_hits[p_index];
+		params.abb.from(tree._pairs[h.id()].expanded_aabb);
+		tree.item_fill_cullparams(h, params);
+
+		tree.cull_aabb(params, false);
+	}
+
 public:
 	void item_get_AABB(BVHHandle p_handle, BOUNDS &r_aabb) {
 		DEV_ASSERT(!p_handle.is_invalid());
@@ -773,6 +840,10 @@ private:
 	LocalVector<BVHHandle> changed_items;
 	uint32_t _tick = 1; // Start from 1 so items with 0 indicate never updated.
 
+	// Cull results for each changed item, when finding pairs in parallel.
+	LocalVector<LocalVector<uint32_t>> _changed_item_hits;
+	bool _parallel_pair_checks = false;
+
 	class BVHLockedFunction {
 	public:
 		BVHLockedFunction(Mutex *p_mutex, bool p_thread_safe) {
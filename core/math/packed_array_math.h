@@ -0,0 +1,170 @@
+/**************************************************************************/
+/*  packed_array_math.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/transform_3d.h"
+
+// Element-wise kernels for contiguous arrays, used by the bulk operations of
+// packed arrays. They are written as plain loops over raw pointers without
+// branches so that compilers can vectorize them.
+namespace PackedArrayMath {
+
+template <typename T>
+void add_scalar(T *p_dst, int64_t p_count, T p_value) {
+	for (int64_t i = 0; i < p_count; i++) {
+		p_dst[i] += p_value;
+	}
+}
+
+template <typename T>
+void multiply_scalar(T *p_dst, int64_t p_count, T p_value) {
+	for (int64_t i = 0; i < p_count; i++) {
+		p_dst[i] *= p_value;
+	}
+}
+
+template <typename T>
+void multiply_add_scalar(T *p_dst, int64_t p_count, T p_mul, T p_add) {
+	for (int64_t i = 0; i < p_count; i++) {
+		p_dst[i] = p_dst[i] * p_mul + p_add;
+	}
+}
+
+template <typename T>
+void add(T *p_dst, const T *p_src, int64_t p_count) {
+	for (int64_t i = 0; i < p_count; i++) {
+		p_dst[i] += p_src[i];
+	}
+}
+
+template <typename T>
+void multiply(T *p_dst, const T *p_src, int64_t p_count) {
+	for (int64_t i = 0; i < p_count; i++) {
+		p_dst[i] *= p_src[i];
+	}
+}
+
+template <typename T>
+void multiply_add(T *p_dst, const T *p_mul, const T *p_add, int64_t p_count) {
+	for (int64_t i = 0; i < p_count; i++) {
+		p_dst[i] = p_dst[i] * p_mul[i] + p_add[i];
+	}
+}
+
+template <typename T>
+void clamp(T *p_dst, int64_t p_count, T p_min, T p_max) {
+	for (int64_t i = 0; i < p_count; i++) {
+		const T v = p_dst[i] < p_min ? p_min : p_dst[i];
+		p_dst[i] = v > p_max ? p_max : v;
+	}
+}
+
+template <typename T>
+void lerp(T *p_dst, const T *p_to, int64_t p_count, T p_weight) {
+	for (int64_t i = 0; i < p_count; i++) {
+		p_dst[i] += (p_to[i] - p_dst[i]) * p_weight;
+	}
+}
+
+// Replaces the elements of `p_dst` with the ones of `p_src` where `p_mask` is not zero.
+template <typename T>
+void select(T *p_dst, const T *p_src, const uint8_t *p_mask, int64_t p_count) {
+	for (int64_t i = 0; i < p_count; i++) {
+		p_dst[i] = p_mask[i] ? p_src[i] : p_dst[i];
+	}
+}
+
+// Reductions accumulate in double precision over several independent lanes,
+// which keeps the precision of large float arrays and removes the dependency
+// between consecutive additions.
+template <typename T>
+double sum(const T *p_src, int64_t p_count) {
+	double acc[4] = {};
+	int64_t i = 0;
+	for (; i + 4 <= p_count; i += 4) {
+		acc[0] += p_src[i + 0];
+		acc[1] += p_src[i + 1];
+		acc[2] += p_src[i + 2];
+		acc[3] += p_src[i + 3];
+	}
+	for (; i < p_count; i++) {
+		acc[0] += p_src[i];
+	}
+	return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+}
+
+template <typename T>
+double dot(const T *p_a, const T *p_b, int64_t p_count) {
+	double acc[4] = {};
+	int64_t i = 0;
+	for (; i + 4 <= p_count; i += 4) {
+		acc[0] += double(p_a[i + 0]) * p_b[i + 0];
+		acc[1] += double(p_a[i + 1]) * p_b[i + 1];
+		acc[2] += double(p_a[i + 2]) * p_b[i + 2];
+		acc[3] += double(p_a[i + 3]) * p_b[i + 3];
+	}
+	for (; i < p_count; i++) {
+		acc[0] += double(p_a[i]) * p_b[i];
+	}
+	return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+}
+
+template <typename T>
+T min(const T *p_src, int64_t p_count) {
+	T ret = p_src[0];
+	for (int64_t i = 1; i < p_count; i++) {
+		ret = p_src[i] < ret ? p_src[i] : ret;
+	}
+	return ret;
+}
+
+template <typename T>
+T max(const T *p_src, int64_t p_count) {
+	T ret = p_src[0];
+	for (int64_t i = 1; i < p_count; i++) {
+		ret = p_src[i] > ret ? p_src[i] : ret;
+	}
+	return ret;
+}
+
+inline void transform(Vector3 *p_dst, int64_t p_count, const Transform3D &p_transform) {
+	// Load the matrix once, so it stays in registers for the whole loop.
+	const Vector3 x = p_transform.basis.rows[0];
+	const Vector3 y = p_transform.basis.rows[1];
+	const Vector3 z = p_transform.basis.rows[2];
+	const Vector3 o = p_transform.origin;
+	for (int64_t i = 0; i < p_count; i++) {
+		const Vector3 v = p_dst[i];
+		p_dst[i] = Vector3(x.dot(v) + o.x, y.dot(v) + o.y, z.dot(v) + o.z);
+	}
+}
+
+} // namespace PackedArrayMath
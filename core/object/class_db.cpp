@@ -1733,6 +1733,47 @@ StringName ClassDB::get_property_setter(const StringName &p_class, const StringN
 	return StringName();
 }
 
+MethodBind *ClassDB::get_property_setter_bind(const StringName &p_class, const StringName &p_property, int *r_index) {
+	ClassInfo *type = classes.getptr(p_class);
+	ClassInfo *check = type;
+	while (check) {
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			if (r_index) {
+				*r_index = psg->index;
+			}
+			return psg->setter ? psg->_setptr : nullptr;
+		}
+
+		check = check->inherits_ptr;
+	}
+
+	return nullptr;
+}
+
+void ClassDB::set_property_with_setter_bind(Object *p_object, MethodBind *p_setter, int p_index, const Variant &p_value, bool *r_valid) {
+	ERR_FAIL_NULL(p_object);
+	ERR_FAIL_NULL(p_setter);
+
+#ifdef TOOLS_ENABLED
+	p_object->_edited = true;
+#endif
+
+	Callable::CallError ce;
+	if (p_index >= 0) {
+		Variant index = p_index;
+		const Variant *arg[2] = { &index, &p_value };
+		p_setter->call(p_object, arg, 2, ce);
+	} else {
+		const Variant *arg[1] = { &p_value };
+		p_setter->call(p_object, arg, 1, ce);
+	}
+
+	if (r_valid) {
+		*r_valid = ce.error == Callable::CallError::CALL_OK;
+	}
+}
+
 StringName ClassDB::get_property_getter(const StringName &p_class, const StringName &p_property) {
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
@@ -31,6 +31,7 @@
 #include "message_queue.h"
 
 #include "core/config/project_settings.h"
+#include "core/os/thread.h"
 
 #include <cstdio>
 
@@ -65,6 +66,32 @@ void CallQueue::_add_page() {
 	pages_used++;
 }
 
+uint8_t *CallQueue::_reserve(uint32_t p_room_needed) {
+	_ensure_first_page();
+
+	if ((page_bytes[pages_used - 1] + p_room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
+		if (pages_used == max_pages) {
+			return nullptr;
+		}
+		_add_page();
+	}
+
+	uint8_t *buffer = &pages[pages_used - 1]->data[page_bytes[pages_used - 1]];
+	page_bytes[pages_used - 1] += p_room_needed;
+	message_count++;
+	bytes_used += p_room_needed;
+	return buffer;
+}
+
+void CallQueue::_wait_for_writers() const {
+#ifdef THREADS_ENABLED
+	// New writers can't reserve room while the mutex is locked, so this only waits for the ones already copying.
+	while (writers.get() != 0) {
+		Thread::yield();
+	}
+#endif
+}
+
 Error CallQueue::push_callp(ObjectID p_id, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error) {
 	return push_callablep(Callable(p_id, p_method), p_args, p_argcount, p_show_error);
 }
@@ -88,21 +115,16 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 
 	LOCK_MUTEX;
 
-	_ensure_first_page();
-
-	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
-			fprintf(stderr, "Failed method: %s. Message queue out of memory. %s\n", String(p_callable).utf8().get_data(), error_text.utf8().get_data());
-			statistics();
-			UNLOCK_MUTEX;
-			return ERR_OUT_OF_MEMORY;
-		}
-		_add_page();
+	uint8_t *buffer_end = _reserve(room_needed);
+	if (!buffer_end) {
+		fprintf(stderr, "Failed method: %s. Message queue out of memory. %s\n", String(p_callable).utf8().get_data(), error_text.utf8().get_data());
+		statistics();
+		UNLOCK_MUTEX;
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Page *page = pages[pages_used - 1];
-
-	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
+	writers.increment();
+	UNLOCK_MUTEX;
 
 	Message *msg = memnew_placement(buffer_end, Message);
 	msg->args = p_argcount;
@@ -124,9 +146,7 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 		*v = *p_args[i];
 	}
 
-	page_bytes[pages_used - 1] += room_needed;
-
-	UNLOCK_MUTEX;
+	writers.decrement();
 
 	return OK;
 }
@@ -135,25 +155,21 @@ Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant
 	LOCK_MUTEX;
 	uint32_t room_needed = sizeof(Message) + sizeof(Variant);
 
-	_ensure_first_page();
-
-	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
-			String type;
-			if (ObjectDB::get_instance(p_id)) {
-				type = ObjectDB::get_instance(p_id)->get_class();
-			}
-			fprintf(stderr, "Failed set: %s: %s target ID: %s. Message queue out of memory. %s\n", type.utf8().get_data(), String(p_prop).utf8().get_data(), itos(p_id).utf8().get_data(), error_text.utf8().get_data());
-			statistics();
-
-			UNLOCK_MUTEX;
-			return ERR_OUT_OF_MEMORY;
+	uint8_t *buffer_end = _reserve(room_needed);
+	if (!buffer_end) {
+		String type;
+		if (ObjectDB::get_instance(p_id)) {
+			type = ObjectDB::get_instance(p_id)->get_class();
 		}
-		_add_page();
+		fprintf(stderr, "Failed set: %s: %s target ID: %s. Message queue out of memory. %s\n", type.utf8().get_data(), String(p_prop).utf8().get_data(), itos(p_id).utf8().get_data(), error_text.utf8().get_data());
+		statistics();
+
+		UNLOCK_MUTEX;
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Page *page = pages[pages_used - 1];
-	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
+	writers.increment();
+	UNLOCK_MUTEX;
 
 	Message *msg = memnew_placement(buffer_end, Message);
 	msg->args = 1;
@@ -165,8 +181,7 @@ Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant
 	Variant *v = memnew_placement(buffer_end, Variant);
 	*v = p_value;
 
-	page_bytes[pages_used - 1] += room_needed;
-	UNLOCK_MUTEX;
+	writers.decrement();
 
 	return OK;
 }
@@ -176,20 +191,16 @@ Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	LOCK_MUTEX;
 	uint32_t room_needed = sizeof(Message);
 
-	_ensure_first_page();
-
-	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
-			fprintf(stderr, "Failed notification: %d target ID: %s. Message queue out of memory. %s\n", p_notification, itos(p_id).utf8().get_data(), error_text.utf8().get_data());
-			statistics();
-			UNLOCK_MUTEX;
-			return ERR_OUT_OF_MEMORY;
-		}
-		_add_page();
+	uint8_t *buffer_end = _reserve(room_needed);
+	if (!buffer_end) {
+		fprintf(stderr, "Failed notification: %d target ID: %s. Message queue out of memory. %s\n", p_notification, itos(p_id).utf8().get_data(), error_text.utf8().get_data());
+		statistics();
+		UNLOCK_MUTEX;
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Page *page = pages[pages_used - 1];
-	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
+	writers.increment();
+	UNLOCK_MUTEX;
 
 	Message *msg = memnew_placement(buffer_end, Message);
 
@@ -198,8 +209,7 @@ Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	//msg->target;
 	msg->notification = p_notification;
 
-	page_bytes[pages_used - 1] += room_needed;
-	UNLOCK_MUTEX;
+	writers.decrement();
 
 	return OK;
 }
@@ -240,55 +250,68 @@ Error CallQueue::flush() {
 	uint32_t i = 0;
 	uint32_t offset = 0;
 
-	while (i < pages_used && offset < page_bytes[i]) {
+	while (true) {
+		_wait_for_writers();
+		if (i >= pages_used || offset >= page_bytes[i]) {
+			break;
+		}
+
+		// Everything written so far in this page can be read without the mutex,
+		// new messages only go after it (or into other pages).
 		Page *page = pages[i];
+		uint32_t end = page_bytes[i];
+		uint32_t start = offset;
+		uint32_t count = 0;
 
-		//lock on each iteration, so a call can re-add itself to the message queue
+		UNLOCK_MUTEX;
 
-		Message *message = (Message *)&page->data[offset];
+		while (offset < end) {
+			Message *message = (Message *)&page->data[offset];
 
-		uint32_t advance = sizeof(Message);
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			advance += sizeof(Variant) * message->args;
-		}
+			uint32_t advance = sizeof(Message);
+			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
+				advance += sizeof(Variant) * message->args;
+			}
 
-		//pre-advance so this function is reentrant
-		offset += advance;
+			//pre-advance so this function is reentrant
+			offset += advance;
+			count++;
 
-		Object *target = message->callable.get_object();
+			Object *target = message->callable.get_object();
 
-		UNLOCK_MUTEX;
+			switch (message->type & FLAG_MASK) {
+				case TYPE_CALL: {
+					if (target || (message->type & FLAG_NULL_IS_OK)) {
+						Variant *args = (Variant *)(message + 1);
+						_call_function(message->callable, args, message->args, message->type & FLAG_SHOW_ERROR);
+					}
+				} break;
+				case TYPE_NOTIFICATION: {
+					if (target) {
+						target->notification(message->notification);
+					}
+				} break;
+				case TYPE_SET: {
+					if (target) {
+						Variant *arg = (Variant *)(message + 1);
+						target->set(message->callable.get_method(), *arg);
+					}
+				} break;
+			}
 
-		switch (message->type & FLAG_MASK) {
-			case TYPE_CALL: {
-				if (target || (message->type & FLAG_NULL_IS_OK)) {
-					Variant *args = (Variant *)(message + 1);
-					_call_function(message->callable, args, message->args, message->type & FLAG_SHOW_ERROR);
-				}
-			} break;
-			case TYPE_NOTIFICATION: {
-				if (target) {
-					target->notification(message->notification);
-				}
-			} break;
-			case TYPE_SET: {
-				if (target) {
-					Variant *arg = (Variant *)(message + 1);
-					target->set(message->callable.get_method(), *arg);
+			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
+				Variant *args = (Variant *)(message + 1);
+				for (int k = 0; k < message->args; k++) {
+					args[k].~Variant();
 				}
-			} break;
-		}
-
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			Variant *args = (Variant *)(message + 1);
-			for (int k = 0; k < message->args; k++) {
-				args[k].~Variant();
 			}
-		}
 
-		message->~Message();
+			message->~Message();
+		}
 
 		LOCK_MUTEX;
+		message_count -= count;
+		bytes_used -= offset - start;
 		if (offset == page_bytes[i]) {
 			i++;
 			offset = 0;
@@ -297,6 +320,8 @@ Error CallQueue::flush() {
 
 	page_bytes[0] = 0;
 	pages_used = 1;
+	message_count = 0;
+	bytes_used = 0;
 
 	flushing = false;
 	UNLOCK_MUTEX;
@@ -311,6 +336,8 @@ void CallQueue::clear() {
 		return; // Nothing to clear.
 	}
 
+	_wait_for_writers();
+
 	for (uint32_t i = 0; i < pages_used; i++) {
 		uint32_t offset = 0;
 		while (offset < page_bytes[i]) {
@@ -340,12 +367,15 @@ void CallQueue::clear() {
 
 	pages_used = 1;
 	page_bytes[0] = 0;
+	message_count = 0;
+	bytes_used = 0;
 
 	UNLOCK_MUTEX;
 }
 
 void CallQueue::statistics() {
 	LOCK_MUTEX;
+	_wait_for_writers();
 	HashMap<StringName, int> set_count;
 	HashMap<int, int> notify_count;
 	HashMap<Callable, int> call_count;
@@ -422,6 +452,7 @@ void CallQueue::statistics() {
 	}
 
 	fprintf(stdout, "TOTAL PAGES: %d (%d bytes).\n", pages_used, pages_used * PAGE_SIZE_BYTES);
+	fprintf(stdout, "TOTAL MESSAGES: %d (%d bytes).\n", message_count, bytes_used);
 	fprintf(stdout, "NULL count: %d.\n", null_count);
 
 	for (const KeyValue<StringName, int> &E : set_count) {
@@ -458,6 +489,21 @@ int CallQueue::get_max_buffer_usage() const {
 	return pages.size() * PAGE_SIZE_BYTES;
 }
 
+int CallQueue::get_message_count() const {
+	// The counters are updated by pushing threads and by the flush, both with the mutex locked.
+	LOCK_MUTEX;
+	int count = message_count;
+	UNLOCK_MUTEX;
+	return count;
+}
+
+int CallQueue::get_buffer_usage() const {
+	LOCK_MUTEX;
+	int usage = bytes_used;
+	UNLOCK_MUTEX;
+	return usage;
+}
+
 CallQueue::CallQueue(Allocator *p_custom_allocator, uint32_t p_max_pages, const String &p_error_text) {
 	if (p_custom_allocator) {
 		allocator = p_custom_allocator;
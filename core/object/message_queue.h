@@ -34,6 +34,7 @@
 #include "core/os/mutex.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/paged_allocator.h"
+#include "core/templates/safe_refcount.h"
 #include "core/variant/variant.h"
 
 class Object;
@@ -76,6 +77,14 @@ private:
 	uint32_t pages_used = 0;
 	bool flushing = false;
 
+	// Room for messages is reserved with the mutex locked, but they are written after unlocking it,
+	// so threads pushing messages don't serialize on copying arguments. Whoever reads messages must
+	// wait for the pending writers while holding the mutex.
+	SafeNumeric<uint32_t> writers;
+
+	uint32_t message_count = 0;
+	uint32_t bytes_used = 0;
+
 #ifdef DEV_ENABLED
 	bool is_current_thread_override = false;
 #endif
@@ -98,6 +107,8 @@ private:
 	}
 
 	void _add_page();
+	uint8_t *_reserve(uint32_t p_room_needed);
+	void _wait_for_writers() const;
 
 	void _call_function(const Callable &p_callable, const Variant *p_args, int p_argcount, bool p_show_error);
 
@@ -142,6 +153,8 @@ public:
 
 	bool is_flushing() const;
 	int get_max_buffer_usage() const;
+	int get_message_count() const;
+	int get_buffer_usage() const;
 
 	CallQueue(Allocator *p_custom_allocator = nullptr, uint32_t p_max_pages = 8192, const String &p_error_text = String());
 	virtual ~CallQueue();
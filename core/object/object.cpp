@@ -828,6 +828,13 @@ Variant Object::callp(const StringName &p_method, const Variant **p_args, int p_
 	return ret;
 }
 
+Variant Object::call_method_bind(MethodBind *p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error) {
+	DEV_ASSERT(!script_instance);
+
+	OBJ_DEBUG_LOCK
+	return p_method->call(this, p_args, p_argcount, r_error);
+}
+
 Variant Object::call_const(const StringName &p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error) {
 	r_error.error = Callable::CallError::CALL_OK;
 
@@ -1180,14 +1187,7 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		return ERR_CANT_ACQUIRE_RESOURCE; //no emit, signals blocked
 	}
 
-	constexpr int MAX_SLOTS_ON_STACK = 5;
-	// Don't default initialize the Callable objects on the stack, just reserve the space - we'll memnew_placement() them later.
-	alignas(Callable) uint8_t slot_callable_stack[sizeof(Callable) * MAX_SLOTS_ON_STACK];
-	uint32_t slot_flags_stack[MAX_SLOTS_ON_STACK];
-
-	Callable *slot_callables = (Callable *)slot_callable_stack;
-	uint32_t *slot_flags = slot_flags_stack;
-	uint32_t slot_count = 0;
+	Vector<SignalData::EmitSlot> emit_slots;
 
 	{
 		ObjectSignalLock signal_lock(this);
@@ -1203,33 +1203,36 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 			return ERR_UNAVAILABLE;
 		}
 
-		if (s->slot_map.size() > MAX_SLOTS_ON_STACK) {
-			slot_callables = (Callable *)memalloc(sizeof(Callable) * s->slot_map.size());
-			slot_flags = (uint32_t *)memalloc(sizeof(uint32_t) * s->slot_map.size());
+		if (s->emit_slots.size() != (int)s->slot_map.size()) {
+			s->emit_slots.resize(s->slot_map.size());
+			SignalData::EmitSlot *emit_slots_ptrw = s->emit_slots.ptrw();
+			for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
+				emit_slots_ptrw->callable = slot_kv.value.conn.callable;
+				emit_slots_ptrw->flags = slot_kv.value.conn.flags;
+				emit_slots_ptrw++;
+			}
 		}
 
 		// Ensure that disconnecting the signal or even deleting the object
-		// will not affect the signal calling.
-		for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-			memnew_placement(&slot_callables[slot_count], Callable(slot_kv.value.conn.callable));
-			slot_flags[slot_count] = slot_kv.value.conn.flags;
-			++slot_count;
-		}
-
-		DEV_ASSERT(slot_count == s->slot_map.size());
+		// will not affect the signal calling. This only references the slots,
+		// they are copied by the next emission if the connections change.
+		emit_slots = s->emit_slots;
 	}
 
+	const SignalData::EmitSlot *slots = emit_slots.ptr();
+	const uint32_t slot_count = emit_slots.size();
+
 	// Disconnect all one-shot connections before emitting to prevent recursion.
 	for (uint32_t i = 0; i < slot_count; ++i) {
-		bool disconnect = slot_flags[i] & CONNECT_ONE_SHOT;
+		bool disconnect = slots[i].flags & CONNECT_ONE_SHOT;
 #ifdef TOOLS_ENABLED
-		if (disconnect && (slot_flags[i] & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
+		if (disconnect && (slots[i].flags & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
 			// This signal was connected from the editor, and is being edited. Just don't disconnect for now.
 			disconnect = false;
 		}
 #endif
 		if (disconnect) {
-			_disconnect(p_name, slot_callables[i]);
+			_disconnect(p_name, slots[i].callable);
 		}
 	}
 
@@ -1245,11 +1248,11 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 	Error err = OK;
 
 	Vector<const Variant *> append_source_mem;
-	Variant source = this;
+	Variant source;
 
 	for (uint32_t i = 0; i < slot_count; ++i) {
-		const Callable &callable = slot_callables[i];
-		const uint32_t &flags = slot_flags[i];
+		const Callable &callable = slots[i].callable;
+		const uint32_t flags = slots[i].flags;
 
 		if (!callable.is_valid()) {
 			// Target might have been deleted during signal callback, this is expected and OK.
@@ -1264,6 +1267,9 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 			// Implemented by inserting before the first to-be-unbinded arg.
 			int source_index = p_argcount - callable.get_unbound_arguments_count();
 			if (source_index >= 0) {
+				if (source.get_type() == Variant::NIL) {
+					source = this;
+				}
 				append_source_mem.resize(p_argcount + 1);
 				const Variant **args_mem = append_source_mem.ptrw();
 
@@ -1314,15 +1320,6 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		}
 	}
 
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		slot_callables[i].~Callable();
-	}
-
-	if (slot_callables != (Callable *)slot_callable_stack) {
-		memfree(slot_callables);
-		memfree(slot_flags);
-	}
-
 	if (pending_unref) {
 		// We have to do the same Ref<T> would do. We can't just use Ref<T>
 		// because it would do the init ref logic, which is something this function
@@ -1578,6 +1575,7 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 
 	//use callable version as key, so binds can be ignored
 	s->slot_map[*p_callable.get_base_comparator()] = slot;
+	s->emit_slots.clear();
 
 	return OK;
 }
@@ -1656,6 +1654,7 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 	}
 
 	s->slot_map.erase(*p_callable.get_base_comparator());
+	s->emit_slots.clear();
 
 	if (s->slot_map.is_empty() && get_gdtype().get_signal_map(false).has(p_signal)) {
 		//not user signal, delete
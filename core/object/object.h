@@ -415,8 +415,16 @@ private:
 			List<Connection>::Element *cE = nullptr;
 		};
 
+		struct EmitSlot {
+			Callable callable;
+			uint32_t flags = 0;
+		};
+
 		MethodInfo user;
 		HashMap<Callable, Slot> slot_map;
+		// Copy of the connections in emission order, built when emitting after they changed.
+		// Emissions hold a reference to it, so changing the connections while emitting doesn't affect them.
+		Vector<EmitSlot> emit_slots;
 		bool removable = false;
 	};
 	mutable Mutex *signal_mutex = nullptr;
@@ -702,6 +710,8 @@ public:
 	Variant callv(const StringName &p_method, const Array &p_args);
 	virtual Variant callp(const StringName &p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 	virtual Variant call_const(const StringName &p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error);
+	// Same as `callp()` on an object without a script, for a method already looked up by the caller.
+	Variant call_method_bind(MethodBind *p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 
 	template <typename... VarArgs>
 	Variant call(const StringName &p_method, VarArgs... p_args) {
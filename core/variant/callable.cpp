@@ -124,12 +124,7 @@ Error Callable::rpcp(int p_id, const Variant **p_arguments, int p_argcount, Call
 }
 
 Callable Callable::bindp(const Variant **p_arguments, int p_argcount) const {
-	Vector<Variant> args;
-	args.resize(p_argcount);
-	for (int i = 0; i < p_argcount; i++) {
-		args.write[i] = *p_arguments[i];
-	}
-	return Callable(memnew(CallableCustomBind(*this, args)));
+	return Callable(CallableCustomBind::create(*this, p_arguments, p_argcount));
 }
 
 Callable Callable::bindv(const Array &p_arguments) {
@@ -137,12 +132,12 @@ Callable Callable::bindv(const Array &p_arguments) {
 		return *this; // No point in creating a new callable if nothing is bound.
 	}
 
-	Vector<Variant> args;
-	args.resize(p_arguments.size());
-	for (int i = 0; i < p_arguments.size(); i++) {
-		args.write[i] = p_arguments[i];
+	const int argcount = p_arguments.size();
+	const Variant **argptrs = (const Variant **)alloca(sizeof(Variant *) * argcount);
+	for (int i = 0; i < argcount; i++) {
+		argptrs[i] = &p_arguments[i];
 	}
-	return Callable(memnew(CallableCustomBind(*this, args)));
+	return Callable(CallableCustomBind::create(*this, argptrs, argcount));
 }
 
 Callable Callable::unbind(int p_argcount) const {
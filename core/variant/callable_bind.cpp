@@ -47,7 +47,7 @@ bool CallableCustomBind::_equal_func(const CallableCustom *p_a, const CallableCu
 		return false;
 	}
 
-	if (a->binds.size() != b->binds.size()) {
+	if (a->bind_count != b->bind_count) {
 		return false;
 	}
 
@@ -64,7 +64,7 @@ bool CallableCustomBind::_less_func(const CallableCustom *p_a, const CallableCus
 		return false;
 	}
 
-	return a->binds.size() < b->binds.size();
+	return a->bind_count < b->bind_count;
 }
 
 CallableCustom::CompareEqualFunc CallableCustomBind::get_compare_equal_func() const {
@@ -94,13 +94,13 @@ const Callable *CallableCustomBind::get_base_comparator() const {
 int CallableCustomBind::get_argument_count(bool &r_is_valid) const {
 	int ret = callable.get_argument_count(&r_is_valid);
 	if (r_is_valid) {
-		return ret - binds.size();
+		return ret - bind_count;
 	}
 	return 0;
 }
 
 int CallableCustomBind::get_bound_arguments_count() const {
-	return callable.get_bound_arguments_count() + MAX(0, binds.size() - callable.get_unbound_arguments_count());
+	return callable.get_bound_arguments_count() + MAX(0, bind_count - callable.get_unbound_arguments_count());
 }
 
 void CallableCustomBind::get_bound_arguments(Vector<Variant> &r_arguments) const {
@@ -111,11 +111,12 @@ void CallableCustomBind::get_bound_arguments(Vector<Variant> &r_arguments) const
 	int sub_unbound_count = callable.get_unbound_arguments_count();
 
 	if (sub_bound_count == 0 && sub_unbound_count == 0) {
-		r_arguments = binds;
+		r_arguments = get_binds();
 		return;
 	}
 
-	int added_count = MAX(0, binds.size() - sub_unbound_count);
+	const Variant *binds = _get_binds();
+	int added_count = MAX(0, bind_count - sub_unbound_count);
 	int new_count = sub_bound_count + added_count;
 
 	if (added_count <= 0) {
@@ -135,36 +136,72 @@ void CallableCustomBind::get_bound_arguments(Vector<Variant> &r_arguments) const
 }
 
 int CallableCustomBind::get_unbound_arguments_count() const {
-	return MAX(0, callable.get_unbound_arguments_count() - binds.size());
+	return MAX(0, callable.get_unbound_arguments_count() - bind_count);
 }
 
 void CallableCustomBind::call(const Variant **p_arguments, int p_argcount, Variant &r_return_value, Callable::CallError &r_call_error) const {
-	const Variant **args = (const Variant **)alloca(sizeof(Variant *) * (binds.size() + p_argcount));
+	const Variant *binds = _get_binds();
+	const Variant **args = (const Variant **)alloca(sizeof(Variant *) * (bind_count + p_argcount));
 	for (int i = 0; i < p_argcount; i++) {
 		args[i] = (const Variant *)p_arguments[i];
 	}
-	for (int i = 0; i < binds.size(); i++) {
-		args[i + p_argcount] = (const Variant *)&binds[i];
+	for (int i = 0; i < bind_count; i++) {
+		args[i + p_argcount] = &binds[i];
 	}
 
-	callable.callp(args, p_argcount + binds.size(), r_return_value, r_call_error);
+	callable.callp(args, p_argcount + bind_count, r_return_value, r_call_error);
 }
 
 Error CallableCustomBind::rpc(int p_peer_id, const Variant **p_arguments, int p_argcount, Callable::CallError &r_call_error) const {
-	const Variant **args = (const Variant **)alloca(sizeof(Variant *) * (binds.size() + p_argcount));
+	const Variant *binds = _get_binds();
+	const Variant **args = (const Variant **)alloca(sizeof(Variant *) * (bind_count + p_argcount));
 	for (int i = 0; i < p_argcount; i++) {
 		args[i] = (const Variant *)p_arguments[i];
 	}
-	for (int i = 0; i < binds.size(); i++) {
-		args[i + p_argcount] = (const Variant *)&binds[i];
+	for (int i = 0; i < bind_count; i++) {
+		args[i + p_argcount] = &binds[i];
 	}
 
-	return callable.rpcp(p_peer_id, args, p_argcount + binds.size(), r_call_error);
+	return callable.rpcp(p_peer_id, args, p_argcount + bind_count, r_call_error);
 }
 
-CallableCustomBind::CallableCustomBind(const Callable &p_callable, const Vector<Variant> &p_binds) {
+static constexpr size_t CALLABLE_CUSTOM_BIND_BINDS_OFFSET = (sizeof(CallableCustomBind) + alignof(Variant) - 1) & ~(alignof(Variant) - 1);
+
+const Variant *CallableCustomBind::_get_binds() const {
+	return reinterpret_cast<const Variant *>(reinterpret_cast<const uint8_t *>(this) + CALLABLE_CUSTOM_BIND_BINDS_OFFSET);
+}
+
+Vector<Variant> CallableCustomBind::get_binds() const {
+	Vector<Variant> binds;
+	binds.resize(bind_count);
+	Variant *w = binds.ptrw();
+	const Variant *r = _get_binds();
+	for (int i = 0; i < bind_count; i++) {
+		w[i] = r[i];
+	}
+	return binds;
+}
+
+CallableCustomBind *CallableCustomBind::create(const Callable &p_callable, const Variant **p_binds, int p_bind_count) {
+	// A single allocation holds both the object and the bound arguments.
+	void *mem = Memory::alloc_static(CALLABLE_CUSTOM_BIND_BINDS_OFFSET + sizeof(Variant) * p_bind_count);
+	return memnew_placement(mem, CallableCustomBind(p_callable, p_binds, p_bind_count));
+}
+
+CallableCustomBind::CallableCustomBind(const Callable &p_callable, const Variant **p_binds, int p_bind_count) {
 	callable = p_callable;
-	binds = p_binds;
+	Variant *binds = const_cast<Variant *>(_get_binds());
+	for (int i = 0; i < p_bind_count; i++) {
+		memnew_placement(&binds[i], Variant(*p_binds[i]));
+	}
+	bind_count = p_bind_count;
+}
+
+CallableCustomBind::~CallableCustomBind() {
+	Variant *binds = const_cast<Variant *>(_get_binds());
+	for (int i = 0; i < bind_count; i++) {
+		binds[i].~Variant();
+	}
 }
 
 //////////////////////////////////
@@ -35,11 +35,16 @@
 
 class CallableCustomBind : public CallableCustom {
 	Callable callable;
-	Vector<Variant> binds;
+
+	// Bound arguments are stored right after the object, in the same allocation, see `create()`.
+	int bind_count = 0;
+	const Variant *_get_binds() const;
 
 	static bool _equal_func(const CallableCustom *p_a, const CallableCustom *p_b);
 	static bool _less_func(const CallableCustom *p_a, const CallableCustom *p_b);
 
+	CallableCustomBind(const Callable &p_callable, const Variant **p_binds, int p_bind_count);
+
 public:
 	//for every type that inherits, these must always be the same for this type
 	virtual uint32_t hash() const override;
@@ -57,9 +62,12 @@ public:
 	virtual void get_bound_arguments(Vector<Variant> &r_arguments) const override;
 	virtual int get_unbound_arguments_count() const override;
 	Callable get_callable() { return callable; }
-	Vector<Variant> get_binds() { return binds; }
+	Vector<Variant> get_binds() const;
+
+	static CallableCustomBind *create(const Callable &p_callable, const Variant **p_binds, int p_bind_count);
 
-	CallableCustomBind(const Callable &p_callable, const Vector<Variant> &p_binds);
+	CallableCustomBind(const CallableCustomBind &) = delete;
+	virtual ~CallableCustomBind();
 };
 
 class CallableCustomUnbind : public CallableCustom {
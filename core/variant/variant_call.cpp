@@ -31,6 +31,7 @@
 #include "core/debugger/engine_debugger.h"
 #include "core/io/compression.h"
 #include "core/io/marshalls.h"
+#include "core/math/packed_array_math.h"
 #include "core/os/os.h"
 #include "core/templates/a_hash_map.h"
 #include "core/templates/local_vector.h"
@@ -1259,6 +1260,82 @@ struct _VariantCall {
 		enum_data[p_type].value_to_enum[p_enumeration_name] = p_enum_type_name;
 	}
 
+	// Bulk operations on packed float arrays, see `PackedArrayMath`.
+	template <typename T>
+	static void func_PackedFloatArray_add_scalar(Vector<T> *p_instance, double p_value) {
+		PackedArrayMath::add_scalar<T>(p_instance->ptrw(), p_instance->size(), (T)p_value);
+	}
+
+	template <typename T>
+	static void func_PackedFloatArray_multiply_scalar(Vector<T> *p_instance, double p_value) {
+		PackedArrayMath::multiply_scalar<T>(p_instance->ptrw(), p_instance->size(), (T)p_value);
+	}
+
+	template <typename T>
+	static void func_PackedFloatArray_multiply_add_scalar(Vector<T> *p_instance, double p_mul, double p_add) {
+		PackedArrayMath::multiply_add_scalar<T>(p_instance->ptrw(), p_instance->size(), (T)p_mul, (T)p_add);
+	}
+
+	template <typename T>
+	static void func_PackedFloatArray_add_array(Vector<T> *p_instance, const Vector<T> &p_array) {
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "Both arrays must have the same size.");
+		PackedArrayMath::add<T>(p_instance->ptrw(), p_array.ptr(), p_instance->size());
+	}
+
+	template <typename T>
+	static void func_PackedFloatArray_multiply_array(Vector<T> *p_instance, const Vector<T> &p_array) {
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "Both arrays must have the same size.");
+		PackedArrayMath::multiply<T>(p_instance->ptrw(), p_array.ptr(), p_instance->size());
+	}
+
+	template <typename T>
+	static void func_PackedFloatArray_multiply_add_array(Vector<T> *p_instance, const Vector<T> &p_mul, const Vector<T> &p_add) {
+		ERR_FAIL_COND_MSG(p_mul.size() != p_instance->size() || p_add.size() != p_instance->size(), "All arrays must have the same size.");
+		PackedArrayMath::multiply_add<T>(p_instance->ptrw(), p_mul.ptr(), p_add.ptr(), p_instance->size());
+	}
+
+	template <typename T>
+	static void func_PackedFloatArray_clamp(Vector<T> *p_instance, double p_min, double p_max) {
+		PackedArrayMath::clamp<T>(p_instance->ptrw(), p_instance->size(), (T)p_min, (T)p_max);
+	}
+
+	template <typename T>
+	static void func_PackedFloatArray_lerp(Vector<T> *p_instance, const Vector<T> &p_to, double p_weight) {
+		ERR_FAIL_COND_MSG(p_to.size() != p_instance->size(), "Both arrays must have the same size.");
+		PackedArrayMath::lerp<T>(p_instance->ptrw(), p_to.ptr(), p_instance->size(), (T)p_weight);
+	}
+
+	template <typename T>
+	static void func_PackedFloatArray_select(Vector<T> *p_instance, const PackedByteArray &p_mask, const Vector<T> &p_array) {
+		ERR_FAIL_COND_MSG(p_mask.size() != p_instance->size() || p_array.size() != p_instance->size(), "The mask and both arrays must have the same size.");
+		PackedArrayMath::select<T>(p_instance->ptrw(), p_array.ptr(), p_mask.ptr(), p_instance->size());
+	}
+
+	template <typename T>
+	static double func_PackedFloatArray_sum(Vector<T> *p_instance) {
+		return PackedArrayMath::sum<T>(p_instance->ptr(), p_instance->size());
+	}
+
+	template <typename T>
+	static double func_PackedFloatArray_dot(Vector<T> *p_instance, const Vector<T> &p_array) {
+		ERR_FAIL_COND_V_MSG(p_array.size() != p_instance->size(), 0.0, "Both arrays must have the same size.");
+		return PackedArrayMath::dot<T>(p_instance->ptr(), p_array.ptr(), p_instance->size());
+	}
+
+	template <typename T>
+	static double func_PackedFloatArray_min(Vector<T> *p_instance) {
+		return p_instance->is_empty() ? 0.0 : (double)PackedArrayMath::min<T>(p_instance->ptr(), p_instance->size());
+	}
+
+	template <typename T>
+	static double func_PackedFloatArray_max(Vector<T> *p_instance) {
+		return p_instance->is_empty() ? 0.0 : (double)PackedArrayMath::max<T>(p_instance->ptr(), p_instance->size());
+	}
+
+	static void func_PackedVector3Array_transform(PackedVector3Array *p_instance, const Transform3D &p_transform) {
+		PackedArrayMath::transform(p_instance->ptrw(), p_instance->size(), p_transform);
+	}
+
 #ifndef DISABLE_DEPRECATED
 	template <typename T>
 	static Vector<T> _duplicate_bind_compat_112290(Vector<T> *p_vector) {
@@ -2911,6 +2988,20 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedFloat32Array, count, sarray("value"), varray());
 	bind_method(PackedFloat32Array, erase, sarray("value"), varray());
 
+	bind_functionnc(PackedFloat32Array, add_scalar, _VariantCall::func_PackedFloatArray_add_scalar<float>, sarray("value"), varray());
+	bind_functionnc(PackedFloat32Array, multiply_scalar, _VariantCall::func_PackedFloatArray_multiply_scalar<float>, sarray("value"), varray());
+	bind_functionnc(PackedFloat32Array, multiply_add_scalar, _VariantCall::func_PackedFloatArray_multiply_add_scalar<float>, sarray("multiplier", "addend"), varray());
+	bind_functionnc(PackedFloat32Array, add_array, _VariantCall::func_PackedFloatArray_add_array<float>, sarray("array"), varray());
+	bind_functionnc(PackedFloat32Array, multiply_array, _VariantCall::func_PackedFloatArray_multiply_array<float>, sarray("array"), varray());
+	bind_functionnc(PackedFloat32Array, multiply_add_array, _VariantCall::func_PackedFloatArray_multiply_add_array<float>, sarray("multipliers", "addends"), varray());
+	bind_functionnc(PackedFloat32Array, clamp, _VariantCall::func_PackedFloatArray_clamp<float>, sarray("min", "max"), varray());
+	bind_functionnc(PackedFloat32Array, lerp, _VariantCall::func_PackedFloatArray_lerp<float>, sarray("to", "weight"), varray());
+	bind_functionnc(PackedFloat32Array, select, _VariantCall::func_PackedFloatArray_select<float>, sarray("mask", "array"), varray());
+	bind_function(PackedFloat32Array, sum, _VariantCall::func_PackedFloatArray_sum<float>, sarray(), varray());
+	bind_function(PackedFloat32Array, dot, _VariantCall::func_PackedFloatArray_dot<float>, sarray("array"), varray());
+	bind_function(PackedFloat32Array, min, _VariantCall::func_PackedFloatArray_min<float>, sarray(), varray());
+	bind_function(PackedFloat32Array, max, _VariantCall::func_PackedFloatArray_max<float>, sarray(), varray());
+
 	/* Float64 Array */
 
 	bind_method(PackedFloat64Array, size, sarray(), varray());
@@ -2939,6 +3030,20 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedFloat64Array, count, sarray("value"), varray());
 	bind_method(PackedFloat64Array, erase, sarray("value"), varray());
 
+	bind_functionnc(PackedFloat64Array, add_scalar, _VariantCall::func_PackedFloatArray_add_scalar<double>, sarray("value"), varray());
+	bind_functionnc(PackedFloat64Array, multiply_scalar, _VariantCall::func_PackedFloatArray_multiply_scalar<double>, sarray("value"), varray());
+	bind_functionnc(PackedFloat64Array, multiply_add_scalar, _VariantCall::func_PackedFloatArray_multiply_add_scalar<double>, sarray("multiplier", "addend"), varray());
+	bind_functionnc(PackedFloat64Array, add_array, _VariantCall::func_PackedFloatArray_add_array<double>, sarray("array"), varray());
+	bind_functionnc(PackedFloat64Array, multiply_array, _VariantCall::func_PackedFloatArray_multiply_array<double>, sarray("array"), varray());
+	bind_functionnc(PackedFloat64Array, multiply_add_array, _VariantCall::func_PackedFloatArray_multiply_add_array<double>, sarray("multipliers", "addends"), varray());
+	bind_functionnc(PackedFloat64Array, clamp, _VariantCall::func_PackedFloatArray_clamp<double>, sarray("min", "max"), varray());
+	bind_functionnc(PackedFloat64Array, lerp, _VariantCall::func_PackedFloatArray_lerp<double>, sarray("to", "weight"), varray());
+	bind_functionnc(PackedFloat64Array, select, _VariantCall::func_PackedFloatArray_select<double>, sarray("mask", "array"), varray());
+	bind_function(PackedFloat64Array, sum, _VariantCall::func_PackedFloatArray_sum<double>, sarray(), varray());
+	bind_function(PackedFloat64Array, dot, _VariantCall::func_PackedFloatArray_dot<double>, sarray("array"), varray());
+	bind_function(PackedFloat64Array, min, _VariantCall::func_PackedFloatArray_min<double>, sarray(), varray());
+	bind_function(PackedFloat64Array, max, _VariantCall::func_PackedFloatArray_max<double>, sarray(), varray());
+
 	/* String Array */
 
 	bind_method(PackedStringArray, size, sarray(), varray());
@@ -3023,6 +3128,8 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedVector3Array, count, sarray("value"), varray());
 	bind_method(PackedVector3Array, erase, sarray("value"), varray());
 
+	bind_functionnc(PackedVector3Array, transform, _VariantCall::func_PackedVector3Array_transform, sarray("transform"), varray());
+
 	/* Color Array */
 
 	bind_method(PackedColorArray, size, sarray(), varray());
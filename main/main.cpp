@@ -284,6 +284,7 @@ static int fixed_fps = -1;
 static MovieWriter *movie_writer = nullptr;
 static bool disable_vsync = false;
 static bool print_fps = false;
+static bool print_hitches = false;
 #ifdef TOOLS_ENABLED
 static bool editor_pseudolocalization = false;
 static bool dump_gdextension_interface = false;
@@ -649,6 +650,9 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("-b, --breakpoints", "Breakpoint list as source::line comma-separated pairs, no spaces (use %%20 instead).\n");
 	print_help_option("--ignore-error-breaks", "If debugger is connected, prevents sending error breakpoints.\n");
 	print_help_option("--profiling", "Enable profiling in the script debugger.\n");
+#if defined(DEBUG_ENABLED) && defined(MODULE_GDSCRIPT_ENABLED)
+	print_help_option("--gdscript-sampling-profile <file>", "Periodically sample the GDScript call stacks of all threads and write them to <file> in collapsed stack (flame graph) format on exit.\n", CLI_OPTION_AVAILABILITY_TEMPLATE_DEBUG);
+#endif
 	print_help_option("--gpu-profile", "Show a GPU profile of the tasks that took the most time during frame rendering.\n");
 	print_help_option("--gpu-validation", "Enable graphics API validation layers for debugging.\n");
 #ifdef DEBUG_ENABLED
@@ -681,6 +685,7 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("--fixed-fps <fps>", "Force a fixed number of frames per second. This setting disables real-time synchronization.\n");
 	print_help_option("--delta-smoothing <enable>", "Enable or disable frame delta smoothing [\"enable\", \"disable\"].\n");
 	print_help_option("--print-fps", "Print the frames per second to the stdout.\n");
+	print_help_option("--print-hitches", "Print the timing breakdown of frames exceeding the hitch budget to the stdout.\n");
 #ifdef TOOLS_ENABLED
 	print_help_option("--editor-pseudolocalization", "Enable pseudolocalization for the editor and the project manager.\n", CLI_OPTION_AVAILABILITY_EDITOR);
 #endif
@@ -1948,6 +1953,8 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 			disable_vsync = true;
 		} else if (arg == "--print-fps") {
 			print_fps = true;
+		} else if (arg == "--print-hitches") {
+			print_hitches = true;
 #ifdef TOOLS_ENABLED
 		} else if (arg == "--editor-pseudolocalization") {
 			editor_pseudolocalization = true;
@@ -2244,8 +2251,13 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	}
 
 	GLOBAL_DEF("debug/settings/stdout/print_fps", false);
+	GLOBAL_DEF("debug/settings/stdout/print_hitches", false);
 	GLOBAL_DEF("debug/settings/stdout/print_gpu_profile", false);
 	GLOBAL_DEF("debug/settings/stdout/verbose_stdout", false);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "debug/settings/frame_timing/history_size", PROPERTY_HINT_RANGE, "0,1024,1,or_greater"), 120);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "debug/settings/frame_timing/hitch_budget_msec", PROPERTY_HINT_RANGE, "0,1000,0.1,or_greater,suffix:ms"), 0.0);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "debug/settings/frame_timing/max_hitches", PROPERTY_HINT_RANGE, "0,256,1,or_greater"), 16);
+	GLOBAL_DEF("debug/settings/frame_timing/profile_scripts", false);
 	GLOBAL_DEF("debug/settings/physics_interpolation/enable_warnings", true);
 	if (!OS::get_singleton()->_verbose_stdout) { // Not manually overridden.
 		OS::get_singleton()->_verbose_stdout = GLOBAL_GET("debug/settings/stdout/verbose_stdout");
@@ -4094,6 +4106,10 @@ int Main::start() {
 				script = E->next()->get();
 			} else if (E->get() == "--main-loop") {
 				main_loop_type = E->next()->get();
+#if defined(DEBUG_ENABLED) && defined(MODULE_GDSCRIPT_ENABLED)
+			} else if (E->get() == "--gdscript-sampling-profile") {
+				// Handled by the GDScript module, only skip the file path here.
+#endif
 #ifdef TOOLS_ENABLED
 			} else if (E->get() == "--doctool") {
 				doc_tool_path = E->next()->get();
@@ -4409,6 +4425,7 @@ int Main::start() {
 	}
 
 	OS::get_singleton()->set_main_loop(main_loop);
+	performance->setup_frame_timing(print_hitches);
 
 	SceneTree *sml = Object::cast_to<SceneTree>(main_loop);
 	if (sml) {
@@ -4889,6 +4906,15 @@ bool Main::is_iterating() {
 static uint64_t physics_process_max = 0;
 static uint64_t process_max = 0;
 static uint64_t navigation_process_max = 0;
+static uint64_t thread_groups_usec = 0;
+static uint64_t audio_lock_wait_usec = 0;
+
+// Flushes the message queue, returning the time it took.
+static uint64_t _timed_message_queue_flush(CallQueue *p_message_queue) {
+	const uint64_t flush_begin = OS::get_singleton()->get_ticks_usec();
+	p_message_queue->flush();
+	return OS::get_singleton()->get_ticks_usec() - flush_begin;
+}
 
 // Return false means iterating further, returning true means `OS::run`
 // will terminate the program. In case of failure, the OS exit code needs
@@ -4919,6 +4945,8 @@ bool Main::iteration() {
 
 	uint64_t physics_process_ticks = 0;
 	uint64_t process_ticks = 0;
+	Performance::FrameTiming frame_timing;
+	frame_timing.frame = Engine::get_singleton()->_process_frames;
 #if !defined(NAVIGATION_2D_DISABLED) || !defined(NAVIGATION_3D_DISABLED)
 	uint64_t navigation_process_ticks = 0;
 #endif // !defined(NAVIGATION_2D_DISABLED) || !defined(NAVIGATION_3D_DISABLED)
@@ -4953,6 +4981,7 @@ bool Main::iteration() {
 		Engine::get_singleton()->_physics_frames++;
 
 		uint64_t physics_begin = OS::get_singleton()->get_ticks_usec();
+		const uint64_t physics_nested_usec = frame_timing.navigation_usec + frame_timing.message_queue_usec;
 
 		// Prepare the fixed timestep interpolated nodes BEFORE they are updated
 		// by the physics server, otherwise the current and previous transforms
@@ -4998,10 +5027,12 @@ bool Main::iteration() {
 		NavigationServer3D::get_singleton()->physics_process(physics_step * time_scale);
 #endif // NAVIGATION_3D_DISABLED
 
-		navigation_process_ticks = MAX(navigation_process_ticks, OS::get_singleton()->get_ticks_usec() - navigation_begin); // keep the largest one for reference
-		navigation_process_max = MAX(OS::get_singleton()->get_ticks_usec() - navigation_begin, navigation_process_max);
+		const uint64_t navigation_ticks = OS::get_singleton()->get_ticks_usec() - navigation_begin;
+		navigation_process_ticks = MAX(navigation_process_ticks, navigation_ticks); // keep the largest one for reference
+		navigation_process_max = MAX(navigation_ticks, navigation_process_max);
+		frame_timing.navigation_usec += navigation_ticks;
 
-		message_queue->flush();
+		frame_timing.message_queue_usec += _timed_message_queue_flush(message_queue);
 #endif // !defined(NAVIGATION_2D_DISABLED) || !defined(NAVIGATION_3D_DISABLED)
 
 #ifndef PHYSICS_3D_DISABLED
@@ -5016,13 +5047,17 @@ bool Main::iteration() {
 		PhysicsServer2D::get_singleton()->step(physics_step * time_scale);
 #endif // PHYSICS_2D_DISABLED
 
-		message_queue->flush();
+		frame_timing.message_queue_usec += _timed_message_queue_flush(message_queue);
 
 		GodotProfileZoneGrouped(_profile_zone, "main loop iteration end");
 		OS::get_singleton()->get_main_loop()->iteration_end();
 
-		physics_process_ticks = MAX(physics_process_ticks, OS::get_singleton()->get_ticks_usec() - physics_begin); // keep the largest one for reference
-		physics_process_max = MAX(OS::get_singleton()->get_ticks_usec() - physics_begin, physics_process_max);
+		const uint64_t physics_ticks = OS::get_singleton()->get_ticks_usec() - physics_begin;
+		physics_process_ticks = MAX(physics_process_ticks, physics_ticks); // keep the largest one for reference
+		physics_process_max = MAX(physics_ticks, physics_process_max);
+		// Navigation and message queue flushes are reported separately.
+		frame_timing.physics_usec += physics_ticks - (frame_timing.navigation_usec + frame_timing.message_queue_usec - physics_nested_usec);
+		frame_timing.physics_steps++;
 
 		Engine::get_singleton()->_in_physics = false;
 	}
@@ -5037,8 +5072,10 @@ bool Main::iteration() {
 	if (OS::get_singleton()->get_main_loop()->process(process_step * time_scale)) {
 		exit = true;
 	}
-	message_queue->flush();
+	frame_timing.process_usec = OS::get_singleton()->get_ticks_usec() - process_begin;
+	frame_timing.message_queue_usec += _timed_message_queue_flush(message_queue);
 
+	const uint64_t navigation_process_begin = OS::get_singleton()->get_ticks_usec();
 #ifndef NAVIGATION_2D_DISABLED
 	GodotProfileZoneGrouped(_profile_zone, "process 2D navigation");
 	NavigationServer2D::get_singleton()->process(process_step * time_scale);
@@ -5047,9 +5084,13 @@ bool Main::iteration() {
 	GodotProfileZoneGrouped(_profile_zone, "process 3D navigation");
 	NavigationServer3D::get_singleton()->process(process_step * time_scale);
 #endif // NAVIGATION_3D_DISABLED
+	const uint64_t render_sync_begin = OS::get_singleton()->get_ticks_usec();
+	frame_timing.navigation_usec += render_sync_begin - navigation_process_begin;
 
 	GodotProfileZoneGrouped(_profile_zone, "RenderingServer::sync");
 	RenderingServer::get_singleton()->sync(); //sync if still drawing from previous frames.
+	const uint64_t render_draw_begin = OS::get_singleton()->get_ticks_usec();
+	frame_timing.render_sync_usec = render_draw_begin - render_sync_begin;
 
 	GodotProfileZoneGrouped(_profile_zone, "RenderingServer::draw");
 	const bool has_pending_resources_for_processing = RD::get_singleton() && RD::get_singleton()->has_pending_resources_for_processing();
@@ -5071,7 +5112,9 @@ bool Main::iteration() {
 		}
 	}
 
-	process_ticks = OS::get_singleton()->get_ticks_usec() - process_begin;
+	const uint64_t process_end = OS::get_singleton()->get_ticks_usec();
+	frame_timing.render_draw_usec = process_end - render_draw_begin;
+	process_ticks = process_end - process_begin;
 	process_max = MAX(process_ticks, process_max);
 	uint64_t frame_time = OS::get_singleton()->get_ticks_usec() - ticks;
 
@@ -5084,7 +5127,21 @@ bool Main::iteration() {
 	}
 
 	GodotProfileZoneGrouped(_profile_zone, "AudioServer::update");
+	const uint64_t audio_begin = OS::get_singleton()->get_ticks_usec();
 	AudioServer::get_singleton()->update();
+	const uint64_t audio_end = OS::get_singleton()->get_ticks_usec();
+	frame_timing.audio_usec = audio_end - audio_begin;
+	// Both are running totals, only the part added during this frame is recorded.
+	if (SceneTree *tree = SceneTree::get_singleton()) {
+		const uint64_t usec = tree->get_thread_groups_usec();
+		frame_timing.thread_groups_usec = usec - MIN(thread_groups_usec, usec);
+		thread_groups_usec = usec;
+	}
+	const uint64_t lock_wait_usec = AudioServer::get_singleton()->get_main_thread_lock_wait_usec();
+	frame_timing.audio_lock_wait_usec = lock_wait_usec - audio_lock_wait_usec;
+	audio_lock_wait_usec = lock_wait_usec;
+	frame_timing.total_usec = audio_end - ticks;
+	performance->add_frame_timing(frame_timing);
 
 	if (EngineDebugger::is_active()) {
 		EngineDebugger::get_singleton()->iteration(frame_time, process_ticks, physics_process_ticks, physics_step);
@@ -32,7 +32,9 @@
 #include "performance.compat.inc"
 
 #include "core/config/engine.h"
+#include "core/config/project_settings.h"
 #include "core/object/class_db.h"
+#include "core/object/script_language.h"
 #include "core/os/os.h"
 #include "core/variant/typed_array.h"
 #include "scene/main/node.h"
@@ -67,6 +69,11 @@ void Performance::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_monitor_modification_time"), &Performance::get_monitor_modification_time);
 	ClassDB::bind_method(D_METHOD("get_custom_monitor_names"), &Performance::get_custom_monitor_names);
 	ClassDB::bind_method(D_METHOD("get_custom_monitor_types"), &Performance::get_custom_monitor_types);
+	ClassDB::bind_method(D_METHOD("get_frame_timings"), &Performance::get_frame_timings);
+	ClassDB::bind_method(D_METHOD("get_hitches"), &Performance::get_hitches);
+	ClassDB::bind_method(D_METHOD("clear_hitches"), &Performance::clear_hitches);
+	ClassDB::bind_method(D_METHOD("set_hitch_budget", "msec"), &Performance::set_hitch_budget);
+	ClassDB::bind_method(D_METHOD("get_hitch_budget"), &Performance::get_hitch_budget);
 
 	BIND_ENUM_CONSTANT(TIME_FPS);
 	BIND_ENUM_CONSTANT(TIME_PROCESS);
@@ -135,6 +142,25 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_EDGE_FREE_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_OBSTACLE_COUNT);
 #endif // NAVIGATION_3D_DISABLED
+	BIND_ENUM_CONSTANT(PHYSICS_2D_STEP_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_2D_BROADPHASE_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_2D_NARROWPHASE_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_2D_ISLAND_GENERATION_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_2D_CONSTRAINT_SETUP_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_2D_CONSTRAINT_SOLVE_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_2D_INTEGRATION_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_2D_AREA_QUERY_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_2D_CALLBACK_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_STEP_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_BROADPHASE_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_NARROWPHASE_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_ISLAND_GENERATION_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_CONSTRAINT_SETUP_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_CONSTRAINT_SOLVE_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_INTEGRATION_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_AREA_QUERY_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_CALLBACK_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_JOB_COUNT);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 
 	BIND_ENUM_CONSTANT(MONITOR_TYPE_QUANTITY);
@@ -230,6 +256,25 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("navigation_3d/edges_free"),
 		PNAME("navigation_3d/obstacles"),
 #endif // NAVIGATION_3D_DISABLED
+		PNAME("physics_2d/step_time"),
+		PNAME("physics_2d/broadphase_time"),
+		PNAME("physics_2d/narrowphase_time"),
+		PNAME("physics_2d/island_generation_time"),
+		PNAME("physics_2d/constraint_setup_time"),
+		PNAME("physics_2d/constraint_solve_time"),
+		PNAME("physics_2d/integration_time"),
+		PNAME("physics_2d/area_query_time"),
+		PNAME("physics_2d/callback_time"),
+		PNAME("physics_3d/step_time"),
+		PNAME("physics_3d/broadphase_time"),
+		PNAME("physics_3d/narrowphase_time"),
+		PNAME("physics_3d/island_generation_time"),
+		PNAME("physics_3d/constraint_setup_time"),
+		PNAME("physics_3d/constraint_solve_time"),
+		PNAME("physics_3d/integration_time"),
+		PNAME("physics_3d/area_query_time"),
+		PNAME("physics_3d/callback_time"),
+		PNAME("physics_3d/job_count"),
 	};
 	static_assert(std_size(names) == MONITOR_MAX);
 
@@ -455,6 +500,90 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_OBSTACLE_COUNT);
 #endif // NAVIGATION_3D_DISABLED
 
+#ifndef PHYSICS_2D_DISABLED
+		case PHYSICS_2D_STEP_TIME:
+			return USEC_TO_SEC(PhysicsServer2D::get_singleton()->get_process_info(PhysicsServer2D::INFO_STEP_TIME));
+		case PHYSICS_2D_BROADPHASE_TIME:
+			return USEC_TO_SEC(PhysicsServer2D::get_singleton()->get_process_info(PhysicsServer2D::INFO_BROADPHASE_TIME));
+		case PHYSICS_2D_NARROWPHASE_TIME:
+			return USEC_TO_SEC(PhysicsServer2D::get_singleton()->get_process_info(PhysicsServer2D::INFO_NARROWPHASE_TIME));
+		case PHYSICS_2D_ISLAND_GENERATION_TIME:
+			return USEC_TO_SEC(PhysicsServer2D::get_singleton()->get_process_info(PhysicsServer2D::INFO_ISLAND_GENERATION_TIME));
+		case PHYSICS_2D_CONSTRAINT_SETUP_TIME:
+			return USEC_TO_SEC(PhysicsServer2D::get_singleton()->get_process_info(PhysicsServer2D::INFO_CONSTRAINT_SETUP_TIME));
+		case PHYSICS_2D_CONSTRAINT_SOLVE_TIME:
+			return USEC_TO_SEC(PhysicsServer2D::get_singleton()->get_process_info(PhysicsServer2D::INFO_CONSTRAINT_SOLVE_TIME));
+		case PHYSICS_2D_INTEGRATION_TIME:
+			return USEC_TO_SEC(PhysicsServer2D::get_singleton()->get_process_info(PhysicsServer2D::INFO_INTEGRATION_TIME));
+		case PHYSICS_2D_AREA_QUERY_TIME:
+			return USEC_TO_SEC(PhysicsServer2D::get_singleton()->get_process_info(PhysicsServer2D::INFO_AREA_QUERY_TIME));
+		case PHYSICS_2D_CALLBACK_TIME:
+			return USEC_TO_SEC(PhysicsServer2D::get_singleton()->get_process_info(PhysicsServer2D::INFO_CALLBACK_TIME));
+#else
+		case PHYSICS_2D_STEP_TIME:
+			return 0;
+		case PHYSICS_2D_BROADPHASE_TIME:
+			return 0;
+		case PHYSICS_2D_NARROWPHASE_TIME:
+			return 0;
+		case PHYSICS_2D_ISLAND_GENERATION_TIME:
+			return 0;
+		case PHYSICS_2D_CONSTRAINT_SETUP_TIME:
+			return 0;
+		case PHYSICS_2D_CONSTRAINT_SOLVE_TIME:
+			return 0;
+		case PHYSICS_2D_INTEGRATION_TIME:
+			return 0;
+		case PHYSICS_2D_AREA_QUERY_TIME:
+			return 0;
+		case PHYSICS_2D_CALLBACK_TIME:
+			return 0;
+#endif // PHYSICS_2D_DISABLED
+
+#ifndef PHYSICS_3D_DISABLED
+		case PHYSICS_3D_STEP_TIME:
+			return USEC_TO_SEC(PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_STEP_TIME));
+		case PHYSICS_3D_BROADPHASE_TIME:
+			return USEC_TO_SEC(PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_BROADPHASE_TIME));
+		case PHYSICS_3D_NARROWPHASE_TIME:
+			return USEC_TO_SEC(PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_NARROWPHASE_TIME));
+		case PHYSICS_3D_ISLAND_GENERATION_TIME:
+			return USEC_TO_SEC(PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_ISLAND_GENERATION_TIME));
+		case PHYSICS_3D_CONSTRAINT_SETUP_TIME:
+			return USEC_TO_SEC(PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_CONSTRAINT_SETUP_TIME));
+		case PHYSICS_3D_CONSTRAINT_SOLVE_TIME:
+			return USEC_TO_SEC(PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_CONSTRAINT_SOLVE_TIME));
+		case PHYSICS_3D_INTEGRATION_TIME:
+			return USEC_TO_SEC(PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_INTEGRATION_TIME));
+		case PHYSICS_3D_AREA_QUERY_TIME:
+			return USEC_TO_SEC(PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_AREA_QUERY_TIME));
+		case PHYSICS_3D_CALLBACK_TIME:
+			return USEC_TO_SEC(PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_CALLBACK_TIME));
+		case PHYSICS_3D_JOB_COUNT:
+			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_JOB_COUNT);
+#else
+		case PHYSICS_3D_STEP_TIME:
+			return 0;
+		case PHYSICS_3D_BROADPHASE_TIME:
+			return 0;
+		case PHYSICS_3D_NARROWPHASE_TIME:
+			return 0;
+		case PHYSICS_3D_ISLAND_GENERATION_TIME:
+			return 0;
+		case PHYSICS_3D_CONSTRAINT_SETUP_TIME:
+			return 0;
+		case PHYSICS_3D_CONSTRAINT_SOLVE_TIME:
+			return 0;
+		case PHYSICS_3D_INTEGRATION_TIME:
+			return 0;
+		case PHYSICS_3D_AREA_QUERY_TIME:
+			return 0;
+		case PHYSICS_3D_CALLBACK_TIME:
+			return 0;
+		case PHYSICS_3D_JOB_COUNT:
+			return 0;
+#endif // PHYSICS_3D_DISABLED
+
 		default: {
 		}
 	}
@@ -527,6 +656,25 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 #endif // _3D_DISABLED
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_QUANTITY,
 
 	};
 	static_assert((sizeof(types) / sizeof(MonitorType)) == MONITOR_MAX);
@@ -546,6 +694,158 @@ void Performance::set_navigation_process_time(double p_pt) {
 	_navigation_process_time = p_pt;
 }
 
+void Performance::setup_frame_timing(bool p_print_hitches) {
+	const int history_size = GLOBAL_GET("debug/settings/frame_timing/history_size");
+	_frame_timings.clear();
+	_frame_timings.resize(MAX(history_size, 0));
+	_frame_timing_next = 0;
+	_frame_timing_count = 0;
+
+	_hitches.clear();
+	_max_hitches = MAX(int(GLOBAL_GET("debug/settings/frame_timing/max_hitches")), 0);
+	_hitch_budget_msec = GLOBAL_GET("debug/settings/frame_timing/hitch_budget_msec");
+	_print_hitches = p_print_hitches || GLOBAL_GET("debug/settings/stdout/print_hitches");
+
+	// Script function timings are only gathered while the languages are profiling,
+	// which slows down every script call, so it has to be requested explicitly.
+	_profile_scripts = GLOBAL_GET("debug/settings/frame_timing/profile_scripts") && !Engine::get_singleton()->is_editor_hint();
+	if (_profile_scripts) {
+		for (int i = 0; i < ScriptServer::get_language_count(); i++) {
+			ScriptServer::get_language(i)->profiling_start();
+		}
+	}
+}
+
+void Performance::add_frame_timing(const FrameTiming &p_timing) {
+	if (!_frame_timings.is_empty()) {
+		_frame_timings[_frame_timing_next] = p_timing;
+		_frame_timing_next = (_frame_timing_next + 1) % _frame_timings.size();
+		_frame_timing_count = MIN(_frame_timing_count + 1, _frame_timings.size());
+	}
+
+	if (_hitch_budget_msec > 0.0 && p_timing.total_usec > _hitch_budget_msec * 1000.0) {
+		_capture_hitch(p_timing);
+	}
+}
+
+Dictionary Performance::_frame_timing_to_dict(const FrameTiming &p_timing) {
+	Dictionary d;
+	d["frame"] = p_timing.frame;
+	d["total"] = USEC_TO_SEC(p_timing.total_usec);
+	d["physics"] = USEC_TO_SEC(p_timing.physics_usec);
+	d["physics_steps"] = p_timing.physics_steps;
+	d["process"] = USEC_TO_SEC(p_timing.process_usec);
+	d["thread_groups"] = USEC_TO_SEC(p_timing.thread_groups_usec);
+	d["message_queue"] = USEC_TO_SEC(p_timing.message_queue_usec);
+	d["navigation"] = USEC_TO_SEC(p_timing.navigation_usec);
+	d["render_sync"] = USEC_TO_SEC(p_timing.render_sync_usec);
+	d["render_draw"] = USEC_TO_SEC(p_timing.render_draw_usec);
+	d["audio"] = USEC_TO_SEC(p_timing.audio_usec);
+	d["audio_lock_wait"] = USEC_TO_SEC(p_timing.audio_lock_wait_usec);
+	return d;
+}
+
+void Performance::_capture_hitch(const FrameTiming &p_timing) {
+	if (_max_hitches == 0 && !_print_hitches) {
+		return;
+	}
+
+	static const int MAX_SCRIPT_FUNCTIONS = 10;
+
+	struct SelfTimeSort {
+		_FORCE_INLINE_ bool operator()(const ScriptLanguage::ProfilingInfo &p_a, const ScriptLanguage::ProfilingInfo &p_b) const {
+			return p_a.self_time > p_b.self_time;
+		}
+	};
+
+	LocalVector<ScriptLanguage::ProfilingInfo> functions;
+	if (_profile_scripts) {
+		const int max_functions = GLOBAL_GET("debug/settings/profiler/max_functions");
+		LocalVector<ScriptLanguage::ProfilingInfo> info;
+		info.resize(max_functions);
+		for (int i = 0; i < ScriptServer::get_language_count(); i++) {
+			const int count = ScriptServer::get_language(i)->profiling_get_frame_data(info.ptr(), info.size());
+			for (int j = 0; j < count; j++) {
+				functions.push_back(info[j]);
+			}
+		}
+		functions.sort_custom<SelfTimeSort>();
+		if (functions.size() > MAX_SCRIPT_FUNCTIONS) {
+			functions.resize(MAX_SCRIPT_FUNCTIONS);
+		}
+	}
+
+	Dictionary hitch = _frame_timing_to_dict(p_timing);
+	hitch["budget"] = _hitch_budget_msec / 1000.0;
+	Array script_functions;
+	for (const ScriptLanguage::ProfilingInfo &info : functions) {
+		Dictionary f;
+		f["function"] = info.signature;
+		f["call_count"] = info.call_count;
+		f["self_time"] = USEC_TO_SEC(info.self_time);
+		f["total_time"] = USEC_TO_SEC(info.total_time);
+		script_functions.push_back(f);
+	}
+	hitch["script_functions"] = script_functions;
+
+	if (_max_hitches > 0) {
+		if (_hitches.size() >= _max_hitches) {
+			_hitches.remove_at(0);
+		}
+		_hitches.push_back(hitch);
+	}
+
+	if (_print_hitches) {
+		print_line(vformat("Hitch on frame %d: %s ms (budget %s ms). Physics: %s ms in %d steps, process: %s ms, thread groups: %s ms, message queue: %s ms, navigation: %s ms, rendering sync: %s ms, rendering draw: %s ms, audio: %s ms, audio lock wait: %s ms.",
+				p_timing.frame, rtos(p_timing.total_usec / 1000.0).pad_decimals(2), rtos(_hitch_budget_msec).pad_decimals(2),
+				rtos(p_timing.physics_usec / 1000.0).pad_decimals(2), p_timing.physics_steps, rtos(p_timing.process_usec / 1000.0).pad_decimals(2),
+				rtos(p_timing.thread_groups_usec / 1000.0).pad_decimals(2),
+				rtos(p_timing.message_queue_usec / 1000.0).pad_decimals(2), rtos(p_timing.navigation_usec / 1000.0).pad_decimals(2),
+				rtos(p_timing.render_sync_usec / 1000.0).pad_decimals(2), rtos(p_timing.render_draw_usec / 1000.0).pad_decimals(2),
+				rtos(p_timing.audio_usec / 1000.0).pad_decimals(2), rtos(p_timing.audio_lock_wait_usec / 1000.0).pad_decimals(2)));
+		for (const ScriptLanguage::ProfilingInfo &info : functions) {
+			print_line(vformat("    %s: %s ms self, %s ms total, %d calls.", info.signature, rtos(info.self_time / 1000.0).pad_decimals(2), rtos(info.total_time / 1000.0).pad_decimals(2), info.call_count));
+		}
+	}
+}
+
+TypedArray<Dictionary> Performance::get_frame_timings() const {
+	TypedArray<Dictionary> ret;
+	if (_frame_timing_count == 0) {
+		return ret;
+	}
+	ret.resize(_frame_timing_count);
+	// Oldest first.
+	const uint32_t size = _frame_timings.size();
+	const uint32_t start = (_frame_timing_next + size - _frame_timing_count) % size;
+	for (uint32_t i = 0; i < _frame_timing_count; i++) {
+		ret[i] = _frame_timing_to_dict(_frame_timings[(start + i) % size]);
+	}
+	return ret;
+}
+
+TypedArray<Dictionary> Performance::get_hitches() const {
+	TypedArray<Dictionary> ret;
+	ret.resize(_hitches.size());
+	for (uint32_t i = 0; i < _hitches.size(); i++) {
+		ret[i] = _hitches[i];
+	}
+	return ret;
+}
+
+void Performance::clear_hitches() {
+	_hitches.clear();
+}
+
+void Performance::set_hitch_budget(double p_msec) {
+	ERR_FAIL_COND_MSG(p_msec < 0.0, "The hitch budget can't be negative.");
+	_hitch_budget_msec = p_msec;
+}
+
+double Performance::get_hitch_budget() const {
+	return _hitch_budget_msec;
+}
+
 void Performance::add_custom_monitor(const StringName &p_id, const Callable &p_callable, const Vector<Variant> &p_args, MonitorType p_type) {
 	ERR_FAIL_COND_MSG(has_custom_monitor(p_id), "Custom monitor with id '" + String(p_id) + "' already exists.");
 	_monitor_map.insert(p_id, MonitorCall(p_type, p_callable, p_args));
@@ -611,6 +911,12 @@ Performance::Performance() {
 	singleton = this;
 }
 
+Performance::~Performance() {
+	if (singleton == this) {
+		singleton = nullptr;
+	}
+}
+
 Performance::MonitorCall::MonitorCall(Performance::MonitorType p_type, const Callable &p_callable, const Vector<Variant> &p_arguments) {
 	_type = p_type;
 	_callable = p_callable;
@@ -32,6 +32,7 @@
 
 #include "core/object/object.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/type_info.h"
 
 #define PERF_WARN_OFFLINE_FUNCTION
@@ -58,6 +59,37 @@ class Performance : public Object {
 	double _physics_process_time;
 	double _navigation_process_time;
 
+public:
+	// Time spent in each part of a single `Main::iteration()`, in microseconds.
+	struct FrameTiming {
+		uint64_t frame = 0;
+		uint64_t total_usec = 0;
+		uint64_t physics_usec = 0;
+		uint32_t physics_steps = 0;
+		uint64_t process_usec = 0;
+		uint64_t thread_groups_usec = 0; // Part of `physics_usec` and `process_usec`.
+		uint64_t message_queue_usec = 0;
+		uint64_t navigation_usec = 0;
+		uint64_t render_sync_usec = 0;
+		uint64_t render_draw_usec = 0;
+		uint64_t audio_usec = 0;
+		uint64_t audio_lock_wait_usec = 0; // Not part of `audio_usec`, the lock is taken anywhere in the frame.
+	};
+
+private:
+	LocalVector<FrameTiming> _frame_timings;
+	uint32_t _frame_timing_next = 0;
+	uint32_t _frame_timing_count = 0;
+
+	LocalVector<Dictionary> _hitches;
+	uint32_t _max_hitches = 16;
+	double _hitch_budget_msec = 0.0;
+	bool _print_hitches = false;
+	bool _profile_scripts = false;
+
+	static Dictionary _frame_timing_to_dict(const FrameTiming &p_timing);
+	void _capture_hitch(const FrameTiming &p_timing);
+
 public:
 	enum Monitor {
 		TIME_FPS,
@@ -122,6 +154,25 @@ public:
 		NAVIGATION_3D_EDGE_FREE_COUNT,
 		NAVIGATION_3D_OBSTACLE_COUNT,
 #endif // _3D_DISABLED
+		PHYSICS_2D_STEP_TIME,
+		PHYSICS_2D_BROADPHASE_TIME,
+		PHYSICS_2D_NARROWPHASE_TIME,
+		PHYSICS_2D_ISLAND_GENERATION_TIME,
+		PHYSICS_2D_CONSTRAINT_SETUP_TIME,
+		PHYSICS_2D_CONSTRAINT_SOLVE_TIME,
+		PHYSICS_2D_INTEGRATION_TIME,
+		PHYSICS_2D_AREA_QUERY_TIME,
+		PHYSICS_2D_CALLBACK_TIME,
+		PHYSICS_3D_STEP_TIME,
+		PHYSICS_3D_BROADPHASE_TIME,
+		PHYSICS_3D_NARROWPHASE_TIME,
+		PHYSICS_3D_ISLAND_GENERATION_TIME,
+		PHYSICS_3D_CONSTRAINT_SETUP_TIME,
+		PHYSICS_3D_CONSTRAINT_SOLVE_TIME,
+		PHYSICS_3D_INTEGRATION_TIME,
+		PHYSICS_3D_AREA_QUERY_TIME,
+		PHYSICS_3D_CALLBACK_TIME,
+		PHYSICS_3D_JOB_COUNT,
 		MONITOR_MAX
 	};
 
@@ -141,6 +192,14 @@ public:
 	void set_physics_process_time(double p_pt);
 	void set_navigation_process_time(double p_pt);
 
+	void setup_frame_timing(bool p_print_hitches);
+	void add_frame_timing(const FrameTiming &p_timing);
+	TypedArray<Dictionary> get_frame_timings() const;
+	TypedArray<Dictionary> get_hitches() const;
+	void clear_hitches();
+	void set_hitch_budget(double p_msec);
+	double get_hitch_budget() const;
+
 	void add_custom_monitor(const StringName &p_id, const Callable &p_callable, const Vector<Variant> &p_args, MonitorType p_type = MONITOR_TYPE_QUANTITY);
 	void remove_custom_monitor(const StringName &p_id);
 	bool has_custom_monitor(const StringName &p_id);
@@ -153,6 +212,7 @@ public:
 	static Performance *get_singleton() { return singleton; }
 
 	Performance();
+	~Performance();
 
 private:
 	class MonitorCall {
@@ -31,10 +31,12 @@
 #include "gdscript.h"
 
 #include "gdscript_analyzer.h"
+#include "gdscript_bytecode_cache.h"
 #include "gdscript_cache.h"
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
 #include "gdscript_rpc_callable.h"
+#include "gdscript_sampling_profiler.h"
 #include "gdscript_tokenizer_buffer.h"
 #include "gdscript_warning.h"
 
@@ -2144,6 +2146,12 @@ void GDScriptLanguage::init() {
 	}
 #endif // TOOLS_ENABLED
 
+	GDScriptBytecodeCache::initialize();
+
+#ifdef DEBUG_ENABLED
+	GDScriptSamplingProfiler::initialize();
+#endif
+
 #ifdef DEBUG_ENABLED
 	GDScriptParser::update_project_settings();
 	if (!ProjectSettings::get_singleton()->is_connected("settings_changed", callable_mp_static(&GDScriptParser::update_project_settings))) {
@@ -2192,6 +2200,10 @@ void GDScriptLanguage::finish() {
 	}
 	finishing = true;
 
+#ifdef DEBUG_ENABLED
+	GDScriptSamplingProfiler::finalize();
+#endif
+
 	// Clear the cache before parsing the script_list
 	GDScriptCache::clear();
 
@@ -2795,6 +2807,55 @@ String GDScriptLanguage::_get_global_class_name(const String &p_path, String *r_
 thread_local GDScriptLanguage::CallLevel *GDScriptLanguage::_call_stack = nullptr;
 thread_local uint32_t GDScriptLanguage::_call_stack_size = 0;
 
+#ifdef DEBUG_ENABLED
+thread_local GDScriptLanguage::SampledCallStack *GDScriptLanguage::_sampled_call_stack = nullptr;
+SafeFlag GDScriptLanguage::_sampling_call_stacks;
+
+GDScriptLanguage::SampledCallStack *GDScriptLanguage::_register_sampled_call_stack() {
+	SampledCallStack *sampled = memnew(SampledCallStack);
+	sampled->thread_id = Thread::get_caller_id();
+
+	// Publish the levels that were entered before sampling started.
+	sampled->depth.store(_call_stack_size, std::memory_order_relaxed);
+	uint32_t index = _call_stack_size;
+	for (CallLevel *level = _call_stack; level; level = level->prev) {
+		index--;
+		if (index < MAX_SAMPLED_DEPTH) {
+			SampledFrame &frame = sampled->frames[index];
+			frame.function.store(level->function, std::memory_order_relaxed);
+			frame.line.store(*level->line, std::memory_order_relaxed);
+			level->sampled_frame = &frame;
+		}
+	}
+
+	MutexLock lock(sampled_call_stacks_mutex);
+	sampled->next = sampled_call_stacks;
+	sampled_call_stacks = sampled;
+	_sampled_call_stack = sampled;
+	return sampled;
+}
+
+void GDScriptLanguage::_unregister_sampled_call_stack() {
+	SampledCallStack *sampled = _sampled_call_stack;
+	if (!sampled) {
+		return;
+	}
+
+	// The sampler holds this lock while it reads the stack, so once it is released
+	// the published frames are no longer referenced.
+	MutexLock lock(sampled_call_stacks_mutex);
+	SampledCallStack **E = &sampled_call_stacks;
+	while (*E && *E != sampled) {
+		E = &(*E)->next;
+	}
+	if (*E) {
+		*E = sampled->next;
+	}
+	memdelete(sampled);
+	_sampled_call_stack = nullptr;
+}
+#endif // DEBUG_ENABLED
+
 GDScriptLanguage::CallLevel *GDScriptLanguage::_get_stack_level(uint32_t p_level) {
 	ERR_FAIL_UNSIGNED_INDEX_V(p_level, _call_stack_size, nullptr);
 	CallLevel *level = _call_stack; // Start from top
@@ -2806,6 +2867,12 @@ GDScriptLanguage::CallLevel *GDScriptLanguage::_get_stack_level(uint32_t p_level
 	return level;
 }
 
+void GDScriptLanguage::thread_exit() {
+#ifdef DEBUG_ENABLED
+	_unregister_sampled_call_stack();
+#endif
+}
+
 GDScriptLanguage::GDScriptLanguage() {
 	ERR_FAIL_COND(singleton);
 	singleton = this;
@@ -2836,6 +2903,8 @@ GDScriptLanguage::GDScriptLanguage() {
 	track_call_stack = true;
 	track_locals = track_locals || EngineDebugger::is_active();
 
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "debug/settings/gdscript/sampling_profiler_interval", PROPERTY_HINT_RANGE, U"50,100000,1,suffix:\u00B5s"), 1000);
+
 	GLOBAL_DEF("debug/gdscript/warnings/enable", true);
 
 	GLOBAL_DEF(PropertyInfo(Variant::DICTIONARY,
@@ -2864,6 +2933,18 @@ GDScriptLanguage::GDScriptLanguage() {
 }
 
 GDScriptLanguage::~GDScriptLanguage() {
+#ifdef DEBUG_ENABLED
+	// Threads that never went through `thread_exit()` (such as the main thread) leave their entry behind.
+	while (sampled_call_stacks) {
+		SampledCallStack *next = sampled_call_stacks->next;
+		memdelete(sampled_call_stacks);
+		sampled_call_stacks = next;
+	}
+	_sampled_call_stack = nullptr;
+#endif
+
+	GDScriptFunctionState::clear_frame_pool();
+
 	singleton = nullptr;
 }
 
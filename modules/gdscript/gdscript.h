@@ -82,6 +82,7 @@ class GDScript : public Script {
 	friend class GDScriptInstance;
 	friend class GDScriptFunction;
 	friend class GDScriptAnalyzer;
+	friend class GDScriptBytecodeCache;
 	friend class GDScriptCompiler;
 	friend class GDScriptDocGen;
 	friend class GDScriptLambdaCallable;
@@ -419,6 +420,20 @@ class GDScriptLanguage : public ScriptLanguage {
 	HashMap<StringName, Variant> named_globals;
 	Vector<int> global_array_empty_indexes;
 
+#ifdef DEBUG_ENABLED
+	static constexpr uint32_t MAX_SAMPLED_DEPTH = 128;
+
+	// One call level as seen by GDScriptSamplingProfiler. Everything is published by value,
+	// so the sampler never follows pointers into the stack of another thread.
+	struct SampledFrame {
+		std::atomic<GDScriptFunction *> function = { nullptr };
+		std::atomic<int> line = { 0 };
+		// Native call currently in progress from this level.
+		std::atomic<MethodBind *> native_method = { nullptr };
+		std::atomic<const StringName *> native_name = { nullptr };
+	};
+#endif // DEBUG_ENABLED
+
 	struct CallLevel {
 		Variant *stack = nullptr;
 		GDScriptFunction *function = nullptr;
@@ -426,8 +441,90 @@ class GDScriptLanguage : public ScriptLanguage {
 		int *ip = nullptr;
 		int *line = nullptr;
 		CallLevel *prev = nullptr; // Reverse linked list (stack).
+#ifdef DEBUG_ENABLED
+		SampledFrame *sampled_frame = nullptr; // Set while the thread's stack is being sampled.
+
+		_FORCE_INLINE_ void sample_line(int p_line) {
+			if (unlikely(sampled_frame)) {
+				sampled_frame->line.store(p_line, std::memory_order_relaxed);
+			}
+		}
+		_FORCE_INLINE_ void sample_native_method(MethodBind *p_method) {
+			if (unlikely(sampled_frame)) {
+				sampled_frame->native_method.store(p_method, std::memory_order_relaxed);
+			}
+		}
+		_FORCE_INLINE_ void sample_native_name(const StringName *p_name) {
+			if (unlikely(sampled_frame)) {
+				sampled_frame->native_name.store(p_name, std::memory_order_relaxed);
+			}
+		}
+#endif
+	};
+
+#ifdef DEBUG_ENABLED
+	// Copy of one thread's call stack, read by GDScriptSamplingProfiler without locking.
+	// `seq` is odd while the owning thread pushes or pops a level, see `_publish_enter_function()`.
+	// Lines and native calls are updated in place, as they don't change which level a frame holds.
+	struct SampledCallStack {
+		std::atomic<uint32_t> seq = { 0 };
+		std::atomic<uint32_t> depth = { 0 }; // Levels deeper than MAX_SAMPLED_DEPTH are not published.
+		SampledFrame frames[MAX_SAMPLED_DEPTH]; // Root first.
+		Thread::ID thread_id = Thread::UNASSIGNED_ID;
+		SampledCallStack *next = nullptr;
 	};
 
+	static thread_local SampledCallStack *_sampled_call_stack;
+	static SafeFlag _sampling_call_stacks;
+	Mutex sampled_call_stacks_mutex;
+	SampledCallStack *sampled_call_stacks = nullptr;
+
+	SampledCallStack *_register_sampled_call_stack();
+	void _unregister_sampled_call_stack();
+
+	_FORCE_INLINE_ void _publish_enter_function(CallLevel *p_level) {
+		SampledCallStack *sampled = _sampled_call_stack;
+		if (likely(sampled == nullptr)) {
+			if (likely(!_sampling_call_stacks.is_set())) {
+				return;
+			}
+			_register_sampled_call_stack(); // Publishes the whole stack, including this level.
+			return;
+		}
+		const uint32_t seq = sampled->seq.load(std::memory_order_relaxed);
+		sampled->seq.store(seq + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		const uint32_t depth = sampled->depth.load(std::memory_order_relaxed);
+		if (depth < MAX_SAMPLED_DEPTH) {
+			SampledFrame &frame = sampled->frames[depth];
+			frame.function.store(p_level->function, std::memory_order_relaxed);
+			frame.line.store(*p_level->line, std::memory_order_relaxed);
+			frame.native_method.store(nullptr, std::memory_order_relaxed);
+			frame.native_name.store(nullptr, std::memory_order_relaxed);
+			p_level->sampled_frame = &frame;
+		}
+		sampled->depth.store(depth + 1, std::memory_order_relaxed);
+		sampled->seq.store(seq + 2, std::memory_order_release);
+	}
+
+	_FORCE_INLINE_ void _publish_exit_function() {
+		SampledCallStack *sampled = _sampled_call_stack;
+		if (likely(sampled == nullptr)) {
+			if (likely(!_sampling_call_stacks.is_set())) {
+				return;
+			}
+			_register_sampled_call_stack();
+			return;
+		}
+		const uint32_t seq = sampled->seq.load(std::memory_order_relaxed);
+		sampled->seq.store(seq + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		const uint32_t depth = sampled->depth.load(std::memory_order_relaxed);
+		sampled->depth.store(depth > 0 ? depth - 1 : 0, std::memory_order_relaxed);
+		sampled->seq.store(seq + 2, std::memory_order_release);
+	}
+#endif // DEBUG_ENABLED
+
 	static thread_local int _debug_parse_err_line;
 	static thread_local String _debug_parse_err_file;
 	static thread_local String _debug_error;
@@ -447,6 +544,7 @@ class GDScriptLanguage : public ScriptLanguage {
 	String _get_global_class_name(const String &p_path, String *r_base_type, String *r_icon_path, bool *r_is_abstract, bool *r_is_tool, LocalVector<String> &r_visited) const;
 
 	friend class GDScriptInstance;
+	friend class GDScriptSamplingProfiler;
 
 	Mutex mutex;
 
@@ -505,6 +603,10 @@ public:
 		call_level->ip = p_ip;
 		call_level->line = p_line;
 		_call_stack_size++;
+
+#ifdef DEBUG_ENABLED
+		_publish_enter_function(call_level);
+#endif
 	}
 
 	_FORCE_INLINE_ void exit_function() {
@@ -535,6 +637,10 @@ public:
 
 		_call_stack_size--;
 		_call_stack = _call_stack->prev;
+
+#ifdef DEBUG_ENABLED
+		_publish_exit_function();
+#endif
 	}
 
 	virtual Vector<StackInfo> debug_get_current_stack_info() override {
@@ -631,6 +737,7 @@ public:
 	virtual void reload_tool_script(const Ref<Script> &p_script, bool p_soft_reload) override;
 
 	virtual void frame() override;
+	virtual void thread_exit() override;
 
 	virtual void get_public_functions(List<MethodInfo> *p_functions) const override;
 	virtual void get_public_constants(List<Pair<String, Variant>> *p_constants) const override;
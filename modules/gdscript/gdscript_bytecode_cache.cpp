@@ -0,0 +1,807 @@
+/**************************************************************************/
+/*  gdscript_bytecode_cache.cpp                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "gdscript_bytecode_cache.h"
+
+#include "gdscript.h"
+#include "gdscript_cache.h"
+
+#include "core/config/engine.h"
+#include "core/debugger/engine_debugger.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/io/resource_loader.h"
+#include "core/object/class_db.h"
+#include "core/version.h"
+
+bool GDScriptBytecodeCache::enabled = false;
+String GDScriptBytecodeCache::build_key;
+String GDScriptBytecodeCache::cache_dir;
+
+Mutex GDScriptBytecodeCache::reverse_tables_mutex;
+bool GDScriptBytecodeCache::reverse_tables_built = false;
+HashMap<uintptr_t, Variant> GDScriptBytecodeCache::reverse_tables[TABLE_MAX];
+
+static const char *BYTECODE_CACHE_MAGIC = "GDBC";
+
+#define TABLE_PTR_KEY(m_ptr) reinterpret_cast<uintptr_t>(m_ptr)
+
+void GDScriptBytecodeCache::initialize() {
+	enabled = false;
+
+	if (Engine::get_singleton()->is_editor_hint()) {
+		return;
+	}
+
+	Ref<FileAccess> id_file = FileAccess::open(EXPORT_ID_PATH, FileAccess::READ);
+	if (id_file.is_null()) {
+		return;
+	}
+
+	String export_id = id_file->get_line().strip_edges();
+	if (export_id.is_empty()) {
+		return;
+	}
+
+	// Bytecode is only valid for the exact engine build and export that produced it.
+	build_key = vformat("%s.%s.%s.%d", GODOT_VERSION_FULL_BUILD, GODOT_VERSION_HASH, export_id, (int)sizeof(void *));
+#ifdef DEBUG_ENABLED
+	build_key += ".debug";
+#endif
+
+	cache_dir = "user://gdscript_cache";
+	Error err = DirAccess::make_dir_recursive_absolute(cache_dir);
+	ERR_FAIL_COND_MSG(err != OK, "Can't create GDScript bytecode cache folder, no bytecode caching will happen: " + cache_dir);
+
+	enabled = true;
+}
+
+void GDScriptBytecodeCache::_build_reverse_tables() {
+	MutexLock lock(reverse_tables_mutex);
+	if (reverse_tables_built) {
+		return;
+	}
+
+	// Keep the first key found for each pointer. Any key resolving to the same
+	// pointer is equally valid when loading it back.
+#define ADD_TABLE_ENTRY(m_kind, m_ptr, m_key) \
+	if ((m_ptr) && !reverse_tables[m_kind].has(TABLE_PTR_KEY(m_ptr))) { \
+		reverse_tables[m_kind].insert(TABLE_PTR_KEY(m_ptr), m_key); \
+	}
+
+	for (int type = 0; type < Variant::VARIANT_MAX; type++) {
+		const Variant::Type vtype = Variant::Type(type);
+
+		for (int op = 0; op < Variant::OP_MAX; op++) {
+			for (int type_b = 0; type_b < Variant::VARIANT_MAX; type_b++) {
+				Variant::ValidatedOperatorEvaluator evaluator = Variant::get_validated_operator_evaluator(Variant::Operator(op), vtype, Variant::Type(type_b));
+				ADD_TABLE_ENTRY(TABLE_OPERATOR, evaluator, Vector3i(op, type, type_b));
+			}
+		}
+
+		List<StringName> members;
+		Variant::get_member_list(vtype, &members);
+		for (const StringName &member : members) {
+			Array key = { type, member };
+			ADD_TABLE_ENTRY(TABLE_SETTER, Variant::get_member_validated_setter(vtype, member), key);
+			ADD_TABLE_ENTRY(TABLE_GETTER, Variant::get_member_validated_getter(vtype, member), key);
+		}
+
+		ADD_TABLE_ENTRY(TABLE_KEYED_SETTER, Variant::get_member_validated_keyed_setter(vtype), type);
+		ADD_TABLE_ENTRY(TABLE_KEYED_GETTER, Variant::get_member_validated_keyed_getter(vtype), type);
+		ADD_TABLE_ENTRY(TABLE_INDEXED_SETTER, Variant::get_member_validated_indexed_setter(vtype), type);
+		ADD_TABLE_ENTRY(TABLE_INDEXED_GETTER, Variant::get_member_validated_indexed_getter(vtype), type);
+
+		List<StringName> methods;
+		Variant::get_builtin_method_list(vtype, &methods);
+		for (const StringName &method : methods) {
+			Array key = { type, method };
+			ADD_TABLE_ENTRY(TABLE_BUILTIN_METHOD, Variant::get_validated_builtin_method(vtype, method), key);
+		}
+
+		for (int i = 0; i < Variant::get_constructor_count(vtype); i++) {
+			ADD_TABLE_ENTRY(TABLE_CONSTRUCTOR, Variant::get_validated_constructor(vtype, i), Vector2i(type, i));
+		}
+	}
+
+	List<StringName> utilities;
+	Variant::get_utility_function_list(&utilities);
+	for (const StringName &utility : utilities) {
+		ADD_TABLE_ENTRY(TABLE_UTILITY, Variant::get_validated_utility_function(utility), utility);
+	}
+
+	List<StringName> gds_utilities;
+	GDScriptUtilityFunctions::get_function_list(&gds_utilities);
+	for (const StringName &utility : gds_utilities) {
+		ADD_TABLE_ENTRY(TABLE_GDS_UTILITY, GDScriptUtilityFunctions::get_function(utility), utility);
+	}
+
+#undef ADD_TABLE_ENTRY
+
+	reverse_tables_built = true;
+}
+
+void *GDScriptBytecodeCache::_resolve_table_key(TableKind p_kind, const Variant &p_key) {
+	switch (p_kind) {
+		case TABLE_OPERATOR: {
+			const Vector3i key = p_key;
+			return reinterpret_cast<void *>(Variant::get_validated_operator_evaluator(Variant::Operator(key.x), Variant::Type(key.y), Variant::Type(key.z)));
+		}
+		case TABLE_SETTER: {
+			const Array key = p_key;
+			return reinterpret_cast<void *>(Variant::get_member_validated_setter(Variant::Type(int(key[0])), key[1]));
+		}
+		case TABLE_GETTER: {
+			const Array key = p_key;
+			return reinterpret_cast<void *>(Variant::get_member_validated_getter(Variant::Type(int(key[0])), key[1]));
+		}
+		case TABLE_KEYED_SETTER:
+			return reinterpret_cast<void *>(Variant::get_member_validated_keyed_setter(Variant::Type(int(p_key))));
+		case TABLE_KEYED_GETTER:
+			return reinterpret_cast<void *>(Variant::get_member_validated_keyed_getter(Variant::Type(int(p_key))));
+		case TABLE_INDEXED_SETTER:
+			return reinterpret_cast<void *>(Variant::get_member_validated_indexed_setter(Variant::Type(int(p_key))));
+		case TABLE_INDEXED_GETTER:
+			return reinterpret_cast<void *>(Variant::get_member_validated_indexed_getter(Variant::Type(int(p_key))));
+		case TABLE_BUILTIN_METHOD: {
+			const Array key = p_key;
+			return reinterpret_cast<void *>(Variant::get_validated_builtin_method(Variant::Type(int(key[0])), key[1]));
+		}
+		case TABLE_CONSTRUCTOR: {
+			const Vector2i key = p_key;
+			if (key.y < 0 || key.y >= Variant::get_constructor_count(Variant::Type(key.x))) {
+				return nullptr;
+			}
+			return reinterpret_cast<void *>(Variant::get_validated_constructor(Variant::Type(key.x), key.y));
+		}
+		case TABLE_UTILITY:
+			return reinterpret_cast<void *>(Variant::get_validated_utility_function(p_key));
+		case TABLE_GDS_UTILITY:
+			return reinterpret_cast<void *>(GDScriptUtilityFunctions::get_function(p_key));
+		case TABLE_MAX:
+			break;
+	}
+	return nullptr;
+}
+
+template <typename T>
+bool GDScriptBytecodeCache::_encode_table(TableKind p_kind, const Vector<T> &p_table, Array &r_keys) {
+	for (const T &ptr : p_table) {
+		const Variant *key = reverse_tables[p_kind].getptr(TABLE_PTR_KEY(ptr));
+		if (!key) {
+			return false;
+		}
+		r_keys.push_back(*key);
+	}
+	return true;
+}
+
+template <typename T>
+bool GDScriptBytecodeCache::_decode_table(TableKind p_kind, const Array &p_keys, Vector<T> &r_table) {
+	r_table.resize(p_keys.size());
+	for (int i = 0; i < p_keys.size(); i++) {
+		void *ptr = _resolve_table_key(p_kind, p_keys[i]);
+		if (!ptr) {
+			return false;
+		}
+		r_table.write[i] = reinterpret_cast<T>(ptr);
+	}
+	return true;
+}
+
+bool GDScriptBytecodeCache::_is_plain_value(const Variant &p_value) {
+	switch (p_value.get_type()) {
+		case Variant::OBJECT:
+		case Variant::CALLABLE:
+		case Variant::SIGNAL:
+		case Variant::RID:
+			return false;
+		case Variant::ARRAY: {
+			const Array array = p_value;
+			if (array.get_typed_script().get_type() != Variant::NIL) {
+				return false;
+			}
+			for (const Variant &element : array) {
+				if (!_is_plain_value(element)) {
+					return false;
+				}
+			}
+			return true;
+		}
+		case Variant::DICTIONARY: {
+			const Dictionary dict = p_value;
+			if (dict.get_typed_key_script().get_type() != Variant::NIL || dict.get_typed_value_script().get_type() != Variant::NIL) {
+				return false;
+			}
+			for (const KeyValue<Variant, Variant> &kv : dict) {
+				if (!_is_plain_value(kv.key) || !_is_plain_value(kv.value)) {
+					return false;
+				}
+			}
+			return true;
+		}
+		default:
+			return true;
+	}
+}
+
+bool GDScriptBytecodeCache::_encode_script(Script *p_script, Array &r_encoded) const {
+	GDScript *gdscript = Object::cast_to<GDScript>(p_script);
+	if (gdscript) {
+		const String &root_path = gdscript->get_root_script()->path;
+		if (!root_path.begins_with("res://") || root_path.contains("::")) {
+			return false; // Built-in scripts can't be looked up by path.
+		}
+		r_encoded.push_back(true);
+		r_encoded.push_back(root_path);
+		r_encoded.push_back(gdscript->fully_qualified_name);
+		return true;
+	}
+
+	const String path = p_script->get_path();
+	if (!path.begins_with("res://") || p_script->is_built_in()) {
+		return false;
+	}
+	r_encoded.push_back(false);
+	r_encoded.push_back(path);
+	return true;
+}
+
+Ref<Script> GDScriptBytecodeCache::_decode_script(const Array &p_encoded, bool &r_is_local) const {
+	ERR_FAIL_COND_V(p_encoded.size() < 2, Ref<Script>());
+
+	const String path = p_encoded[1];
+	r_is_local = false;
+
+	if (!bool(p_encoded[0])) {
+		return ResourceLoader::load(path);
+	}
+
+	ERR_FAIL_COND_V(p_encoded.size() < 3, Ref<Script>());
+
+	Ref<GDScript> root;
+	if (path == main_script->path) {
+		root = Ref<GDScript>(main_script);
+		r_is_local = true;
+	} else {
+		Error err = OK;
+		root = GDScriptCache::get_shallow_script(path, err, main_script->path);
+		if (err != OK) {
+			return Ref<Script>();
+		}
+	}
+
+	if (root.is_null()) {
+		return Ref<Script>();
+	}
+	return Ref<Script>(root->find_class(p_encoded[2]));
+}
+
+bool GDScriptBytecodeCache::_encode_constant(const Variant &p_value, Array &r_encoded) const {
+	if (p_value.get_type() != Variant::OBJECT) {
+		if (!_is_plain_value(p_value)) {
+			return false;
+		}
+		r_encoded.push_back(CONSTANT_VALUE);
+		r_encoded.push_back(p_value);
+		return true;
+	}
+
+	Object *obj = p_value.get_validated_object();
+	if (!obj) {
+		return false;
+	}
+
+	Script *script = Object::cast_to<Script>(obj);
+	if (script) {
+		Array encoded_script;
+		if (_encode_script(script, encoded_script)) {
+			r_encoded.push_back(CONSTANT_SCRIPT);
+			r_encoded.push_back(encoded_script);
+			return true;
+		}
+		return false;
+	}
+
+	// Native classes and engine singletons are taken from the global map.
+	GDScriptLanguage *language = GDScriptLanguage::get_singleton();
+	for (const KeyValue<StringName, int> &E : language->get_global_map()) {
+		const Variant &global = language->get_global_array()[E.value];
+		if (global.get_type() == Variant::OBJECT && global.get_validated_object() == obj) {
+			r_encoded.push_back(CONSTANT_GLOBAL);
+			r_encoded.push_back(E.key);
+			return true;
+		}
+	}
+
+	// Preloaded resources.
+	const Resource *res = Object::cast_to<Resource>(obj);
+	if (res && res->get_path().begins_with("res://") && !res->is_built_in()) {
+		r_encoded.push_back(CONSTANT_RESOURCE);
+		r_encoded.push_back(res->get_path());
+		return true;
+	}
+
+	return false;
+}
+
+bool GDScriptBytecodeCache::_decode_constant(const Array &p_encoded, Variant &r_value) const {
+	ERR_FAIL_COND_V(p_encoded.size() != 2, false);
+
+	switch (int(p_encoded[0])) {
+		case CONSTANT_VALUE: {
+			r_value = p_encoded[1];
+			return true;
+		}
+		case CONSTANT_GLOBAL: {
+			GDScriptLanguage *language = GDScriptLanguage::get_singleton();
+			const int *idx = language->get_global_map().getptr(p_encoded[1]);
+			if (!idx) {
+				return false;
+			}
+			r_value = language->get_global_array()[*idx];
+			return true;
+		}
+		case CONSTANT_SCRIPT: {
+			bool is_local = false;
+			Ref<Script> script = _decode_script(p_encoded[1], is_local);
+			if (script.is_null()) {
+				return false;
+			}
+			r_value = script;
+			return true;
+		}
+		case CONSTANT_RESOURCE: {
+			Ref<Resource> res = ResourceLoader::load(p_encoded[1]);
+			if (res.is_null()) {
+				return false;
+			}
+			r_value = res;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool GDScriptBytecodeCache::_encode_data_type(const GDScriptDataType &p_type, Array &r_encoded) const {
+	r_encoded.push_back(p_type.kind);
+	r_encoded.push_back(p_type.builtin_type);
+	r_encoded.push_back(p_type.native_type);
+
+	Array script;
+	if (p_type.script_type && !_encode_script(p_type.script_type, script)) {
+		return false;
+	}
+	r_encoded.push_back(script);
+
+	Array element_types;
+	for (const GDScriptDataType &element_type : p_type.container_element_types) {
+		Array encoded_element;
+		if (!_encode_data_type(element_type, encoded_element)) {
+			return false;
+		}
+		element_types.push_back(encoded_element);
+	}
+	r_encoded.push_back(element_types);
+	return true;
+}
+
+bool GDScriptBytecodeCache::_decode_data_type(const Array &p_encoded, GDScriptDataType &r_type) const {
+	ERR_FAIL_COND_V(p_encoded.size() != 5, false);
+
+	r_type.kind = GDScriptDataType::Kind(int(p_encoded[0]));
+	r_type.builtin_type = Variant::Type(int(p_encoded[1]));
+	r_type.native_type = p_encoded[2];
+
+	const Array script = p_encoded[3];
+	if (!script.is_empty()) {
+		bool is_local = false;
+		Ref<Script> script_type = _decode_script(script, is_local);
+		if (script_type.is_null()) {
+			return false;
+		}
+		r_type.script_type = script_type.ptr();
+		// Same as the compiler: don't hold a strong reference to classes of the script itself, to avoid cycles.
+		if (r_type.kind != GDScriptDataType::GDSCRIPT || !is_local) {
+			r_type.script_type_ref = script_type;
+		}
+	}
+
+	const Array element_types = p_encoded[4];
+	for (int i = 0; i < element_types.size(); i++) {
+		GDScriptDataType element_type;
+		if (!_decode_data_type(element_types[i], element_type)) {
+			return false;
+		}
+		r_type.set_container_element_type(i, element_type);
+	}
+	return true;
+}
+
+bool GDScriptBytecodeCache::_encode_function(const GDScriptFunction *p_function, Dictionary &r_encoded) const {
+	const Dictionary method_info = p_function->method_info;
+	if (!_is_plain_value(method_info) || !_is_plain_value(p_function->rpc_config)) {
+		return false;
+	}
+
+	r_encoded["name"] = p_function->name;
+	r_encoded["static"] = p_function->_static;
+	r_encoded["initial_line"] = p_function->_initial_line;
+	r_encoded["argument_count"] = p_function->_argument_count;
+	r_encoded["vararg_index"] = p_function->_vararg_index;
+	r_encoded["stack_size"] = p_function->_stack_size;
+	r_encoded["instruction_args_size"] = p_function->_instruction_args_size;
+	r_encoded["method_info"] = method_info;
+	r_encoded["rpc_config"] = p_function->rpc_config;
+
+	Array argument_types;
+	for (const GDScriptDataType &argument_type : p_function->argument_types) {
+		Array encoded_type;
+		if (!_encode_data_type(argument_type, encoded_type)) {
+			return false;
+		}
+		argument_types.push_back(encoded_type);
+	}
+	r_encoded["argument_types"] = argument_types;
+
+	Array return_type;
+	if (!_encode_data_type(p_function->return_type, return_type)) {
+		return false;
+	}
+	r_encoded["return_type"] = return_type;
+
+	r_encoded["code"] = PackedInt32Array(p_function->code);
+	r_encoded["default_arguments"] = PackedInt32Array(p_function->default_arguments);
+
+	PackedInt32Array temporary_slots;
+	for (const Pair<int, Variant::Type> &slot : p_function->temporary_slots) {
+		temporary_slots.push_back(slot.first);
+		temporary_slots.push_back(slot.second);
+	}
+	r_encoded["temporary_slots"] = temporary_slots;
+
+	Array constants;
+	for (const Variant &constant : p_function->constants) {
+		Array encoded_constant;
+		if (!_encode_constant(constant, encoded_constant)) {
+			return false;
+		}
+		constants.push_back(encoded_constant);
+	}
+	r_encoded["constants"] = constants;
+
+	// Local constants are copies of entries in the constant table, store their index.
+	Dictionary constant_map;
+	for (const KeyValue<StringName, Variant> &E : p_function->constant_map) {
+		int index = p_function->constants.find(E.value);
+		if (index < 0) {
+			return false;
+		}
+		constant_map[E.key] = index;
+	}
+	r_encoded["constant_map"] = constant_map;
+
+	PackedStringArray global_names;
+	for (const StringName &global_name : p_function->global_names) {
+		global_names.push_back(global_name);
+	}
+	r_encoded["global_names"] = global_names;
+
+	Array operator_funcs, setters, getters, keyed_setters, keyed_getters, indexed_setters, indexed_getters;
+	Array builtin_methods, constructors, utilities, gds_utilities;
+	if (!_encode_table(TABLE_OPERATOR, p_function->operator_funcs, operator_funcs) ||
+			!_encode_table(TABLE_SETTER, p_function->setters, setters) ||
+			!_encode_table(TABLE_GETTER, p_function->getters, getters) ||
+			!_encode_table(TABLE_KEYED_SETTER, p_function->keyed_setters, keyed_setters) ||
+			!_encode_table(TABLE_KEYED_GETTER, p_function->keyed_getters, keyed_getters) ||
+			!_encode_table(TABLE_INDEXED_SETTER, p_function->indexed_setters, indexed_setters) ||
+			!_encode_table(TABLE_INDEXED_GETTER, p_function->indexed_getters, indexed_getters) ||
+			!_encode_table(TABLE_BUILTIN_METHOD, p_function->builtin_methods, builtin_methods) ||
+			!_encode_table(TABLE_CONSTRUCTOR, p_function->constructors, constructors) ||
+			!_encode_table(TABLE_UTILITY, p_function->utilities, utilities) ||
+			!_encode_table(TABLE_GDS_UTILITY, p_function->gds_utilities, gds_utilities)) {
+		return false;
+	}
+	r_encoded["operator_funcs"] = operator_funcs;
+	r_encoded["setters"] = setters;
+	r_encoded["getters"] = getters;
+	r_encoded["keyed_setters"] = keyed_setters;
+	r_encoded["keyed_getters"] = keyed_getters;
+	r_encoded["indexed_setters"] = indexed_setters;
+	r_encoded["indexed_getters"] = indexed_getters;
+	r_encoded["builtin_methods"] = builtin_methods;
+	r_encoded["constructors"] = constructors;
+	r_encoded["utilities"] = utilities;
+	r_encoded["gds_utilities"] = gds_utilities;
+
+	Array methods;
+	for (const MethodBind *method : p_function->methods) {
+		Array key = { method->get_instance_class(), method->get_name() };
+		methods.push_back(key);
+	}
+	r_encoded["methods"] = methods;
+
+	Array lambdas;
+	for (const GDScriptFunction *lambda : p_function->lambdas) {
+		const GDScript::LambdaInfo *lambda_info = p_function->_script->lambda_info.getptr(const_cast<GDScriptFunction *>(lambda));
+		if (!lambda_info) {
+			return false;
+		}
+		Dictionary encoded_lambda;
+		if (!_encode_function(lambda, encoded_lambda)) {
+			return false;
+		}
+		encoded_lambda["capture_count"] = lambda_info->capture_count;
+		encoded_lambda["use_self"] = lambda_info->use_self;
+		lambdas.push_back(encoded_lambda);
+	}
+	r_encoded["lambdas"] = lambdas;
+
+	return true;
+}
+
+void GDScriptBytecodeCache::_discard_decoded_function(GDScriptFunction *p_function, GDScript *p_script) {
+	// Lambdas are deleted along with their parent, but they were already registered in the script.
+	for (GDScriptFunction *lambda : p_function->lambdas) {
+		p_script->lambda_info.erase(lambda);
+	}
+	memdelete(p_function);
+}
+
+GDScriptFunction *GDScriptBytecodeCache::_decode_function(const Dictionary &p_encoded, GDScript *p_script) const {
+	GDScriptFunction *function = memnew(GDScriptFunction);
+	// The name is set last, since deleting the function removes its name from the script members.
+	function->_script = p_script;
+	function->source = p_script->get_script_path();
+
+	function->_static = p_encoded["static"];
+	function->_initial_line = p_encoded["initial_line"];
+	function->_argument_count = p_encoded["argument_count"];
+	function->_vararg_index = p_encoded["vararg_index"];
+	function->_stack_size = p_encoded["stack_size"];
+	function->_instruction_args_size = p_encoded["instruction_args_size"];
+	function->method_info = MethodInfo::from_dict(p_encoded["method_info"]);
+	function->rpc_config = p_encoded["rpc_config"];
+
+	bool valid = true;
+
+	const Array argument_types = p_encoded["argument_types"];
+	function->argument_types.resize(argument_types.size());
+	for (int i = 0; valid && i < argument_types.size(); i++) {
+		valid = _decode_data_type(argument_types[i], function->argument_types.write[i]);
+	}
+	valid = valid && _decode_data_type(p_encoded["return_type"], function->return_type);
+
+	function->code = PackedInt32Array(p_encoded["code"]);
+	function->default_arguments = PackedInt32Array(p_encoded["default_arguments"]);
+
+	const PackedInt32Array temporary_slots = p_encoded["temporary_slots"];
+	for (int i = 0; i + 1 < temporary_slots.size(); i += 2) {
+		function->temporary_slots.push_back(Pair(temporary_slots[i], Variant::Type(temporary_slots[i + 1])));
+	}
+
+	const Array constants = p_encoded["constants"];
+	function->constants.resize(constants.size());
+	for (int i = 0; valid && i < constants.size(); i++) {
+		valid = _decode_constant(constants[i], function->constants.write[i]);
+	}
+
+	const Dictionary constant_map = p_encoded["constant_map"];
+	for (const KeyValue<Variant, Variant> &kv : constant_map) {
+		int index = kv.value;
+		if (!valid || index < 0 || index >= function->constants.size()) {
+			valid = false;
+			break;
+		}
+		function->constant_map.insert(kv.key, function->constants[index]);
+	}
+
+	const PackedStringArray global_names = p_encoded["global_names"];
+	for (const String &global_name : global_names) {
+		function->global_names.push_back(global_name);
+	}
+
+	valid = valid &&
+			_decode_table(TABLE_OPERATOR, p_encoded["operator_funcs"], function->operator_funcs) &&
+			_decode_table(TABLE_SETTER, p_encoded["setters"], function->setters) &&
+			_decode_table(TABLE_GETTER, p_encoded["getters"], function->getters) &&
+			_decode_table(TABLE_KEYED_SETTER, p_encoded["keyed_setters"], function->keyed_setters) &&
+			_decode_table(TABLE_KEYED_GETTER, p_encoded["keyed_getters"], function->keyed_getters) &&
+			_decode_table(TABLE_INDEXED_SETTER, p_encoded["indexed_setters"], function->indexed_setters) &&
+			_decode_table(TABLE_INDEXED_GETTER, p_encoded["indexed_getters"], function->indexed_getters) &&
+			_decode_table(TABLE_BUILTIN_METHOD, p_encoded["builtin_methods"], function->builtin_methods) &&
+			_decode_table(TABLE_CONSTRUCTOR, p_encoded["constructors"], function->constructors) &&
+			_decode_table(TABLE_UTILITY, p_encoded["utilities"], function->utilities) &&
+			_decode_table(TABLE_GDS_UTILITY, p_encoded["gds_utilities"], function->gds_utilities);
+
+	const Array methods = p_encoded["methods"];
+	for (int i = 0; valid && i < methods.size(); i++) {
+		const Array key = methods[i];
+		MethodBind *method = key.size() == 2 ? ClassDB::get_method(key[0], key[1]) : nullptr;
+		if (!method) {
+			valid = false;
+			break;
+		}
+		function->methods.push_back(method);
+	}
+
+	const Array lambdas = p_encoded["lambdas"];
+	for (int i = 0; valid && i < lambdas.size(); i++) {
+		const Dictionary encoded_lambda = lambdas[i];
+		GDScriptFunction *lambda = _decode_function(encoded_lambda, p_script);
+		if (!lambda) {
+			valid = false;
+			break;
+		}
+		function->lambdas.push_back(lambda);
+		p_script->lambda_info.insert(lambda, { int(encoded_lambda["capture_count"]), bool(encoded_lambda["use_self"]) });
+	}
+
+	if (!valid) {
+		_discard_decoded_function(function, p_script);
+		return nullptr;
+	}
+
+	function->name = p_encoded["name"];
+#ifdef DEBUG_ENABLED
+	function->func_cname = (String(function->source) + " - " + String(function->name)).utf8();
+	function->_func_cname = function->func_cname.get_data();
+	for (const Variant &key : Array(p_encoded["gds_utilities"])) {
+		function->gds_utilities_names.push_back(key);
+	}
+#endif
+
+	// Point the VM at the tables, same as the code generator does.
+	function->_code_ptr = function->code.is_empty() ? nullptr : function->code.ptrw();
+	function->_code_size = function->code.size();
+	function->_default_arg_count = MAX(0, function->default_arguments.size() - 1);
+	function->_default_arg_ptr = function->default_arguments.is_empty() ? nullptr : function->default_arguments.ptr();
+	function->_constant_count = function->constants.size();
+	function->_constants_ptr = function->constants.is_empty() ? nullptr : function->constants.ptrw();
+	function->_global_names_count = function->global_names.size();
+	function->_global_names_ptr = function->global_names.is_empty() ? nullptr : function->global_names.ptr();
+	function->_operator_funcs_count = function->operator_funcs.size();
+	function->_operator_funcs_ptr = function->operator_funcs.is_empty() ? nullptr : function->operator_funcs.ptr();
+	function->_setters_count = function->setters.size();
+	function->_setters_ptr = function->setters.is_empty() ? nullptr : function->setters.ptr();
+	function->_getters_count = function->getters.size();
+	function->_getters_ptr = function->getters.is_empty() ? nullptr : function->getters.ptr();
+	function->_keyed_setters_count = function->keyed_setters.size();
+	function->_keyed_setters_ptr = function->keyed_setters.is_empty() ? nullptr : function->keyed_setters.ptr();
+	function->_keyed_getters_count = function->keyed_getters.size();
+	function->_keyed_getters_ptr = function->keyed_getters.is_empty() ? nullptr : function->keyed_getters.ptr();
+	function->_indexed_setters_count = function->indexed_setters.size();
+	function->_indexed_setters_ptr = function->indexed_setters.is_empty() ? nullptr : function->indexed_setters.ptr();
+	function->_indexed_getters_count = function->indexed_getters.size();
+	function->_indexed_getters_ptr = function->indexed_getters.is_empty() ? nullptr : function->indexed_getters.ptr();
+	function->_builtin_methods_count = function->builtin_methods.size();
+	function->_builtin_methods_ptr = function->builtin_methods.is_empty() ? nullptr : function->builtin_methods.ptr();
+	function->_constructors_count = function->constructors.size();
+	function->_constructors_ptr = function->constructors.is_empty() ? nullptr : function->constructors.ptr();
+	function->_utilities_count = function->utilities.size();
+	function->_utilities_ptr = function->utilities.is_empty() ? nullptr : function->utilities.ptr();
+	function->_gds_utilities_count = function->gds_utilities.size();
+	function->_gds_utilities_ptr = function->gds_utilities.is_empty() ? nullptr : function->gds_utilities.ptr();
+	function->_methods_count = function->methods.size();
+	function->_methods_ptr = function->methods.is_empty() ? nullptr : function->methods.ptrw();
+	function->_lambdas_count = function->lambdas.size();
+	function->_lambdas_ptr = function->lambdas.is_empty() ? nullptr : function->lambdas.ptrw();
+
+	return function;
+}
+
+String GDScriptBytecodeCache::_get_function_key(const GDScript *p_script, const StringName &p_name) {
+	return p_script->fully_qualified_name + "::" + String(p_name);
+}
+
+bool GDScriptBytecodeCache::open(GDScript *p_main_script) {
+	if (!enabled || !p_main_script->path.begins_with("res://") || p_main_script->path.contains("::")) {
+		return false;
+	}
+	// Local variable tracking and profiling signatures are only filled by the code generator.
+	if (GDScriptLanguage::get_singleton()->should_track_locals() || EngineDebugger::is_active()) {
+		return false;
+	}
+
+	main_script = p_main_script;
+	cache_path = cache_dir.path_join(main_script->path.md5_text() + ".gdbc");
+
+	uint32_t source_hash;
+	if (!main_script->binary_tokens.is_empty()) {
+		source_hash = hash_murmur3_buffer(main_script->binary_tokens.ptr(), main_script->binary_tokens.size());
+	} else {
+		source_hash = main_script->source.hash();
+	}
+
+	// Indices into the global array are embedded in the bytecode (e.g. for autoloads).
+	uint32_t globals_hash = 0;
+	for (const KeyValue<StringName, int> &E : GDScriptLanguage::get_singleton()->get_global_map()) {
+		globals_hash += hash_murmur3_one_32(E.value, E.key.hash());
+	}
+	fingerprint = hash_murmur3_one_32(globals_hash, source_hash);
+
+	Ref<FileAccess> f = FileAccess::open(cache_path, FileAccess::READ);
+	if (f.is_null()) {
+		return true;
+	}
+
+	uint8_t magic[4] = {};
+	f->get_buffer(magic, 4);
+	if (memcmp(magic, BYTECODE_CACHE_MAGIC, 4) != 0 || f->get_32() != FORMAT_VERSION || f->get_pascal_string() != build_key || f->get_32() != fingerprint) {
+		return true; // Stale, it will be overwritten.
+	}
+
+	const Dictionary functions = f->get_var();
+	for (const KeyValue<Variant, Variant> &kv : functions) {
+		cached_functions.insert(kv.key, kv.value);
+	}
+	return true;
+}
+
+GDScriptFunction *GDScriptBytecodeCache::get_function(GDScript *p_script, const StringName &p_name) const {
+	const Dictionary *encoded = cached_functions.getptr(_get_function_key(p_script, p_name));
+	if (!encoded) {
+		return nullptr;
+	}
+	return _decode_function(*encoded, p_script);
+}
+
+void GDScriptBytecodeCache::store_function(GDScript *p_script, const GDScriptFunction *p_function) {
+	_build_reverse_tables();
+
+	// Functions that reference something which can't be looked up again
+	// (e.g. built-in resources) are simply compiled on every run.
+	Dictionary encoded;
+	if (_encode_function(p_function, encoded)) {
+		new_functions[_get_function_key(p_script, p_function->name)] = encoded;
+	}
+}
+
+void GDScriptBytecodeCache::save() {
+	if (new_functions.is_empty()) {
+		return;
+	}
+
+	Dictionary functions = new_functions;
+	for (const KeyValue<String, Dictionary> &E : cached_functions) {
+		if (!functions.has(E.key)) {
+			functions[E.key] = E.value;
+		}
+	}
+
+	Ref<FileAccess> f = FileAccess::open(cache_path, FileAccess::WRITE);
+	ERR_FAIL_COND_MSG(f.is_null(), "Can't write GDScript bytecode cache file: " + cache_path);
+
+	f->store_buffer((const uint8_t *)BYTECODE_CACHE_MAGIC, 4);
+	f->store_32(FORMAT_VERSION);
+	f->store_pascal_string(build_key);
+	f->store_32(fingerprint);
+	f->store_var(functions);
+}
@@ -0,0 +1,124 @@
+/**************************************************************************/
+/*  gdscript_bytecode_cache.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "gdscript_function.h"
+
+#include "core/templates/hash_map.h"
+#include "core/variant/dictionary.h"
+
+class GDScript;
+
+namespace GDScriptTests {
+class TestGDScriptBytecodeCacheAccessor;
+}
+
+// Keeps the bytecode of compiled functions across runs of an exported project,
+// so scripts that haven't changed since the last launch skip code generation.
+// The cache is filled by the export template itself (in `user://`), since the
+// generated bytecode depends on the build flags of the running engine.
+class GDScriptBytecodeCache {
+	static constexpr uint32_t FORMAT_VERSION = 1;
+
+	enum TableKind {
+		TABLE_OPERATOR,
+		TABLE_SETTER,
+		TABLE_GETTER,
+		TABLE_KEYED_SETTER,
+		TABLE_KEYED_GETTER,
+		TABLE_INDEXED_SETTER,
+		TABLE_INDEXED_GETTER,
+		TABLE_BUILTIN_METHOD,
+		TABLE_CONSTRUCTOR,
+		TABLE_UTILITY,
+		TABLE_GDS_UTILITY,
+		TABLE_MAX,
+	};
+
+	enum ConstantKind {
+		CONSTANT_VALUE,
+		CONSTANT_GLOBAL,
+		CONSTANT_SCRIPT,
+		CONSTANT_RESOURCE,
+	};
+
+	static bool enabled;
+	static String build_key;
+	static String cache_dir;
+
+	// Maps the function pointers stored in the bytecode tables back to the
+	// keys used to look them up, so they can be resolved again on load.
+	static Mutex reverse_tables_mutex;
+	static bool reverse_tables_built;
+	static HashMap<uintptr_t, Variant> reverse_tables[TABLE_MAX];
+	static void _build_reverse_tables();
+
+	GDScript *main_script = nullptr;
+	String cache_path;
+	uint32_t fingerprint = 0;
+	HashMap<String, Dictionary> cached_functions;
+	Dictionary new_functions;
+
+	static bool _is_plain_value(const Variant &p_value);
+	static void *_resolve_table_key(TableKind p_kind, const Variant &p_key);
+
+	template <typename T>
+	static bool _encode_table(TableKind p_kind, const Vector<T> &p_table, Array &r_keys);
+	template <typename T>
+	static bool _decode_table(TableKind p_kind, const Array &p_keys, Vector<T> &r_table);
+
+	bool _encode_script(Script *p_script, Array &r_encoded) const;
+	Ref<Script> _decode_script(const Array &p_encoded, bool &r_is_local) const;
+	bool _encode_constant(const Variant &p_value, Array &r_encoded) const;
+	bool _decode_constant(const Array &p_encoded, Variant &r_value) const;
+	bool _encode_data_type(const GDScriptDataType &p_type, Array &r_encoded) const;
+	bool _decode_data_type(const Array &p_encoded, GDScriptDataType &r_type) const;
+	bool _encode_function(const GDScriptFunction *p_function, Dictionary &r_encoded) const;
+	GDScriptFunction *_decode_function(const Dictionary &p_encoded, GDScript *p_script) const;
+	static void _discard_decoded_function(GDScriptFunction *p_function, GDScript *p_script);
+
+	static String _get_function_key(const GDScript *p_script, const StringName &p_name);
+
+	friend class GDScriptTests::TestGDScriptBytecodeCacheAccessor;
+
+public:
+	// Written by the export plugin when the cache is enabled for a preset.
+	// Its contents change on every export, invalidating previous caches.
+	static constexpr const char *EXPORT_ID_PATH = "res://.godot/gdscript_bytecode_cache.id";
+
+	static void initialize();
+	_FORCE_INLINE_ static bool is_enabled() { return enabled; }
+
+	bool open(GDScript *p_main_script);
+	GDScriptFunction *get_function(GDScript *p_script, const StringName &p_name) const;
+	void store_function(GDScript *p_script, const GDScriptFunction *p_function);
+	void save();
+};
@@ -2319,6 +2319,28 @@ GDScriptFunction *GDScriptCompiler::_parse_function(Error &r_error, GDScript *p_
 		}
 	}
 
+	if (use_bytecode_cache && !p_for_lambda) {
+		// Reuse the bytecode from a previous run, lambdas are stored along with their parent function.
+		GDScriptFunction *cached_function = bytecode_cache.get_function(p_script, func_name);
+		if (cached_function) {
+			memdelete(codegen.generator);
+
+			if (!p_func) {
+				if (p_for_ready) {
+					p_script->implicit_ready = cached_function;
+				} else {
+					p_script->implicit_initializer = cached_function;
+				}
+			} else {
+				if (func_name == GDScriptLanguage::get_singleton()->strings._init) {
+					p_script->initializer = cached_function;
+				}
+				p_script->member_functions[func_name] = cached_function;
+			}
+			return cached_function;
+		}
+	}
+
 	MethodInfo method_info;
 
 	codegen.function_name = func_name;
@@ -2524,6 +2546,10 @@ GDScriptFunction *GDScriptCompiler::_parse_function(Error &r_error, GDScript *p_
 		p_script->member_functions[func_name] = gd_function;
 	}
 
+	if (use_bytecode_cache && !p_for_lambda) {
+		bytecode_cache.store_function(p_script, gd_function);
+	}
+
 	memdelete(codegen.generator);
 
 	return gd_function;
@@ -2544,6 +2570,14 @@ GDScriptFunction *GDScriptCompiler::_make_static_initializer(Error &r_error, GDS
 	return_type.kind = GDScriptDataType::BUILTIN;
 	return_type.builtin_type = Variant::NIL;
 
+	if (use_bytecode_cache) {
+		GDScriptFunction *cached_function = bytecode_cache.get_function(p_script, func_name);
+		if (cached_function) {
+			memdelete(codegen.generator);
+			return cached_function;
+		}
+	}
+
 	codegen.function_name = func_name;
 	codegen.is_static = is_static;
 	codegen.generator->write_start(p_script, func_name, is_static, rpc_config, return_type);
@@ -2657,6 +2691,10 @@ GDScriptFunction *GDScriptCompiler::_make_static_initializer(Error &r_error, GDS
 
 	GDScriptFunction *gd_function = codegen.generator->write_end();
 
+	if (use_bytecode_cache) {
+		bytecode_cache.store_function(p_script, gd_function);
+	}
+
 	memdelete(codegen.generator);
 
 	return gd_function;
@@ -3289,6 +3327,9 @@ Error GDScriptCompiler::compile(const GDScriptParser *p_parser, GDScript *p_scri
 
 	source = p_script->get_path();
 
+	// Hot-reloading keeps state the cached bytecode doesn't know about.
+	use_bytecode_cache = !p_keep_state && GDScriptBytecodeCache::is_enabled() && bytecode_cache.open(p_script);
+
 	ScriptLambdaInfo old_lambda_info = _get_script_lambda_replacement_info(p_script);
 
 	// Create scripts for subclasses beforehand so they can be referenced
@@ -3316,6 +3357,10 @@ Error GDScriptCompiler::compile(const GDScriptParser *p_parser, GDScript *p_scri
 		GDScriptCache::add_static_script(p_script);
 	}
 
+	if (use_bytecode_cache) {
+		bytecode_cache.save();
+	}
+
 	err = GDScriptCache::finish_compiling(main_script->path);
 	if (err) {
 		_set_error(R"(Failed to compile depended scripts.)", nullptr);
@@ -31,6 +31,7 @@
 #pragma once
 
 #include "gdscript.h"
+#include "gdscript_bytecode_cache.h"
 #include "gdscript_codegen.h"
 #include "gdscript_function.h"
 #include "gdscript_parser.h"
@@ -43,6 +44,9 @@ class GDScriptCompiler {
 	HashSet<GDScript *> parsing_classes;
 	GDScript *main_script = nullptr;
 
+	GDScriptBytecodeCache bytecode_cache;
+	bool use_bytecode_cache = false;
+
 	struct FunctionLambdaInfo {
 		GDScriptFunction *function = nullptr;
 		GDScriptFunction *parent = nullptr;
@@ -253,36 +253,70 @@ GDScriptFunction::~GDScriptFunction() {
 
 /////////////////////
 
-Variant GDScriptFunctionState::_signal_callback(const Variant **p_args, int p_argcount, Callable::CallError &r_error) {
-	Variant arg;
-	r_error.error = Callable::CallError::CALL_OK;
-
-	if (p_argcount == 0) {
-		r_error.error = Callable::CallError::CALL_ERROR_TOO_FEW_ARGUMENTS;
-		r_error.expected = 1;
-		return Variant();
-	} else if (p_argcount == 1) {
-		//noooneee
-	} else if (p_argcount == 2) {
-		arg = *p_args[0];
-	} else {
-		Array extra_args;
-		for (int i = 0; i < p_argcount - 1; i++) {
-			extra_args.push_back(*p_args[i]);
-		}
-		arg = extra_args;
+// Connected to the awaited signal to resume the suspended function. Unlike a method callable bound
+// to the state, calling it does not need to look up a method by name nor to copy the bound arguments.
+class GDScriptFunctionStateResumeCallable : public CallableCustom {
+	Ref<GDScriptFunctionState> state;
+	ObjectID state_id;
+
+	static bool compare_equal(const CallableCustom *p_a, const CallableCustom *p_b) {
+		return p_a == p_b;
+	}
+
+	static bool compare_less(const CallableCustom *p_a, const CallableCustom *p_b) {
+		return p_a < p_b;
+	}
+
+public:
+	uint32_t hash() const override {
+		return hash_murmur3_one_64((uint64_t)state_id);
+	}
+
+	String get_as_text() const override {
+		return "GDScriptFunctionState::resume";
+	}
+
+	CompareEqualFunc get_compare_equal_func() const override {
+		return compare_equal;
 	}
 
-	Ref<GDScriptFunctionState> self = *p_args[p_argcount - 1];
+	CompareLessFunc get_compare_less_func() const override {
+		return compare_less;
+	}
+
+	ObjectID get_object() const override {
+		return state_id;
+	}
 
-	if (self.is_null()) {
-		r_error.error = Callable::CallError::CALL_ERROR_INVALID_ARGUMENT;
-		r_error.argument = p_argcount - 1;
-		r_error.expected = Variant::OBJECT;
-		return Variant();
+	StringName get_method() const override {
+		return SNAME("resume");
 	}
 
-	return resume(arg);
+	void call(const Variant **p_arguments, int p_argcount, Variant &r_return_value, Callable::CallError &r_call_error) const override {
+		r_call_error.error = Callable::CallError::CALL_OK;
+
+		if (p_argcount == 0) {
+			r_return_value = state->resume();
+		} else if (p_argcount == 1) {
+			r_return_value = state->resume(*p_arguments[0]);
+		} else {
+			Array extra_args;
+			extra_args.resize(p_argcount);
+			for (int i = 0; i < p_argcount; i++) {
+				extra_args[i] = *p_arguments[i];
+			}
+			r_return_value = state->resume(extra_args);
+		}
+	}
+
+	GDScriptFunctionStateResumeCallable(GDScriptFunctionState *p_state) :
+			state(p_state),
+			state_id(p_state->get_instance_id()) {
+	}
+};
+
+Callable GDScriptFunctionState::get_resume_callable() {
+	return Callable(memnew(GDScriptFunctionStateResumeCallable(this)));
 }
 
 bool GDScriptFunctionState::is_valid(bool p_extended_check) const {
@@ -337,18 +371,94 @@ Variant GDScriptFunctionState::resume(const Variant &p_arg) {
 	function = nullptr; // Cleaned up.
 	state.result = Variant();
 
+	// If the function awaited again, the frame was handed over to the new state,
+	// otherwise it is no longer needed.
+	_release_frame();
+
 	return ret;
 }
 
 void GDScriptFunctionState::_clear_stack() {
 	if (state.stack_size) {
-		Variant *stack = (Variant *)state.stack.ptr();
+		Variant *stack = (Variant *)state.stack;
 		// First `GDScriptFunction::FIXED_ADDRESSES_MAX` stack addresses are special
 		// and not copied to the state, so we skip them here.
 		for (int i = GDScriptFunction::FIXED_ADDRESSES_MAX; i < state.stack_size; i++) {
 			stack[i].~Variant();
 		}
 		state.stack_size = 0;
+		_release_frame();
+	}
+}
+
+GDScriptFunctionState::FramePoolClass GDScriptFunctionState::frame_pool[FRAME_POOL_SIZE_CLASSES];
+
+uint8_t *GDScriptFunctionState::_alloc_frame(uint32_t p_size, uint32_t &r_capacity) {
+	uint32_t shift = FRAME_POOL_MIN_SIZE_SHIFT;
+	while (shift <= FRAME_POOL_MAX_SIZE_SHIFT && (1u << shift) < p_size) {
+		shift++;
+	}
+	if (shift > FRAME_POOL_MAX_SIZE_SHIFT) {
+		r_capacity = p_size;
+		return (uint8_t *)memalloc(p_size);
+	}
+
+	r_capacity = 1u << shift;
+	FramePoolClass &pool = frame_pool[shift - FRAME_POOL_MIN_SIZE_SHIFT];
+	pool.lock.lock();
+	uint8_t *frame = pool.free_list;
+	if (frame) {
+		pool.free_list = *(uint8_t **)frame;
+		pool.free_count--;
+	}
+	pool.lock.unlock();
+
+	if (!frame) {
+		frame = (uint8_t *)memalloc(r_capacity);
+	}
+	return frame;
+}
+
+void GDScriptFunctionState::_free_frame(uint8_t *p_frame, uint32_t p_capacity) {
+	uint32_t shift = FRAME_POOL_MIN_SIZE_SHIFT;
+	while (shift <= FRAME_POOL_MAX_SIZE_SHIFT && (1u << shift) != p_capacity) {
+		shift++;
+	}
+	if (shift <= FRAME_POOL_MAX_SIZE_SHIFT) {
+		FramePoolClass &pool = frame_pool[shift - FRAME_POOL_MIN_SIZE_SHIFT];
+		pool.lock.lock();
+		if (pool.free_count < ((uint32_t)FRAME_POOL_MAX_BYTES_PER_CLASS >> shift)) {
+			*(uint8_t **)p_frame = pool.free_list;
+			pool.free_list = p_frame;
+			pool.free_count++;
+			p_frame = nullptr;
+		}
+		pool.lock.unlock();
+	}
+
+	if (p_frame) {
+		memfree(p_frame);
+	}
+}
+
+void GDScriptFunctionState::_release_frame() {
+	if (state.stack) {
+		_free_frame(state.stack, state.stack_capacity);
+		state.stack = nullptr;
+		state.stack_capacity = 0;
+	}
+}
+
+void GDScriptFunctionState::clear_frame_pool() {
+	for (FramePoolClass &pool : frame_pool) {
+		pool.lock.lock();
+		while (pool.free_list) {
+			uint8_t *frame = pool.free_list;
+			pool.free_list = *(uint8_t **)frame;
+			memfree(frame);
+		}
+		pool.free_count = 0;
+		pool.lock.unlock();
 	}
 }
 
@@ -364,7 +474,6 @@ void GDScriptFunctionState::_clear_connections() {
 void GDScriptFunctionState::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("resume", "arg"), &GDScriptFunctionState::resume, DEFVAL(Variant()));
 	ClassDB::bind_method(D_METHOD("is_valid", "extended_check"), &GDScriptFunctionState::is_valid, DEFVAL(false));
-	ClassDB::bind_vararg_method(METHOD_FLAGS_DEFAULT, "_signal_callback", &GDScriptFunctionState::_signal_callback, MethodInfo("_signal_callback"));
 
 	ADD_SIGNAL(MethodInfo("completed", PropertyInfo(Variant::NIL, "result", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NIL_IS_VARIANT)));
 }
@@ -381,4 +490,5 @@ GDScriptFunctionState::~GDScriptFunctionState() {
 		instances_list.remove_from_list();
 		_clear_stack();
 	}
+	_release_frame();
 }
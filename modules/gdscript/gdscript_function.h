@@ -34,6 +34,7 @@
 
 #include "core/object/ref_counted.h"
 #include "core/object/script_language.h"
+#include "core/os/spin_lock.h"
 #include "core/os/thread.h"
 #include "core/string/string_name.h"
 #include "core/templates/pair.h"
@@ -339,6 +340,7 @@ public:
 
 private:
 	friend class GDScript;
+	friend class GDScriptBytecodeCache;
 	friend class GDScriptCompiler;
 	friend class GDScriptByteCodeGenerator;
 	friend class GDScriptLanguage;
@@ -466,7 +468,9 @@ public:
 		StringName function_name;
 		String script_path;
 #endif
-		Vector<uint8_t> stack;
+		// Frame holding the suspended stack, allocated from the pool in `GDScriptFunctionState`.
+		uint8_t *stack = nullptr;
+		uint32_t stack_capacity = 0;
 		int stack_size = 0;
 		int ip = 0;
 		int line = 0;
@@ -504,7 +508,26 @@ class GDScriptFunctionState : public RefCounted {
 	friend class GDScriptFunction;
 	GDScriptFunction *function = nullptr;
 	GDScriptFunction::CallState state;
-	Variant _signal_callback(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
+
+	// Suspended stack frames are recycled through per-size-class free lists, since coroutines
+	// awaiting in a loop would otherwise allocate and free a frame on every `await`.
+	enum {
+		FRAME_POOL_MIN_SIZE_SHIFT = 8, // 256 bytes.
+		FRAME_POOL_MAX_SIZE_SHIFT = 16, // 64 KiB, larger frames are not pooled.
+		FRAME_POOL_SIZE_CLASSES = FRAME_POOL_MAX_SIZE_SHIFT - FRAME_POOL_MIN_SIZE_SHIFT + 1,
+		FRAME_POOL_MAX_BYTES_PER_CLASS = 1024 * 1024,
+	};
+
+	struct FramePoolClass {
+		SpinLock lock;
+		uint8_t *free_list = nullptr; // Each free frame starts with a pointer to the next one.
+		uint32_t free_count = 0;
+	};
+	static FramePoolClass frame_pool[FRAME_POOL_SIZE_CLASSES];
+
+	static uint8_t *_alloc_frame(uint32_t p_size, uint32_t &r_capacity);
+	static void _free_frame(uint8_t *p_frame, uint32_t p_capacity);
+	void _release_frame();
 
 	SelfList<GDScriptFunctionState> scripts_list;
 	SelfList<GDScriptFunctionState> instances_list;
@@ -526,6 +549,11 @@ public:
 	void _clear_stack();
 	void _clear_connections();
 
+	// Returns the callable connected to the awaited signal, which resumes this state.
+	Callable get_resume_callable();
+
+	static void clear_frame_pool();
+
 	GDScriptFunctionState();
 	~GDScriptFunctionState();
 };
@@ -34,6 +34,33 @@
 
 #include "core/templates/hashfuncs.h"
 
+// Lambda callables store their captures after the object itself, so creating one takes a single allocation.
+template <typename T>
+static _FORCE_INLINE_ constexpr size_t _get_captures_offset() {
+	return (sizeof(T) + alignof(Variant) - 1) & ~(alignof(Variant) - 1);
+}
+
+template <typename T>
+static void *_alloc_with_captures(int p_captures_count) {
+	return Memory::alloc_static(_get_captures_offset<T>() + sizeof(Variant) * p_captures_count);
+}
+
+template <typename T>
+static void _init_captures(T *p_callable, const Variant **p_captures, int p_captures_count) {
+	Variant *captures = reinterpret_cast<Variant *>(reinterpret_cast<uint8_t *>(p_callable) + _get_captures_offset<T>());
+	for (int i = 0; i < p_captures_count; i++) {
+		memnew_placement(&captures[i], Variant(*p_captures[i]));
+	}
+}
+
+template <typename T>
+static void _free_captures(T *p_callable, int p_captures_count) {
+	Variant *captures = reinterpret_cast<Variant *>(reinterpret_cast<uint8_t *>(p_callable) + _get_captures_offset<T>());
+	for (int i = 0; i < p_captures_count; i++) {
+		captures[i].~Variant();
+	}
+}
+
 bool GDScriptLambdaCallable::compare_equal(const CallableCustom *p_a, const CallableCustom *p_b) {
 	// Lambda callables are only compared by reference.
 	return p_a == p_b;
@@ -86,11 +113,12 @@ int GDScriptLambdaCallable::get_argument_count(bool &r_is_valid) const {
 		return 0;
 	}
 	r_is_valid = true;
-	return function->get_argument_count() - captures.size();
+	return function->get_argument_count() - captures_count;
 }
 
 void GDScriptLambdaCallable::call(const Variant **p_arguments, int p_argcount, Variant &r_return_value, Callable::CallError &r_call_error) const {
-	int captures_amount = captures.size();
+	const int captures_amount = captures_count;
+	const Variant *captures = _get_captures();
 
 	if (function == nullptr) {
 		r_return_value = Variant();
@@ -150,16 +178,29 @@ void GDScriptLambdaCallable::call(const Variant **p_arguments, int p_argcount, V
 	}
 }
 
-GDScriptLambdaCallable::GDScriptLambdaCallable(Ref<GDScript> p_script, GDScriptFunction *p_function, const Vector<Variant> &p_captures) :
+const Variant *GDScriptLambdaCallable::_get_captures() const {
+	return reinterpret_cast<const Variant *>(reinterpret_cast<const uint8_t *>(this) + _get_captures_offset<GDScriptLambdaCallable>());
+}
+
+GDScriptLambdaCallable *GDScriptLambdaCallable::create(Ref<GDScript> p_script, GDScriptFunction *p_function, const Variant **p_captures, int p_captures_count) {
+	return memnew_placement(_alloc_with_captures<GDScriptLambdaCallable>(p_captures_count), GDScriptLambdaCallable(p_script, p_function, p_captures, p_captures_count));
+}
+
+GDScriptLambdaCallable::GDScriptLambdaCallable(Ref<GDScript> p_script, GDScriptFunction *p_function, const Variant **p_captures, int p_captures_count) :
 		function(p_function) {
 	ERR_FAIL_COND(p_script.is_null());
 	ERR_FAIL_NULL(p_function);
 	script = p_script;
-	captures = p_captures;
+	_init_captures(this, p_captures, p_captures_count);
+	captures_count = p_captures_count;
 
 	h = (uint32_t)hash_murmur3_one_64((uint64_t)this);
 }
 
+GDScriptLambdaCallable::~GDScriptLambdaCallable() {
+	_free_captures(this, captures_count);
+}
+
 bool GDScriptLambdaSelfCallable::compare_equal(const CallableCustom *p_a, const CallableCustom *p_b) {
 	// Lambda callables are only compared by reference.
 	return p_a == p_b;
@@ -210,7 +251,7 @@ int GDScriptLambdaSelfCallable::get_argument_count(bool &r_is_valid) const {
 		return 0;
 	}
 	r_is_valid = true;
-	return function->get_argument_count() - captures.size();
+	return function->get_argument_count() - captures_count;
 }
 
 void GDScriptLambdaSelfCallable::call(const Variant **p_arguments, int p_argcount, Variant &r_return_value, Callable::CallError &r_call_error) const {
@@ -222,7 +263,8 @@ void GDScriptLambdaSelfCallable::call(const Variant **p_arguments, int p_argcoun
 	}
 #endif
 
-	int captures_amount = captures.size();
+	const int captures_amount = captures_count;
+	const Variant *captures = _get_captures();
 
 	if (function == nullptr) {
 		r_return_value = Variant();
@@ -282,23 +324,26 @@ void GDScriptLambdaSelfCallable::call(const Variant **p_arguments, int p_argcoun
 	}
 }
 
-GDScriptLambdaSelfCallable::GDScriptLambdaSelfCallable(Ref<RefCounted> p_self, GDScriptFunction *p_function, const Vector<Variant> &p_captures) :
-		function(p_function) {
-	ERR_FAIL_COND(p_self.is_null());
-	ERR_FAIL_NULL(p_function);
-	reference = p_self;
-	object = p_self.ptr();
-	captures = p_captures;
+const Variant *GDScriptLambdaSelfCallable::_get_captures() const {
+	return reinterpret_cast<const Variant *>(reinterpret_cast<const uint8_t *>(this) + _get_captures_offset<GDScriptLambdaSelfCallable>());
+}
 
-	h = (uint32_t)hash_murmur3_one_64((uint64_t)this);
+GDScriptLambdaSelfCallable *GDScriptLambdaSelfCallable::create(Object *p_self, GDScriptFunction *p_function, const Variant **p_captures, int p_captures_count) {
+	return memnew_placement(_alloc_with_captures<GDScriptLambdaSelfCallable>(p_captures_count), GDScriptLambdaSelfCallable(p_self, p_function, p_captures, p_captures_count));
 }
 
-GDScriptLambdaSelfCallable::GDScriptLambdaSelfCallable(Object *p_self, GDScriptFunction *p_function, const Vector<Variant> &p_captures) :
+GDScriptLambdaSelfCallable::GDScriptLambdaSelfCallable(Object *p_self, GDScriptFunction *p_function, const Variant **p_captures, int p_captures_count) :
 		function(p_function) {
 	ERR_FAIL_NULL(p_self);
 	ERR_FAIL_NULL(p_function);
 	object = p_self;
-	captures = p_captures;
+	reference = Ref<RefCounted>(Object::cast_to<RefCounted>(p_self));
+	_init_captures(this, p_captures, p_captures_count);
+	captures_count = p_captures_count;
 
 	h = (uint32_t)hash_murmur3_one_64((uint64_t)this);
 }
+
+GDScriptLambdaSelfCallable::~GDScriptLambdaSelfCallable() {
+	_free_captures(this, captures_count);
+}
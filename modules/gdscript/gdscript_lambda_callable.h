@@ -33,7 +33,6 @@
 #include "gdscript.h"
 
 #include "core/object/ref_counted.h"
-#include "core/templates/vector.h"
 #include "core/variant/callable.h"
 #include "core/variant/variant.h"
 
@@ -45,11 +44,15 @@ class GDScriptLambdaCallable : public CallableCustom {
 	Ref<GDScript> script;
 	uint32_t h;
 
-	Vector<Variant> captures;
+	// Captures are stored right after the object, in the same allocation, see `create()`.
+	int captures_count = 0;
+	const Variant *_get_captures() const;
 
 	static bool compare_equal(const CallableCustom *p_a, const CallableCustom *p_b);
 	static bool compare_less(const CallableCustom *p_a, const CallableCustom *p_b);
 
+	GDScriptLambdaCallable(Ref<GDScript> p_script, GDScriptFunction *p_function, const Variant **p_captures, int p_captures_count);
+
 public:
 	bool is_valid() const override;
 	uint32_t hash() const override;
@@ -61,10 +64,11 @@ public:
 	int get_argument_count(bool &r_is_valid) const override;
 	void call(const Variant **p_arguments, int p_argcount, Variant &r_return_value, Callable::CallError &r_call_error) const override;
 
+	static GDScriptLambdaCallable *create(Ref<GDScript> p_script, GDScriptFunction *p_function, const Variant **p_captures, int p_captures_count);
+
 	GDScriptLambdaCallable(GDScriptLambdaCallable &) = delete;
 	GDScriptLambdaCallable(const GDScriptLambdaCallable &) = delete;
-	GDScriptLambdaCallable(Ref<GDScript> p_script, GDScriptFunction *p_function, const Vector<Variant> &p_captures);
-	virtual ~GDScriptLambdaCallable() = default;
+	virtual ~GDScriptLambdaCallable();
 };
 
 // Lambda callable that references a particular object, so it can use `self` in the body.
@@ -74,11 +78,15 @@ class GDScriptLambdaSelfCallable : public CallableCustom {
 	Object *object = nullptr; // For non RefCounted objects, use a direct pointer.
 	uint32_t h;
 
-	Vector<Variant> captures;
+	// Captures are stored right after the object, in the same allocation, see `create()`.
+	int captures_count = 0;
+	const Variant *_get_captures() const;
 
 	static bool compare_equal(const CallableCustom *p_a, const CallableCustom *p_b);
 	static bool compare_less(const CallableCustom *p_a, const CallableCustom *p_b);
 
+	GDScriptLambdaSelfCallable(Object *p_self, GDScriptFunction *p_function, const Variant **p_captures, int p_captures_count);
+
 public:
 	bool is_valid() const override;
 	uint32_t hash() const override;
@@ -90,9 +98,9 @@ public:
 	int get_argument_count(bool &r_is_valid) const override;
 	void call(const Variant **p_arguments, int p_argcount, Variant &r_return_value, Callable::CallError &r_call_error) const override;
 
+	static GDScriptLambdaSelfCallable *create(Object *p_self, GDScriptFunction *p_function, const Variant **p_captures, int p_captures_count);
+
 	GDScriptLambdaSelfCallable(GDScriptLambdaSelfCallable &) = delete;
 	GDScriptLambdaSelfCallable(const GDScriptLambdaSelfCallable &) = delete;
-	GDScriptLambdaSelfCallable(Ref<RefCounted> p_self, GDScriptFunction *p_function, const Vector<Variant> &p_captures);
-	GDScriptLambdaSelfCallable(Object *p_self, GDScriptFunction *p_function, const Vector<Variant> &p_captures);
-	virtual ~GDScriptLambdaSelfCallable() = default;
+	virtual ~GDScriptLambdaSelfCallable();
 };
@@ -0,0 +1,330 @@
+/**************************************************************************/
+/*  gdscript_sampling_profiler.cpp                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "gdscript_sampling_profiler.h"
+
+#ifdef DEBUG_ENABLED
+
+#include "gdscript.h"
+
+#include "core/config/project_settings.h"
+#include "core/debugger/engine_debugger.h"
+#include "core/io/file_access.h"
+#include "core/object/method_bind.h"
+#include "core/os/os.h"
+
+static const char *CMDLINE_OPTION = "--gdscript-sampling-profile";
+static const char *DEBUGGER_PROFILER_NAME = "gdscript_sampler";
+
+Mutex GDScriptSamplingProfiler::mutex;
+Thread *GDScriptSamplingProfiler::thread = nullptr;
+SafeFlag GDScriptSamplingProfiler::exit_thread;
+uint32_t GDScriptSamplingProfiler::interval_usec = 1000;
+bool GDScriptSamplingProfiler::line_granularity = false;
+String GDScriptSamplingProfiler::cmdline_output_path;
+HashMap<String, uint64_t> GDScriptSamplingProfiler::stacks;
+uint64_t GDScriptSamplingProfiler::sample_count = 0;
+uint64_t GDScriptSamplingProfiler::dropped_count = 0;
+
+namespace {
+
+struct RawFrame {
+	GDScriptFunction *function = nullptr;
+	int line = 0;
+	MethodBind *native_method = nullptr;
+	const StringName *native_name = nullptr;
+};
+
+struct ResolvedFrame {
+	StringName source;
+	StringName name;
+	int line = 0;
+	StringName native_class;
+	StringName native_name;
+};
+
+struct ThreadSample {
+	Thread::ID thread_id = Thread::UNASSIGNED_ID;
+	bool truncated = false;
+	LocalVector<ResolvedFrame> frames; // Leaf first.
+};
+
+void _debugger_toggle(void *p_user, bool p_enable, const Array &p_opts) {
+	if (p_enable) {
+		uint32_t interval = GLOBAL_GET("debug/settings/gdscript/sampling_profiler_interval");
+		bool per_line = false;
+		if (p_opts.size() > 0 && p_opts[0].get_type() == Variant::INT) {
+			interval = p_opts[0];
+		}
+		if (p_opts.size() > 1 && p_opts[1].get_type() == Variant::BOOL) {
+			per_line = p_opts[1];
+		}
+		GDScriptSamplingProfiler::clear();
+		GDScriptSamplingProfiler::start(interval, per_line);
+	} else if (GDScriptSamplingProfiler::is_running()) {
+		GDScriptSamplingProfiler::stop();
+		Array data;
+		data.push_back(GDScriptSamplingProfiler::get_collapsed_stacks());
+		data.push_back(GDScriptSamplingProfiler::get_sample_count());
+		data.push_back(GDScriptSamplingProfiler::get_dropped_count());
+		EngineDebugger::get_singleton()->send_message("gdscript_sampler:stacks", data);
+	}
+}
+
+} // namespace
+
+void GDScriptSamplingProfiler::_take_sample() {
+	GDScriptLanguage *language = GDScriptLanguage::get_singleton();
+	LocalVector<ThreadSample> samples;
+	uint64_t dropped = 0;
+
+	{
+		// Threads can't unregister (and free their published frames) while this is held.
+		MutexLock registry_lock(language->sampled_call_stacks_mutex);
+
+		// Functions can't be freed while the language mutex is held, which makes it safe to
+		// read their names once the snapshot is known to be consistent. Never wait for it:
+		// a thread holding it may be blocked registering itself on the lock we already hold.
+		if (!language->mutex.try_lock()) {
+			MutexLock lock(mutex);
+			dropped_count++;
+			return;
+		}
+
+		RawFrame raw_frames[GDScriptLanguage::MAX_SAMPLED_DEPTH];
+		for (GDScriptLanguage::SampledCallStack *sampled = language->sampled_call_stacks; sampled; sampled = sampled->next) {
+			const uint32_t seq = sampled->seq.load(std::memory_order_acquire);
+			if (seq & 1) {
+				dropped++;
+				continue;
+			}
+
+			// Only copy values here. Pointers are not followed until the copy is known to be consistent.
+			const uint32_t full_depth = sampled->depth.load(std::memory_order_relaxed);
+			const uint32_t depth = MIN(full_depth, GDScriptLanguage::MAX_SAMPLED_DEPTH);
+			for (uint32_t i = 0; i < depth; i++) {
+				const GDScriptLanguage::SampledFrame &frame = sampled->frames[i];
+				RawFrame &raw = raw_frames[i];
+				raw.function = frame.function.load(std::memory_order_relaxed);
+				raw.line = frame.line.load(std::memory_order_relaxed);
+				raw.native_method = frame.native_method.load(std::memory_order_relaxed);
+				raw.native_name = frame.native_name.load(std::memory_order_relaxed);
+			}
+			const bool truncated = full_depth > depth;
+
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (sampled->seq.load(std::memory_order_relaxed) != seq) {
+				// The stack changed while it was being read.
+				dropped++;
+				continue;
+			}
+			if (depth == 0) {
+				// Not running any script code right now.
+				continue;
+			}
+
+			samples.push_back(ThreadSample());
+			ThreadSample &sample = samples[samples.size() - 1];
+			sample.thread_id = sampled->thread_id;
+			sample.truncated = truncated;
+			sample.frames.resize(depth);
+			for (uint32_t i = 0; i < depth; i++) {
+				const RawFrame &raw = raw_frames[depth - 1 - i];
+				ResolvedFrame &frame = sample.frames[i];
+				if (raw.function) {
+					frame.source = raw.function->get_source();
+					frame.name = raw.function->get_name();
+				}
+				frame.line = raw.line;
+				if (raw.native_method) {
+					frame.native_class = raw.native_method->get_instance_class();
+					frame.native_name = raw.native_method->get_name();
+				} else if (raw.native_name) {
+					frame.native_name = *raw.native_name;
+				}
+			}
+		}
+
+		language->mutex.unlock();
+	}
+
+	// Format outside of the locks, the profiled threads may be waiting on them.
+	MutexLock lock(mutex);
+	dropped_count += dropped;
+	for (const ThreadSample &sample : samples) {
+		String stack = sample.thread_id == Thread::get_main_id() ? String("Main Thread") : vformat("Thread %d", (uint64_t)sample.thread_id);
+		for (int64_t i = int64_t(sample.frames.size()) - 1; i >= 0; i--) {
+			const ResolvedFrame &frame = sample.frames[i];
+			stack += ";";
+			if (line_granularity) {
+				stack += vformat("%s (%s:%d)", frame.name, frame.source, frame.line);
+			} else {
+				stack += vformat("%s (%s)", frame.name, frame.source);
+			}
+
+			if (frame.native_name == StringName()) {
+				continue;
+			}
+			// A call by name may have reached another script function, which is already the next frame.
+			if (i > 0 && frame.native_class == StringName() && sample.frames[i - 1].name == frame.native_name) {
+				continue;
+			}
+			if (frame.native_class == StringName()) {
+				stack += ";" + String(frame.native_name);
+			} else {
+				stack += ";" + String(frame.native_class) + "::" + String(frame.native_name);
+			}
+		}
+		if (sample.truncated) {
+			stack += ";[truncated]";
+		}
+		stacks[stack]++;
+	}
+	sample_count++;
+}
+
+void GDScriptSamplingProfiler::_thread_func(void *p_userdata) {
+	Thread::set_name("GDScript Sampling Profiler");
+
+	while (!exit_thread.is_set()) {
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		_take_sample();
+		const uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+		if (elapsed < interval_usec) {
+			OS::get_singleton()->delay_usec(interval_usec - elapsed);
+		}
+	}
+}
+
+void GDScriptSamplingProfiler::initialize() {
+	EngineDebugger::register_profiler(DEBUGGER_PROFILER_NAME, EngineDebugger::Profiler(nullptr, _debugger_toggle, nullptr, nullptr));
+
+	const List<String> args = OS::get_singleton()->get_cmdline_args();
+	for (const List<String>::Element *E = args.front(); E; E = E->next()) {
+		if (E->get() != CMDLINE_OPTION) {
+			continue;
+		}
+		ERR_FAIL_COND_MSG(!E->next(), vformat("Missing output file for \"%s\".", CMDLINE_OPTION));
+		cmdline_output_path = E->next()->get();
+		start(GLOBAL_GET("debug/settings/gdscript/sampling_profiler_interval"));
+		break;
+	}
+}
+
+void GDScriptSamplingProfiler::finalize() {
+	stop();
+
+	if (!cmdline_output_path.is_empty()) {
+		if (save_collapsed_stacks(cmdline_output_path) == OK) {
+			print_line(vformat("GDScript sampling profiler: Wrote %d samples to \"%s\".", sample_count, cmdline_output_path));
+		}
+		cmdline_output_path = String();
+	}
+
+	if (EngineDebugger::has_profiler(DEBUGGER_PROFILER_NAME)) {
+		EngineDebugger::unregister_profiler(DEBUGGER_PROFILER_NAME);
+	}
+	clear();
+}
+
+void GDScriptSamplingProfiler::start(uint32_t p_interval_usec, bool p_line_granularity) {
+	ERR_FAIL_COND_MSG(thread, "The GDScript sampling profiler is already running.");
+
+	interval_usec = MAX(p_interval_usec, 1u);
+	line_granularity = p_line_granularity;
+	GDScriptLanguage::_sampling_call_stacks.set();
+
+	exit_thread.clear();
+	thread = memnew(Thread);
+	thread->start(_thread_func, nullptr);
+}
+
+void GDScriptSamplingProfiler::stop() {
+	if (!thread) {
+		return;
+	}
+
+	exit_thread.set();
+	thread->wait_to_finish();
+	memdelete(thread);
+	thread = nullptr;
+
+	// Threads that already registered keep publishing their stacks, which is cheap;
+	// this only stops new threads from registering.
+	GDScriptLanguage::_sampling_call_stacks.clear();
+}
+
+bool GDScriptSamplingProfiler::is_running() {
+	return thread != nullptr;
+}
+
+void GDScriptSamplingProfiler::clear() {
+	MutexLock lock(mutex);
+	stacks.clear();
+	sample_count = 0;
+	dropped_count = 0;
+}
+
+uint64_t GDScriptSamplingProfiler::get_sample_count() {
+	MutexLock lock(mutex);
+	return sample_count;
+}
+
+uint64_t GDScriptSamplingProfiler::get_dropped_count() {
+	MutexLock lock(mutex);
+	return dropped_count;
+}
+
+String GDScriptSamplingProfiler::get_collapsed_stacks() {
+	MutexLock lock(mutex);
+
+	LocalVector<String> keys;
+	keys.reserve(stacks.size());
+	for (const KeyValue<String, uint64_t> &E : stacks) {
+		keys.push_back(E.key);
+	}
+	keys.sort();
+
+	String result;
+	for (const String &key : keys) {
+		result += key + " " + itos(stacks[key]) + "\n";
+	}
+	return result;
+}
+
+Error GDScriptSamplingProfiler::save_collapsed_stacks(const String &p_path) {
+	Error err;
+	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, vformat("Cannot open file \"%s\" to save the GDScript sampling profile.", p_path));
+	file->store_string(get_collapsed_stacks());
+	return OK;
+}
+
+#endif // DEBUG_ENABLED
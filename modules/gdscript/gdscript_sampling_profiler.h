@@ -0,0 +1,79 @@
+/**************************************************************************/
+/*  gdscript_sampling_profiler.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#ifdef DEBUG_ENABLED
+
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/safe_refcount.h"
+
+// Statistical profiler for GDScript. A background thread periodically takes a
+// snapshot of the call stack of every thread running GDScript code and counts
+// identical stacks. Unlike the instrumenting profiler (`profiling_start()`),
+// the cost on the profiled threads does not depend on how often functions are
+// called, so small functions are not over-represented.
+//
+// Results are produced in the "collapsed stacks" format understood by
+// flamegraph tools: one line per distinct stack, frames separated by `;`
+// from the root to the leaf, followed by the number of samples.
+class GDScriptSamplingProfiler {
+	static Mutex mutex;
+	static Thread *thread;
+	static SafeFlag exit_thread;
+	static uint32_t interval_usec;
+	static bool line_granularity;
+	static String cmdline_output_path;
+
+	static HashMap<String, uint64_t> stacks;
+	static uint64_t sample_count;
+	static uint64_t dropped_count;
+
+	static void _thread_func(void *p_userdata);
+	static void _take_sample();
+
+public:
+	static void initialize();
+	static void finalize();
+
+	static void start(uint32_t p_interval_usec, bool p_line_granularity = false);
+	static void stop();
+	static bool is_running();
+
+	static void clear();
+	static uint64_t get_sample_count();
+	static uint64_t get_dropped_count();
+	static String get_collapsed_stacks();
+	static Error save_collapsed_stacks(const String &p_path);
+};
+
+#endif // DEBUG_ENABLED
@@ -31,6 +31,7 @@
 #include "register_types.h"
 
 #include "gdscript.h"
+#include "gdscript_bytecode_cache.h"
 #include "gdscript_cache.h"
 #include "gdscript_parser.h"
 #include "gdscript_resource_format.h"
@@ -56,6 +57,7 @@
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
 #include "core/object/class_db.h"
+#include "core/os/os.h"
 
 #ifdef TOOLS_ENABLED
 #include "editor/editor_node.h"
@@ -87,6 +89,10 @@ class EditorExportGDScript : public EditorExportPlugin {
 	EditorExportPreset::ScriptExportMode script_mode = DEFAULT_SCRIPT_MODE;
 
 protected:
+	virtual void _get_export_options(const Ref<EditorExportPlatform> &p_export_platform, List<EditorExportPlatform::ExportOption> *r_options) const override {
+		r_options->push_back(EditorExportPlatform::ExportOption(PropertyInfo(Variant::BOOL, "gdscript/bytecode_cache"), false));
+	}
+
 	virtual void _export_begin(const HashSet<String> &p_features, bool p_debug, const String &p_path, int p_flags) override {
 		script_mode = DEFAULT_SCRIPT_MODE;
 
@@ -94,6 +100,12 @@ protected:
 		if (preset.is_valid()) {
 			script_mode = preset->get_script_export_mode();
 		}
+
+		if (preset.is_valid() && bool(get_option("gdscript/bytecode_cache"))) {
+			// A new identifier for every export, so bytecode cached by a previous build of the project is never reused.
+			String export_id = String::num_uint64(hash_murmur3_one_64(OS::get_singleton()->get_ticks_usec(), hash_murmur3_one_64((uint64_t)OS::get_singleton()->get_unix_time())), 16);
+			add_file(GDScriptBytecodeCache::EXPORT_ID_PATH, export_id.to_utf8_buffer(), false);
+		}
 	}
 
 	virtual void _export_file(const String &p_path, const String &p_type, const HashSet<String> &p_features) override {
@@ -0,0 +1,25 @@
+signal tick(value)
+
+var totals := []
+
+func accumulate(id: int):
+	var total := 0
+	var history := [id]
+	for i in 3:
+		var value = await tick
+		total += value * id
+		history.append(value)
+	totals.append([total, history])
+
+func test():
+	for id in range(1, 4):
+		@warning_ignore("missing_await")
+		accumulate(id)
+
+	# Every coroutine awaits again on the same frame after each emission.
+	tick.emit(1)
+	tick.emit(10)
+	tick.emit(100)
+
+	for entry in totals:
+		print(entry)
@@ -0,0 +1,29 @@
+signal triggered
+
+func make_lambda() -> Callable:
+	return func (x): return x * 2
+
+func make_capturing(offset: int) -> Callable:
+	return func (x): return x + offset
+
+func test():
+	# Each evaluation of a lambda is a distinct callable, even without captures.
+	print(make_lambda() == make_lambda())
+	print(make_lambda().call(21))
+
+	# So the same lambda literal can be connected more than once.
+	for i in 2:
+		triggered.connect(func (): print("triggered"))
+	print(triggered.get_connections().size())
+	triggered.emit()
+
+	# Lambdas with captures keep their own values.
+	var add_one := make_capturing(1)
+	var add_ten := make_capturing(10)
+	print(add_one == add_ten)
+	print(add_one.call(1), " ", add_ten.call(1))
+	print([1, 2, 3].map(add_ten))
+
+	var bound := add_ten.bind(5)
+	print(bound.call())
+	print(bound.get_bound_arguments())
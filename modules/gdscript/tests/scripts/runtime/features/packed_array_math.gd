@@ -0,0 +1,22 @@
+func test():
+	var a := PackedFloat64Array([1.0, 2.0, 3.0, 4.0, 5.0])
+	a.multiply_add_scalar(2.0, 1.0)
+	print(a)
+	a.add_array(PackedFloat64Array([1.0, 1.0, 1.0, 1.0, 1.0]))
+	print(a)
+	a.clamp(4.0, 10.0)
+	print(a)
+	print(a.sum())
+	print(a.min(), " ", a.max())
+	print(a.dot(PackedFloat64Array([1.0, 0.0, 1.0, 0.0, 1.0])))
+
+	var b := PackedFloat32Array([0.0, 0.0, 0.0, 0.0])
+	b.lerp(PackedFloat32Array([2.0, 4.0, 6.0, 8.0]), 0.5)
+	print(b)
+	b.select(PackedByteArray([1, 0, 1, 0]), PackedFloat32Array([-1.0, -1.0, -1.0, -1.0]))
+	print(b)
+	print(PackedFloat32Array().sum())
+
+	var points := PackedVector3Array([Vector3(1, 0, 0), Vector3(0, 1, 0)])
+	points.transform(Transform3D(Basis(), Vector3(0, 0, 5)))
+	print(points)
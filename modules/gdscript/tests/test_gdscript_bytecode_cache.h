@@ -0,0 +1,179 @@
+/**************************************************************************/
+/*  test_gdscript_bytecode_cache.h                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../gdscript.h"
+#include "../gdscript_bytecode_cache.h"
+#include "../gdscript_cache.h"
+
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace GDScriptTests {
+
+class TestGDScriptBytecodeCacheAccessor {
+public:
+	static void enable(const String &p_cache_dir) {
+		GDScriptBytecodeCache::enabled = true;
+		GDScriptBytecodeCache::build_key = "test";
+		GDScriptBytecodeCache::cache_dir = p_cache_dir;
+	}
+
+	static void disable() {
+		GDScriptBytecodeCache::enabled = false;
+		GDScriptBytecodeCache::build_key = String();
+		GDScriptBytecodeCache::cache_dir = String();
+	}
+
+	static String get_cache_path(const GDScriptBytecodeCache &p_cache) {
+		return p_cache.cache_path;
+	}
+
+	static int get_cached_function_count(const GDScriptBytecodeCache &p_cache) {
+		return p_cache.cached_functions.size();
+	}
+
+	static bool has_cached_function(const GDScriptBytecodeCache &p_cache, const GDScript *p_script, const StringName &p_name) {
+		return p_cache.cached_functions.has(GDScriptBytecodeCache::_get_function_key(p_script, p_name));
+	}
+};
+
+static const char *BYTECODE_CACHE_TEST_PATH = "res://gdscript_bytecode_cache_test.gd";
+
+static const char *BYTECODE_CACHE_TEST_SOURCE = R"(
+extends RefCounted
+
+func get_value():
+	return 42
+)";
+
+static Ref<GDScript> compile_bytecode_cache_test_script(const String &p_source) {
+	Ref<GDScript> script;
+	script.instantiate();
+	script->set_source_code(p_source);
+	script->set_path_cache(BYTECODE_CACHE_TEST_PATH);
+	ERR_PRINT_OFF;
+	const Error err = script->reload();
+	ERR_PRINT_ON;
+	CHECK_MESSAGE(err == OK, "The script should compile successfully.");
+	return script;
+}
+
+static void release_bytecode_cache_test_script(Ref<GDScript> &r_script) {
+	r_script.unref();
+	GDScriptCache::remove_script(BYTECODE_CACHE_TEST_PATH);
+}
+
+static int run_bytecode_cache_test_script(const Ref<GDScript> &p_script) {
+	Ref<RefCounted> ref_counted;
+	ref_counted.instantiate();
+	ref_counted->set_script(p_script);
+	const int value = ref_counted->call("get_value");
+	ref_counted->set_script(Variant());
+	return value;
+}
+
+TEST_CASE("[Modules][GDScript] Bytecode cache") {
+	const String cache_dir = TestUtils::get_temp_path("gdscript_bytecode_cache");
+	REQUIRE(DirAccess::make_dir_recursive_absolute(cache_dir) == OK);
+	TestGDScriptBytecodeCacheAccessor::enable(cache_dir);
+
+	// Nothing is cached yet, the script is compiled and its bytecode stored.
+	Ref<GDScript> script = compile_bytecode_cache_test_script(BYTECODE_CACHE_TEST_SOURCE);
+	CHECK(run_bytecode_cache_test_script(script) == 42);
+
+	String cache_path;
+	{
+		GDScriptBytecodeCache cache;
+		REQUIRE(cache.open(script.ptr()));
+		cache_path = TestGDScriptBytecodeCacheAccessor::get_cache_path(cache);
+	}
+	CHECK_MESSAGE(FileAccess::exists(cache_path), "Compiling the script should write its bytecode to the cache.");
+
+	SUBCASE("Unchanged scripts hit the cache") {
+		GDScriptBytecodeCache cache;
+		REQUIRE(cache.open(script.ptr()));
+		CHECK(TestGDScriptBytecodeCacheAccessor::has_cached_function(cache, script.ptr(), "get_value"));
+
+		// Compiling the script again uses the cached bytecode, which must behave the same.
+		release_bytecode_cache_test_script(script);
+		script = compile_bytecode_cache_test_script(BYTECODE_CACHE_TEST_SOURCE);
+		CHECK(run_bytecode_cache_test_script(script) == 42);
+	}
+
+	SUBCASE("Scripts missing from the cache are compiled normally") {
+		REQUIRE(DirAccess::remove_absolute(cache_path) == OK);
+
+		GDScriptBytecodeCache cache;
+		REQUIRE(cache.open(script.ptr()));
+		CHECK(TestGDScriptBytecodeCacheAccessor::get_cached_function_count(cache) == 0);
+		CHECK(cache.get_function(script.ptr(), "get_value") == nullptr);
+	}
+
+	SUBCASE("Changing the source invalidates the cache") {
+		const String changed_source = String(BYTECODE_CACHE_TEST_SOURCE).replace("42", "24");
+		{
+			Ref<GDScript> changed_script;
+			changed_script.instantiate();
+			changed_script->set_source_code(changed_source);
+			changed_script->set_path_cache(BYTECODE_CACHE_TEST_PATH);
+
+			GDScriptBytecodeCache cache;
+			REQUIRE(cache.open(changed_script.ptr()));
+			CHECK(TestGDScriptBytecodeCacheAccessor::get_cached_function_count(cache) == 0);
+			CHECK(cache.get_function(changed_script.ptr(), "get_value") == nullptr);
+		}
+
+		release_bytecode_cache_test_script(script);
+		script = compile_bytecode_cache_test_script(changed_source);
+		CHECK_MESSAGE(run_bytecode_cache_test_script(script) == 24, "The stale bytecode shouldn't be used.");
+	}
+
+	SUBCASE("Changing the globals invalidates the cache") {
+		// Global indices are embedded in the bytecode, adding one changes the fingerprint.
+		GDScriptLanguage::get_singleton()->add_global_constant("_GDSCRIPT_BYTECODE_CACHE_TEST_GLOBAL", 1);
+
+		GDScriptBytecodeCache cache;
+		REQUIRE(cache.open(script.ptr()));
+		CHECK(TestGDScriptBytecodeCacheAccessor::get_cached_function_count(cache) == 0);
+		CHECK(cache.get_function(script.ptr(), "get_value") == nullptr);
+	}
+
+	release_bytecode_cache_test_script(script);
+	TestGDScriptBytecodeCacheAccessor::disable();
+	if (FileAccess::exists(cache_path)) {
+		DirAccess::remove_absolute(cache_path);
+	}
+}
+
+} // namespace GDScriptTests
@@ -0,0 +1,108 @@
+/**************************************************************************/
+/*  test_gdscript_sampling_profiler.h                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#ifdef DEBUG_ENABLED
+
+#include "../gdscript.h"
+#include "../gdscript_cache.h"
+#include "../gdscript_sampling_profiler.h"
+
+#include "tests/test_macros.h"
+
+namespace GDScriptTests {
+
+TEST_CASE("[Modules][GDScript] Sampling profiler reports the sampled call stacks") {
+	const String path = "res://gdscript_sampling_profiler_test.gd";
+
+	// `inner()` spins long enough for the profiler thread to take many samples of the same stack.
+	Ref<GDScript> script;
+	script.instantiate();
+	script->set_source_code(R"(
+extends RefCounted
+
+func outer():
+	return inner()
+
+func inner():
+	var begin = Time.get_ticks_msec()
+	var iterations = 0
+	while Time.get_ticks_msec() - begin < 200:
+		iterations += 1
+	return iterations
+)");
+	script->set_path_cache(path);
+	ERR_PRINT_OFF;
+	const Error err = script->reload();
+	ERR_PRINT_ON;
+	REQUIRE_MESSAGE(err == OK, "The script should compile successfully.");
+
+	Ref<RefCounted> ref_counted;
+	ref_counted.instantiate();
+	ref_counted->set_script(script);
+
+	GDScriptSamplingProfiler::clear();
+	GDScriptSamplingProfiler::start(1000);
+	CHECK(GDScriptSamplingProfiler::is_running());
+	CHECK(int(ref_counted->call("outer")) > 0);
+	GDScriptSamplingProfiler::stop();
+	CHECK_FALSE(GDScriptSamplingProfiler::is_running());
+
+	CHECK(GDScriptSamplingProfiler::get_sample_count() > 0);
+
+	// Frames go from the root to the leaf, and native calls made by the leaf follow it.
+	const String expected_stack = vformat("Main Thread;outer (%s);inner (%s)", path, path);
+	uint64_t expected_stack_samples = 0;
+	const Vector<String> lines = GDScriptSamplingProfiler::get_collapsed_stacks().split("\n", false);
+	for (const String &line : lines) {
+		const int separator = line.rfind_char(' ');
+		const String stack = line.substr(0, separator);
+		const String count = line.substr(separator + 1);
+		CHECK_MESSAGE(count.is_valid_int(), vformat("Each stack should end with its sample count: \"%s\".", line));
+		CHECK_MESSAGE(stack.begins_with("Main Thread;"), vformat("Only the main thread runs scripts: \"%s\".", line));
+		if (stack == expected_stack || stack.begins_with(expected_stack + ";Time::")) {
+			expected_stack_samples += count.to_int();
+		}
+	}
+	CHECK_MESSAGE(expected_stack_samples > 0, "The stack of the running function should have been sampled.");
+
+	GDScriptSamplingProfiler::clear();
+	CHECK(GDScriptSamplingProfiler::get_sample_count() == 0);
+	CHECK(GDScriptSamplingProfiler::get_collapsed_stacks().is_empty());
+
+	ref_counted->set_script(Variant());
+	script.unref();
+	GDScriptCache::remove_script(path);
+}
+
+} // namespace GDScriptTests
+
+#endif // DEBUG_ENABLED
@@ -112,6 +112,21 @@ void GodotArea2D::set_area_monitor_callback(const Callable &p_callback) {
 	}
 }
 
+void GodotArea2D::set_monitor_batch_callback(const Callable &p_callback) {
+	_unregister_shapes();
+
+	monitor_batch_callback = p_callback;
+
+	monitored_bodies.clear();
+	monitored_areas.clear();
+
+	_shape_changed();
+
+	if (!moved_list.in_list() && get_space()) {
+		get_space()->area_add_to_moved_list(&moved_list);
+	}
+}
+
 void GodotArea2D::_set_space_override_mode(PhysicsServer2D::AreaSpaceOverrideMode &r_mode, PhysicsServer2D::AreaSpaceOverrideMode p_new_mode) {
 	bool do_override = p_new_mode != PhysicsServer2D::AREA_SPACE_OVERRIDE_DISABLED;
 	if (do_override == (r_mode != PhysicsServer2D::AREA_SPACE_OVERRIDE_DISABLED)) {
@@ -202,7 +217,73 @@ void GodotArea2D::set_monitorable(bool p_monitorable) {
 	_shapes_changed();
 }
 
+PackedInt64Array GodotArea2D::_pack_monitor_events(HashMap<BodyKey, BodyState, BodyKey> &r_monitored) {
+	PackedInt64Array events;
+	if (r_monitored.is_empty()) {
+		return events;
+	}
+
+	events.resize(r_monitored.size() * PhysicsServer2D::AREA_MONITOR_EVENT_SIZE);
+	int64_t *w = events.ptrw();
+	int event_count = 0;
+
+	for (const KeyValue<BodyKey, BodyState> &E : r_monitored) {
+		if (E.value.state == 0) { // Nothing happened
+			continue;
+		}
+
+		// Same order as the arguments of the monitor callbacks. The RID is stored as its raw ID, which `rid_from_int64()` decodes.
+		w[0] = E.value.state > 0 ? PhysicsServer2D::AREA_BODY_ADDED : PhysicsServer2D::AREA_BODY_REMOVED;
+		w[1] = E.key.rid.get_id();
+		w[2] = (int64_t)(uint64_t)E.key.instance_id;
+		w[3] = E.key.body_shape;
+		w[4] = E.key.area_shape;
+		w += PhysicsServer2D::AREA_MONITOR_EVENT_SIZE;
+		event_count++;
+	}
+
+	r_monitored.clear();
+	events.resize(event_count * PhysicsServer2D::AREA_MONITOR_EVENT_SIZE);
+
+	return events;
+}
+
+void GodotArea2D::_call_batch_queries() {
+	if (monitored_bodies.is_empty() && monitored_areas.is_empty()) {
+		return;
+	}
+
+	if (!monitor_batch_callback.is_valid()) {
+		monitored_bodies.clear();
+		monitored_areas.clear();
+		monitor_batch_callback = Callable();
+		return;
+	}
+
+	PackedInt64Array body_events = _pack_monitor_events(monitored_bodies);
+	PackedInt64Array area_events = _pack_monitor_events(monitored_areas);
+	if (body_events.is_empty() && area_events.is_empty()) {
+		return;
+	}
+
+	Variant res[2] = { body_events, area_events };
+	const Variant *resptr[2] = { &res[0], &res[1] };
+
+	Callable::CallError ce;
+	Variant ret;
+	monitor_batch_callback.callp(resptr, 2, ret, ce);
+
+	if (ce.error != Callable::CallError::CALL_OK) {
+		ERR_PRINT_ONCE("Error calling event callback method " + Variant::get_callable_error_text(monitor_batch_callback, resptr, 2, ce));
+	}
+}
+
 void GodotArea2D::call_queries() {
+	if (!monitor_batch_callback.is_null()) {
+		_call_batch_queries();
+		return;
+	}
+
 	if (!monitor_callback.is_null() && !monitored_bodies.is_empty()) {
 		if (monitor_callback.is_valid()) {
 			Variant res[5];
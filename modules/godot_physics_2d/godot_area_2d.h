@@ -57,6 +57,9 @@ class GodotArea2D : public GodotCollisionObject2D {
 
 	Callable area_monitor_callback;
 
+	// Replaces both monitor callbacks with a single call per step.
+	Callable monitor_batch_callback;
+
 	SelfList<GodotArea2D> monitor_query_list;
 	SelfList<GodotArea2D> moved_list;
 
@@ -96,14 +99,19 @@ class GodotArea2D : public GodotCollisionObject2D {
 	virtual void _shapes_changed() override;
 	void _queue_monitor_update();
 
+	static PackedInt64Array _pack_monitor_events(HashMap<BodyKey, BodyState, BodyKey> &r_monitored);
+	void _call_batch_queries();
+
 	void _set_space_override_mode(PhysicsServer2D::AreaSpaceOverrideMode &r_mode, PhysicsServer2D::AreaSpaceOverrideMode p_new_mode);
 
 public:
 	void set_monitor_callback(const Callable &p_callback);
-	_FORCE_INLINE_ bool has_monitor_callback() const { return monitor_callback.is_valid(); }
+	_FORCE_INLINE_ bool has_monitor_callback() const { return monitor_callback.is_valid() || monitor_batch_callback.is_valid(); }
 
 	void set_area_monitor_callback(const Callable &p_callback);
-	_FORCE_INLINE_ bool has_area_monitor_callback() const { return area_monitor_callback.is_valid(); }
+	_FORCE_INLINE_ bool has_area_monitor_callback() const { return area_monitor_callback.is_valid() || monitor_batch_callback.is_valid(); }
+
+	void set_monitor_batch_callback(const Callable &p_callback);
 
 	_FORCE_INLINE_ void add_body_to_query(GodotBody2D *p_body, uint32_t p_body_shape, uint32_t p_area_shape);
 	_FORCE_INLINE_ void remove_body_from_query(GodotBody2D *p_body, uint32_t p_body_shape, uint32_t p_area_shape);
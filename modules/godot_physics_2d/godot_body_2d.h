@@ -139,6 +139,7 @@ class GodotBody2D : public GodotCollisionObject2D {
 	int contact_count = 0;
 
 	Callable body_state_callback;
+	bool state_sync_batched = false;
 
 	struct ForceIntegrationCallbackData {
 		Callable callable;
@@ -156,7 +157,22 @@ class GodotBody2D : public GodotCollisionObject2D {
 	friend class GodotPhysicsDirectBodyState2D; // i give up, too many functions to expose
 
 public:
+	// Simulated state saved and restored by `GodotSpace2D::save_state()`/`restore_state()`.
+	struct Snapshot {
+		Transform2D transform;
+		Transform2D new_transform;
+		Vector2 linear_velocity;
+		real_t angular_velocity = 0.0;
+		real_t still_time = 0.0;
+	};
+
+	void get_snapshot(Snapshot &r_snapshot) const;
+	void restore_snapshot(const Snapshot &p_snapshot);
+
 	void set_state_sync_callback(const Callable &p_callable);
+	_FORCE_INLINE_ void set_state_sync_batched(bool p_batched) { state_sync_batched = p_batched; }
+	_FORCE_INLINE_ bool is_state_sync_batched() const { return state_sync_batched; }
+	void get_state_sync(PhysicsServer2D::BodyStateSync &r_state) const;
 	void set_force_integration_callback(const Callable &p_callable, const Variant &p_udata = Variant());
 
 	GodotPhysicsDirectBodyState2D *get_direct_state();
@@ -331,7 +347,7 @@ public:
 		return Vector2();
 	}
 
-	void call_queries();
+	void call_queries(bool p_state_synced = false);
 	void wakeup_neighbours();
 
 	bool sleep_test(real_t p_step);
@@ -89,10 +89,28 @@ class GodotBodyPair2D : public GodotConstraint2D {
 	_FORCE_INLINE_ void _contact_added_callback(const Vector2 &p_point_A, const Vector2 &p_point_B);
 
 public:
+	// Contacts kept between steps for warm starting, saved and restored with the space.
+	struct Snapshot {
+		Contact contacts[MAX_CONTACTS];
+		Vector2 sep_axis;
+		int contact_count = 0;
+		bool collided = false;
+	};
+
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
 
+	virtual bool is_body_pair() const override { return true; }
+
+	_FORCE_INLINE_ GodotBody2D *get_body_A() const { return A; }
+	_FORCE_INLINE_ GodotBody2D *get_body_B() const { return B; }
+	_FORCE_INLINE_ int get_shape_A() const { return shape_A; }
+	_FORCE_INLINE_ int get_shape_B() const { return shape_B; }
+
+	void get_snapshot(Snapshot &r_snapshot) const;
+	void restore_snapshot(const Snapshot &p_snapshot);
+
 	GodotBodyPair2D(GodotBody2D *p_A, int p_shape_A, GodotBody2D *p_B, int p_shape_B);
 	~GodotBodyPair2D();
 };
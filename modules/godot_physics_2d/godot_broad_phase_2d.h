@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/math/rect2.h"
+#include "core/templates/local_vector.h"
 
 class GodotCollisionObject2D;
 
@@ -56,6 +57,9 @@ public:
 	virtual int get_subindex(ID p_id) const = 0;
 
 	virtual int cull_segment(const Vector2 &p_from, const Vector2 &p_to, GodotCollisionObject2D **p_results, int p_max_results, int *p_result_indices = nullptr) = 0;
+	// Unlocked cull_segment() for queries running on several threads at once, while nothing modifies
+	// the broadphase. `r_scratch` holds the intermediate results, and must not be shared between threads.
+	virtual int cull_segment_concurrent(const Vector2 &p_from, const Vector2 &p_to, GodotCollisionObject2D **p_results, int p_max_results, LocalVector<uint32_t> &r_scratch, int *p_result_indices = nullptr) = 0;
 	virtual int cull_aabb(const Rect2 &p_aabb, GodotCollisionObject2D **p_results, int p_max_results, int *p_result_indices = nullptr) = 0;
 
 	virtual void set_pair_callback(PairCallback p_pair_callback, void *p_userdata) = 0;
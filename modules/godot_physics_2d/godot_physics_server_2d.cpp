@@ -275,6 +275,22 @@ int GodotPhysicsServer2D::space_get_contact_count(RID p_space) const {
 	return space->get_debug_contact_count();
 }
 
+PackedByteArray GodotPhysicsServer2D::space_save_state(RID p_space) const {
+	const GodotSpace2D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, PackedByteArray());
+	ERR_FAIL_COND_V_MSG(space->is_locked(), PackedByteArray(), "Space state can't be saved while the space is being stepped.");
+
+	return space->save_state();
+}
+
+bool GodotPhysicsServer2D::space_restore_state(RID p_space, const PackedByteArray &p_state) {
+	GodotSpace2D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, false);
+	ERR_FAIL_COND_V_MSG(space->is_locked() || flushing_queries, false, "Space state can't be restored while the space is being stepped or flushing queries. Use call_deferred() instead.");
+
+	return space->restore_state(p_state);
+}
+
 PhysicsDirectSpaceState2D *GodotPhysicsServer2D::space_get_direct_state(RID p_space) {
 	GodotSpace2D *space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL_V(space, nullptr);
@@ -526,6 +542,13 @@ void GodotPhysicsServer2D::area_set_area_monitor_callback(RID p_area, const Call
 	area->set_area_monitor_callback(p_callback.is_valid() ? p_callback : Callable());
 }
 
+void GodotPhysicsServer2D::area_set_monitor_batch_callback(RID p_area, const Callable &p_callback) {
+	GodotArea2D *area = area_owner.get_or_null(p_area);
+	ERR_FAIL_NULL(area);
+
+	area->set_monitor_batch_callback(p_callback.is_valid() ? p_callback : Callable());
+}
+
 /* BODY API */
 
 RID GodotPhysicsServer2D::body_create() {
@@ -976,6 +999,12 @@ void GodotPhysicsServer2D::body_set_force_integration_callback(RID p_body, const
 	body->set_force_integration_callback(p_callable, p_udata);
 }
 
+void GodotPhysicsServer2D::body_set_state_sync_batched(RID p_body, bool p_batched) {
+	GodotBody2D *body = body_owner.get_or_null(p_body);
+	ERR_FAIL_NULL(body);
+	body->set_state_sync_batched(p_batched);
+}
+
 bool GodotPhysicsServer2D::body_collide_shape(RID p_body, int p_body_shape, RID p_shape, const Transform2D &p_shape_xform, const Vector2 &p_motion, Vector2 *r_results, int p_result_max, int &r_result_count) {
 	GodotBody2D *body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_V(body, false);
@@ -1291,17 +1320,27 @@ void GodotPhysicsServer2D::step(real_t p_step) {
 		return;
 	}
 
+	uint64_t time_beg = OS::get_singleton()->get_ticks_usec();
+
 	_update_shapes();
 
 	island_count = 0;
 	active_objects = 0;
 	collision_pairs = 0;
+	for (int i = 0; i <= GodotSpace2D::ELAPSED_TIME_INTEGRATE_VELOCITIES; i++) {
+		elapsed_time[i] = 0;
+	}
 	for (GodotSpace2D *E : active_spaces) {
 		stepper->step(E, p_step);
 		island_count += E->get_island_count();
 		active_objects += E->get_active_objects();
 		collision_pairs += E->get_collision_pairs();
+		for (int i = 0; i <= GodotSpace2D::ELAPSED_TIME_INTEGRATE_VELOCITIES; i++) {
+			elapsed_time[i] += E->get_elapsed_time(GodotSpace2D::ElapsedTime(i));
+		}
 	}
+
+	step_time = OS::get_singleton()->get_ticks_usec() - time_beg;
 }
 
 void GodotPhysicsServer2D::sync() {
@@ -1317,8 +1356,12 @@ void GodotPhysicsServer2D::flush_queries() {
 
 	uint64_t time_beg = OS::get_singleton()->get_ticks_usec();
 
+	elapsed_time[GodotSpace2D::ELAPSED_TIME_STATE_CALLBACKS] = 0;
+	elapsed_time[GodotSpace2D::ELAPSED_TIME_AREA_QUERIES] = 0;
 	for (GodotSpace2D *E : active_spaces) {
 		E->call_queries();
+		elapsed_time[GodotSpace2D::ELAPSED_TIME_STATE_CALLBACKS] += E->get_elapsed_time(GodotSpace2D::ELAPSED_TIME_STATE_CALLBACKS);
+		elapsed_time[GodotSpace2D::ELAPSED_TIME_AREA_QUERIES] += E->get_elapsed_time(GodotSpace2D::ELAPSED_TIME_AREA_QUERIES);
 	}
 
 	flushing_queries = false;
@@ -1327,10 +1370,14 @@ void GodotPhysicsServer2D::flush_queries() {
 		uint64_t total_time[GodotSpace2D::ELAPSED_TIME_MAX];
 		static const char *time_name[GodotSpace2D::ELAPSED_TIME_MAX] = {
 			"integrate_forces",
+			"broadphase",
 			"generate_islands",
 			"setup_constraints",
+			"pre_solve_constraints",
 			"solve_constraints",
-			"integrate_velocities"
+			"integrate_velocities",
+			"state_callbacks",
+			"area_queries"
 		};
 
 		for (int i = 0; i < GodotSpace2D::ELAPSED_TIME_MAX; i++) {
@@ -1355,6 +1402,9 @@ void GodotPhysicsServer2D::flush_queries() {
 		values.push_front("physics_2d");
 		EngineDebugger::profiler_add_frame_data("servers", values);
 	}
+
+	// Recorded here, so the history pairs each step with the time spent on its callbacks.
+	_record_process_info();
 }
 
 void GodotPhysicsServer2D::end_sync() {
@@ -1383,6 +1433,35 @@ int GodotPhysicsServer2D::get_process_info(ProcessInfo p_info) {
 		case INFO_ISLAND_COUNT: {
 			return island_count;
 		} break;
+		case INFO_STEP_TIME: {
+			return step_time;
+		} break;
+		case INFO_BROADPHASE_TIME: {
+			return elapsed_time[GodotSpace2D::ELAPSED_TIME_BROADPHASE];
+		} break;
+		case INFO_NARROWPHASE_TIME: {
+			return elapsed_time[GodotSpace2D::ELAPSED_TIME_SETUP_CONSTRAINTS];
+		} break;
+		case INFO_ISLAND_GENERATION_TIME: {
+			return elapsed_time[GodotSpace2D::ELAPSED_TIME_GENERATE_ISLANDS];
+		} break;
+		case INFO_CONSTRAINT_SETUP_TIME: {
+			return elapsed_time[GodotSpace2D::ELAPSED_TIME_PRE_SOLVE_CONSTRAINTS];
+		} break;
+		case INFO_CONSTRAINT_SOLVE_TIME: {
+			return elapsed_time[GodotSpace2D::ELAPSED_TIME_SOLVE_CONSTRAINTS];
+		} break;
+		case INFO_INTEGRATION_TIME: {
+			return elapsed_time[GodotSpace2D::ELAPSED_TIME_INTEGRATE_FORCES] + elapsed_time[GodotSpace2D::ELAPSED_TIME_INTEGRATE_VELOCITIES];
+		} break;
+		case INFO_AREA_QUERY_TIME: {
+			return elapsed_time[GodotSpace2D::ELAPSED_TIME_AREA_QUERIES];
+		} break;
+		case INFO_CALLBACK_TIME: {
+			return elapsed_time[GodotSpace2D::ELAPSED_TIME_STATE_CALLBACKS];
+		} break;
+		case INFO_MAX: {
+		} break;
 	}
 
 	return 0;
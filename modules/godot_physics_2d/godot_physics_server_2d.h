@@ -50,6 +50,10 @@ class GodotPhysicsServer2D : public PhysicsServer2D {
 	int active_objects = 0;
 	int collision_pairs = 0;
 
+	// Summed over the active spaces, in microseconds.
+	uint64_t step_time = 0;
+	uint64_t elapsed_time[GodotSpace2D::ELAPSED_TIME_MAX] = {};
+
 	bool using_threads = false;
 
 	bool flushing_queries = false;
@@ -115,6 +119,9 @@ public:
 	virtual Vector<Vector2> space_get_contacts(RID p_space) const override;
 	virtual int space_get_contact_count(RID p_space) const override;
 
+	virtual PackedByteArray space_save_state(RID p_space) const override;
+	virtual bool space_restore_state(RID p_space, const PackedByteArray &p_state) override;
+
 	// this function only works on physics process, errors and returns null otherwise
 	virtual PhysicsDirectSpaceState2D *space_get_direct_state(RID p_space) override;
 
@@ -159,6 +166,7 @@ public:
 
 	virtual void area_set_monitor_callback(RID p_area, const Callable &p_callback) override;
 	virtual void area_set_area_monitor_callback(RID p_area, const Callable &p_callback) override;
+	virtual void area_set_monitor_batch_callback(RID p_area, const Callable &p_callback) override;
 
 	virtual void area_set_pickable(RID p_area, bool p_pickable) override;
 
@@ -248,6 +256,7 @@ public:
 
 	virtual void body_set_state_sync_callback(RID p_body, const Callable &p_callable) override;
 	virtual void body_set_force_integration_callback(RID p_body, const Callable &p_callable, const Variant &p_udata = Variant()) override;
+	virtual void body_set_state_sync_batched(RID p_body, bool p_batched) override;
 
 	virtual bool body_collide_shape(RID p_body, int p_body_shape, RID p_shape, const Transform2D &p_shape_xform, const Vector2 &p_motion, Vector2 *r_results, int p_result_max, int &r_result_count) override;
 
@@ -36,10 +36,16 @@
 #include "godot_physics_server_2d.h"
 
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
 
 #define TEST_MOTION_MARGIN_MIN_VALUE 0.0001
+#define RAY_BATCH_CHUNK_SIZE 64
 #define TEST_MOTION_MIN_CONTACT_DEPTH_FACTOR 0.05
 
+#define SPACE_STATE_MAGIC 0x32535047 // "GPS2"
+#define SPACE_STATE_VERSION 2
+
 _FORCE_INLINE_ static bool _can_collide_with(GodotCollisionObject2D *p_object, uint32_t p_collision_mask, bool p_collide_with_bodies, bool p_collide_with_areas) {
 	if (!(p_object->get_collision_layer() & p_collision_mask)) {
 		return false;
@@ -118,13 +124,63 @@ int GodotPhysicsDirectSpaceState2D::intersect_point(const PointParameters &p_par
 bool GodotPhysicsDirectSpaceState2D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
 	ERR_FAIL_COND_V(space->locked, false);
 
+	return _intersect_ray(p_parameters, p_parameters.from, p_parameters.to, r_result, space->intersection_query_results, space->intersection_query_subindex_results);
+}
+
+void GodotPhysicsDirectSpaceState2D::intersect_rays(const RayParameters &p_parameters, const Vector2 *p_from, const Vector2 *p_to, int p_count, RayResult *r_results, bool *r_hits) {
+	ERR_FAIL_COND(space->locked);
+
+	if (p_count <= RAY_BATCH_CHUNK_SIZE) {
+		for (int i = 0; i < p_count; i++) {
+			r_hits[i] = _intersect_ray(p_parameters, p_from[i], p_to[i], r_results[i], space->intersection_query_results, space->intersection_query_subindex_results);
+		}
+		return;
+	}
+
+	RayBatch batch;
+	batch.parameters = &p_parameters;
+	batch.from = p_from;
+	batch.to = p_to;
+	batch.count = p_count;
+	batch.results = r_results;
+	batch.hits = r_hits;
+
+	// Consecutive rays usually start close to each other, so each task gets a contiguous
+	// chunk of them to keep the traversed broadphase nodes and shapes in its cache.
+	const int chunk_count = (p_count + RAY_BATCH_CHUNK_SIZE - 1) / RAY_BATCH_CHUNK_SIZE;
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotPhysicsDirectSpaceState2D::_intersect_ray_chunk, (const RayBatch *)&batch, chunk_count, -1, true, SNAME("Physics2DIntersectRays"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
+void GodotPhysicsDirectSpaceState2D::_intersect_ray_chunk(uint32_t p_chunk, const RayBatch *p_batch) {
+	// The space's query buffers are shared, so each chunk needs its own. Nothing can modify the
+	// broadphase until all chunks are done, so it's culled without locking.
+	LocalVector<GodotCollisionObject2D *> query_results;
+	query_results.resize(GodotSpace2D::INTERSECTION_QUERY_MAX);
+	LocalVector<int> query_subindex_results;
+	query_subindex_results.resize(GodotSpace2D::INTERSECTION_QUERY_MAX);
+	LocalVector<uint32_t> broadphase_scratch;
+
+	const int begin = p_chunk * RAY_BATCH_CHUNK_SIZE;
+	const int end = MIN(begin + RAY_BATCH_CHUNK_SIZE, p_batch->count);
+	for (int i = begin; i < end; i++) {
+		p_batch->hits[i] = _intersect_ray(*p_batch->parameters, p_batch->from[i], p_batch->to[i], p_batch->results[i], query_results.ptr(), query_subindex_results.ptr(), &broadphase_scratch);
+	}
+}
+
+bool GodotPhysicsDirectSpaceState2D::_intersect_ray(const RayParameters &p_parameters, const Vector2 &p_from, const Vector2 &p_to, RayResult &r_result, GodotCollisionObject2D **r_query_results, int *r_query_subindex_results, LocalVector<uint32_t> *r_broadphase_scratch) const {
 	Vector2 begin, end;
 	Vector2 normal;
-	begin = p_parameters.from;
-	end = p_parameters.to;
+	begin = p_from;
+	end = p_to;
 	normal = (end - begin).normalized();
 
-	int amount = space->broadphase->cull_segment(begin, end, space->intersection_query_results, GodotSpace2D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+	int amount;
+	if (r_broadphase_scratch) {
+		amount = space->broadphase->cull_segment_concurrent(begin, end, r_query_results, GodotSpace2D::INTERSECTION_QUERY_MAX, *r_broadphase_scratch, r_query_subindex_results);
+	} else {
+		amount = space->broadphase->cull_segment(begin, end, r_query_results, GodotSpace2D::INTERSECTION_QUERY_MAX, r_query_subindex_results);
+	}
 
 	//todo, create another array that references results, compute AABBs and check closest point to ray origin, sort, and stop evaluating results when beyond first collision
 
@@ -135,17 +191,17 @@ bool GodotPhysicsDirectSpaceState2D::intersect_ray(const RayParameters &p_parame
 	real_t min_d = 1e10;
 
 	for (int i = 0; i < amount; i++) {
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+		if (!_can_collide_with(r_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(r_query_results[i]->get_self())) {
 			continue;
 		}
 
-		const GodotCollisionObject2D *col_obj = space->intersection_query_results[i];
+		const GodotCollisionObject2D *col_obj = r_query_results[i];
 
-		int shape_idx = space->intersection_query_subindex_results[i];
+		int shape_idx = r_query_subindex_results[i];
 		Transform2D inv_xform = col_obj->get_shape_inv_transform(shape_idx) * col_obj->get_inv_transform();
 
 		Vector2 local_from = inv_xform.xform(begin);
@@ -1118,17 +1174,42 @@ const SelfList<GodotArea2D>::List &GodotSpace2D::get_moved_area_list() const {
 }
 
 void GodotSpace2D::call_queries() {
+	uint64_t profile_begtime = OS::get_singleton()->get_ticks_usec();
+
+	PhysicsServer2D::BodyStateSyncBatchCallback state_sync_batch_callback = PhysicsServer2D::get_body_state_sync_batch_callback();
+
 	while (state_query_list.first()) {
 		GodotBody2D *b = state_query_list.first()->self();
 		state_query_list.remove(state_query_list.first());
-		b->call_queries();
+
+		bool state_synced = false;
+		if (state_sync_batch_callback && b->is_state_sync_batched()) {
+			state_sync_batch.resize(state_sync_batch.size() + 1);
+			b->get_state_sync(state_sync_batch[state_sync_batch.size() - 1]);
+			state_synced = true;
+		}
+
+		b->call_queries(state_synced);
 	}
 
+	// Batched bodies are synced after the force integration and state sync callbacks of all the other bodies,
+	// but still before the area callbacks run.
+	if (!state_sync_batch.is_empty()) {
+		state_sync_batch_callback(state_sync_batch.ptr(), state_sync_batch.size());
+		state_sync_batch.clear();
+	}
+
+	uint64_t profile_endtime = OS::get_singleton()->get_ticks_usec();
+	elapsed_time[ELAPSED_TIME_STATE_CALLBACKS] = profile_endtime - profile_begtime;
+	profile_begtime = profile_endtime;
+
 	while (monitor_query_list.first()) {
 		GodotArea2D *a = monitor_query_list.first()->self();
 		monitor_query_list.remove(monitor_query_list.first());
 		a->call_queries();
 	}
+
+	elapsed_time[ELAPSED_TIME_AREA_QUERIES] = OS::get_singleton()->get_ticks_usec() - profile_begtime;
 }
 
 void GodotSpace2D::setup() {
@@ -1216,6 +1297,281 @@ GodotPhysicsDirectSpaceState2D *GodotSpace2D::get_direct_state() {
 	return direct_access;
 }
 
+struct GodotSpaceStateHeader2D {
+	uint32_t magic = SPACE_STATE_MAGIC;
+	uint32_t version = SPACE_STATE_VERSION;
+	uint32_t real_size = sizeof(real_t);
+	uint32_t body_count = 0;
+	uint32_t pair_count = 0;
+	uint32_t constraint_count = 0;
+};
+
+struct GodotSpaceBodyState2D {
+	uint64_t body_id = 0;
+	GodotBody2D::Snapshot snapshot;
+	uint32_t active = 0;
+	uint32_t constraint_count = 0; // Entries of the constraint order saved for this body.
+};
+
+struct GodotSpacePairKey2D {
+	uint64_t body_A_id = 0;
+	uint64_t body_B_id = 0;
+	int32_t shape_A = 0;
+	int32_t shape_B = 0;
+
+	static uint32_t hash(const GodotSpacePairKey2D &p_key) {
+		uint32_t h = hash_murmur3_one_64(p_key.body_A_id);
+		h = hash_murmur3_one_64(p_key.body_B_id, h);
+		h = hash_murmur3_one_32(p_key.shape_A, h);
+		h = hash_murmur3_one_32(p_key.shape_B, h);
+		return hash_fmix32(h);
+	}
+
+	bool operator==(const GodotSpacePairKey2D &p_key) const {
+		return body_A_id == p_key.body_A_id && body_B_id == p_key.body_B_id && shape_A == p_key.shape_A && shape_B == p_key.shape_B;
+	}
+
+	GodotSpacePairKey2D() {}
+	GodotSpacePairKey2D(const GodotBodyPair2D *p_pair) {
+		body_A_id = p_pair->get_body_A()->get_self().get_id();
+		body_B_id = p_pair->get_body_B()->get_self().get_id();
+		shape_A = p_pair->get_shape_A();
+		shape_B = p_pair->get_shape_B();
+	}
+};
+
+struct GodotSpacePairState2D {
+	GodotSpacePairKey2D key;
+	GodotBodyPair2D::Snapshot snapshot;
+};
+
+// A constraint in the order of a body's constraint list, which is the order the step solves them in.
+struct GodotSpaceConstraintState2D {
+	uint64_t joint_id = 0;
+	uint32_t pair_index = UINT32_MAX; // Index in the saved pairs, for body pairs.
+	uint32_t reserved = 0;
+};
+
+PackedByteArray GodotSpace2D::save_state() const {
+	// Active bodies go first, in the order the step iterates them, so it can be rebuilt on restore.
+	LocalVector<GodotBody2D *> bodies;
+	for (const SelfList<GodotBody2D> *E = active_list.first(); E; E = E->next()) {
+		bodies.push_back(E->self());
+	}
+	for (GodotCollisionObject2D *object : objects) {
+		if (object->get_type() == GodotCollisionObject2D::TYPE_BODY && !static_cast<GodotBody2D *>(object)->is_active()) {
+			bodies.push_back(static_cast<GodotBody2D *>(object));
+		}
+	}
+
+	LocalVector<GodotBodyPair2D *> pairs;
+	HashMap<const GodotConstraint2D *, uint32_t> pair_indices;
+	for (GodotBody2D *body : bodies) {
+		for (const Pair<GodotConstraint2D *, int> &E : body->get_constraint_list()) {
+			// Each pair is listed by both of its bodies, only keep it once.
+			if (E.second == 0 && E.first->is_body_pair()) {
+				pair_indices.insert(E.first, pairs.size());
+				pairs.push_back(static_cast<GodotBodyPair2D *>(E.first));
+			}
+		}
+	}
+
+	LocalVector<GodotSpaceConstraintState2D> constraints;
+	LocalVector<uint32_t> body_constraint_counts;
+	for (GodotBody2D *body : bodies) {
+		uint32_t from = constraints.size();
+		for (const Pair<GodotConstraint2D *, int> &E : body->get_constraint_list()) {
+			GodotSpaceConstraintState2D constraint_state;
+			if (E.first->is_body_pair()) {
+				constraint_state.pair_index = pair_indices[E.first];
+			} else if (E.first->get_self().is_valid()) {
+				constraint_state.joint_id = E.first->get_self().get_id();
+			} else {
+				continue; // Area pairs aren't solved, so their order doesn't matter.
+			}
+			constraints.push_back(constraint_state);
+		}
+		body_constraint_counts.push_back(constraints.size() - from);
+	}
+
+	GodotSpaceStateHeader2D header;
+	header.body_count = bodies.size();
+	header.pair_count = pairs.size();
+	header.constraint_count = constraints.size();
+
+	PackedByteArray state;
+	state.resize(sizeof(GodotSpaceStateHeader2D) + bodies.size() * sizeof(GodotSpaceBodyState2D) + pairs.size() * sizeof(GodotSpacePairState2D) + constraints.size() * sizeof(GodotSpaceConstraintState2D));
+	uint8_t *w = state.ptrw();
+
+	memcpy(w, &header, sizeof(GodotSpaceStateHeader2D));
+	w += sizeof(GodotSpaceStateHeader2D);
+
+	for (uint32_t i = 0; i < bodies.size(); i++) {
+		// Cleared first, so the padding between members is saved as zeros and equal states give equal bytes.
+		GodotSpaceBodyState2D body_state;
+		memset((void *)&body_state, 0, sizeof(GodotSpaceBodyState2D));
+		body_state.body_id = bodies[i]->get_self().get_id();
+		bodies[i]->get_snapshot(body_state.snapshot);
+		body_state.active = bodies[i]->is_active();
+		body_state.constraint_count = body_constraint_counts[i];
+		memcpy(w, &body_state, sizeof(GodotSpaceBodyState2D));
+		w += sizeof(GodotSpaceBodyState2D);
+	}
+
+	for (const GodotBodyPair2D *pair : pairs) {
+		GodotSpacePairState2D pair_state;
+		memset((void *)&pair_state, 0, sizeof(GodotSpacePairState2D));
+		pair_state.key = GodotSpacePairKey2D(pair);
+		pair->get_snapshot(pair_state.snapshot);
+		memcpy(w, &pair_state, sizeof(GodotSpacePairState2D));
+		w += sizeof(GodotSpacePairState2D);
+	}
+
+	if (!constraints.is_empty()) {
+		memcpy(w, constraints.ptr(), constraints.size() * sizeof(GodotSpaceConstraintState2D));
+	}
+
+	return state;
+}
+
+bool GodotSpace2D::restore_state(const PackedByteArray &p_state) {
+	ERR_FAIL_COND_V(p_state.size() < (int64_t)sizeof(GodotSpaceStateHeader2D), false);
+	const uint8_t *r = p_state.ptr();
+
+	GodotSpaceStateHeader2D header;
+	memcpy(&header, r, sizeof(GodotSpaceStateHeader2D));
+	r += sizeof(GodotSpaceStateHeader2D);
+
+	ERR_FAIL_COND_V_MSG(header.magic != SPACE_STATE_MAGIC || header.version != SPACE_STATE_VERSION, false, "Invalid space state.");
+	ERR_FAIL_COND_V_MSG(header.real_size != sizeof(real_t), false, "Space state was saved by a build using a different floating-point precision.");
+	ERR_FAIL_COND_V(uint64_t(p_state.size()) != sizeof(GodotSpaceStateHeader2D) + uint64_t(header.body_count) * sizeof(GodotSpaceBodyState2D) + uint64_t(header.pair_count) * sizeof(GodotSpacePairState2D) + uint64_t(header.constraint_count) * sizeof(GodotSpaceConstraintState2D), false);
+
+	HashMap<uint64_t, GodotBody2D *> bodies;
+	for (GodotCollisionObject2D *object : objects) {
+		if (object->get_type() == GodotCollisionObject2D::TYPE_BODY) {
+			bodies.insert(object->get_self().get_id(), static_cast<GodotBody2D *>(object));
+		}
+	}
+
+	// Bodies freed since the state was saved are skipped, bodies added since then are left as they are.
+	LocalVector<GodotBody2D *> saved_bodies;
+	LocalVector<uint32_t> saved_constraint_counts;
+	LocalVector<GodotBody2D *> active_bodies;
+	for (uint32_t i = 0; i < header.body_count; i++) {
+		GodotSpaceBodyState2D body_state;
+		memcpy((void *)&body_state, r, sizeof(GodotSpaceBodyState2D));
+		r += sizeof(GodotSpaceBodyState2D);
+
+		GodotBody2D **body = bodies.getptr(body_state.body_id);
+		saved_bodies.push_back(body ? *body : nullptr);
+		saved_constraint_counts.push_back(body_state.constraint_count);
+		if (!body) {
+			continue;
+		}
+		(*body)->restore_snapshot(body_state.snapshot);
+		(*body)->set_active(false);
+		if (body_state.active) {
+			active_bodies.push_back(*body);
+		}
+	}
+
+	// Bodies are prepended to the active list, so add them back in reverse to get the saved order.
+	for (int64_t i = int64_t(active_bodies.size()) - 1; i >= 0; i--) {
+		active_bodies[i]->set_active(true);
+	}
+
+	// Pair the restored shapes now. The saved contacts are matched against the pairs overlapping in the
+	// restored state, not the ones left by whatever happened since the state was saved.
+	broadphase->update();
+
+	// Pairs which didn't exist when the state was saved start over without contacts, like new pairs do.
+	HashMap<GodotSpacePairKey2D, GodotBodyPair2D *, GodotSpacePairKey2D> pairs;
+	HashMap<uint64_t, GodotConstraint2D *> joints;
+	for (const KeyValue<uint64_t, GodotBody2D *> &E : bodies) {
+		for (const Pair<GodotConstraint2D *, int> &F : E.value->get_constraint_list()) {
+			if (!F.first->is_body_pair()) {
+				if (F.first->get_self().is_valid()) {
+					joints.insert(F.first->get_self().get_id(), F.first);
+				}
+				continue;
+			}
+			if (F.second != 0) {
+				continue;
+			}
+			GodotBodyPair2D *pair = static_cast<GodotBodyPair2D *>(F.first);
+			pair->restore_snapshot(GodotBodyPair2D::Snapshot());
+			pairs.insert(GodotSpacePairKey2D(pair), pair);
+		}
+	}
+
+	LocalVector<GodotConstraint2D *> saved_pairs;
+	for (uint32_t i = 0; i < header.pair_count; i++) {
+		GodotSpacePairState2D pair_state;
+		memcpy((void *)&pair_state, r, sizeof(GodotSpacePairState2D));
+		r += sizeof(GodotSpacePairState2D);
+
+		GodotBodyPair2D **pair = pairs.getptr(pair_state.key);
+		if (pair) {
+			(*pair)->restore_snapshot(pair_state.snapshot);
+		}
+		saved_pairs.push_back(pair ? *pair : nullptr);
+	}
+
+	// Constraint lists are ordered by when each constraint was created, which depends on what happened
+	// since the state was saved. Put back the saved order, so the step solves them as it would have.
+	// Constraints created since then follow, in their current order.
+	uint32_t constraint_from = 0;
+	for (uint32_t i = 0; i < saved_bodies.size(); i++) {
+		uint32_t constraint_count = MIN(saved_constraint_counts[i], header.constraint_count - constraint_from);
+		const uint8_t *body_constraints = r + constraint_from * sizeof(GodotSpaceConstraintState2D);
+		constraint_from += constraint_count;
+
+		GodotBody2D *body = saved_bodies[i];
+		if (!body) {
+			continue;
+		}
+
+		HashSet<GodotConstraint2D *> remaining;
+		for (const Pair<GodotConstraint2D *, int> &E : body->get_constraint_list()) {
+			remaining.insert(E.first);
+		}
+		LocalVector<Pair<GodotConstraint2D *, int>> ordered;
+		for (uint32_t j = 0; j < constraint_count; j++) {
+			GodotSpaceConstraintState2D constraint_state;
+			memcpy((void *)&constraint_state, body_constraints + j * sizeof(GodotSpaceConstraintState2D), sizeof(GodotSpaceConstraintState2D));
+
+			GodotConstraint2D *constraint = nullptr;
+			if (constraint_state.pair_index != UINT32_MAX) {
+				constraint = constraint_state.pair_index < saved_pairs.size() ? saved_pairs[constraint_state.pair_index] : nullptr;
+			} else {
+				GodotConstraint2D **joint = joints.getptr(constraint_state.joint_id);
+				constraint = joint ? *joint : nullptr;
+			}
+
+			if (constraint && remaining.erase(constraint)) {
+				for (const Pair<GodotConstraint2D *, int> &E : body->get_constraint_list()) {
+					if (E.first == constraint) {
+						ordered.push_back(E);
+						break;
+					}
+				}
+			}
+		}
+		for (const Pair<GodotConstraint2D *, int> &E : body->get_constraint_list()) {
+			if (remaining.has(E.first)) {
+				ordered.push_back(E);
+			}
+		}
+
+		body->clear_constraint_list();
+		for (const Pair<GodotConstraint2D *, int> &E : ordered) {
+			body->add_constraint(E.first, E.second);
+		}
+	}
+
+	return true;
+}
+
 GodotSpace2D::GodotSpace2D() {
 	body_linear_velocity_sleep_threshold = GLOBAL_GET("physics/2d/sleep_threshold_linear");
 	body_angular_velocity_sleep_threshold = GLOBAL_GET("physics/2d/sleep_threshold_angular");
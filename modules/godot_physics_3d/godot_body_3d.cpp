@@ -759,7 +759,20 @@ void GodotBody3D::wakeup_neighbours() {
 	}
 }
 
-void GodotBody3D::call_queries() {
+void GodotBody3D::get_state_sync(PhysicsServer3D::BodyStateSync &r_state) const {
+	r_state.instance_id = get_instance_id();
+	r_state.transform = get_transform();
+	r_state.linear_velocity = linear_velocity;
+	r_state.angular_velocity = angular_velocity;
+	r_state.inverse_inertia_tensor = _inv_inertia_tensor;
+	r_state.sleeping = !active;
+}
+
+void GodotBody3D::call_queries(bool p_state_synced) {
+	if (p_state_synced && !fi_callback_data) {
+		return;
+	}
+
 	Variant direct_state_variant = get_direct_state();
 
 	if (fi_callback_data) {
@@ -775,7 +788,7 @@ void GodotBody3D::call_queries() {
 		}
 	}
 
-	if (body_state_callback.is_valid()) {
+	if (!p_state_synced && body_state_callback.is_valid()) {
 		body_state_callback.call(direct_state_variant);
 	}
 }
@@ -824,6 +837,38 @@ GodotPhysicsDirectBodyState3D *GodotBody3D::get_direct_state() {
 	return direct_state;
 }
 
+void GodotBody3D::get_snapshot(Snapshot &r_snapshot) const {
+	r_snapshot.transform = get_transform();
+	r_snapshot.new_transform = new_transform;
+	r_snapshot.linear_velocity = linear_velocity;
+	r_snapshot.angular_velocity = angular_velocity;
+	r_snapshot.still_time = still_time;
+}
+
+void GodotBody3D::restore_snapshot(const Snapshot &p_snapshot) {
+	// Unlike `set_state()`, this doesn't touch the constant velocities nor wake up neighbours,
+	// since the whole space is restored at once.
+	_set_transform(p_snapshot.transform);
+	if (mode >= PhysicsServer3D::BODY_MODE_RIGID) {
+		_set_inv_transform(get_transform().inverse());
+		_update_transform_dependent();
+	} else {
+		_set_inv_transform(get_transform().affine_inverse());
+	}
+	new_transform = p_snapshot.new_transform;
+
+	linear_velocity = p_snapshot.linear_velocity;
+	angular_velocity = p_snapshot.angular_velocity;
+	biased_linear_velocity = Vector3();
+	biased_angular_velocity = Vector3();
+	still_time = p_snapshot.still_time;
+
+	if (get_space() && (fi_callback_data || body_state_callback.is_valid())) {
+		// Report the restored transform on the next sync, even if the body is sleeping.
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+	}
+}
+
 GodotBody3D::GodotBody3D() :
 		GodotCollisionObject3D(TYPE_BODY),
 		active_list(this),
@@ -133,6 +133,7 @@ class GodotBody3D : public GodotCollisionObject3D {
 	int contact_count = 0;
 
 	Callable body_state_callback;
+	bool state_sync_batched = false;
 
 	struct ForceIntegrationCallbackData {
 		Callable callable;
@@ -150,7 +151,22 @@ class GodotBody3D : public GodotCollisionObject3D {
 	friend class GodotPhysicsDirectBodyState3D; // i give up, too many functions to expose
 
 public:
+	// Simulated state saved and restored by `GodotSpace3D::save_state()`/`restore_state()`.
+	struct Snapshot {
+		Transform3D transform;
+		Transform3D new_transform;
+		Vector3 linear_velocity;
+		Vector3 angular_velocity;
+		real_t still_time = 0.0;
+	};
+
+	void get_snapshot(Snapshot &r_snapshot) const;
+	void restore_snapshot(const Snapshot &p_snapshot);
+
 	void set_state_sync_callback(const Callable &p_callable);
+	_FORCE_INLINE_ void set_state_sync_batched(bool p_batched) { state_sync_batched = p_batched; }
+	_FORCE_INLINE_ bool is_state_sync_batched() const { return state_sync_batched; }
+	void get_state_sync(PhysicsServer3D::BodyStateSync &r_state) const;
 	void set_force_integration_callback(const Callable &p_callable, const Variant &p_udata = Variant());
 
 	GodotPhysicsDirectBodyState3D *get_direct_state();
@@ -338,7 +354,7 @@ public:
 	}
 
 	//void simulate_motion(const Transform3D& p_xform,real_t p_step);
-	void call_queries();
+	void call_queries(bool p_state_synced = false);
 	void wakeup_neighbours();
 
 	bool sleep_test(real_t p_step);
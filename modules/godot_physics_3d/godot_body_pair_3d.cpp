@@ -597,6 +597,25 @@ void GodotBodyPair3D::solve(real_t p_step) {
 	}
 }
 
+void GodotBodyPair3D::get_snapshot(Snapshot &r_snapshot) const {
+	for (int i = 0; i < contact_count; i++) {
+		r_snapshot.contacts[i] = contacts[i];
+	}
+	r_snapshot.sep_axis = sep_axis;
+	r_snapshot.contact_count = contact_count;
+	r_snapshot.collided = collided;
+}
+
+void GodotBodyPair3D::restore_snapshot(const Snapshot &p_snapshot) {
+	ERR_FAIL_INDEX(p_snapshot.contact_count, MAX_CONTACTS + 1);
+	for (int i = 0; i < p_snapshot.contact_count; i++) {
+		contacts[i] = p_snapshot.contacts[i];
+	}
+	sep_axis = p_snapshot.sep_axis;
+	contact_count = p_snapshot.contact_count;
+	collided = p_snapshot.collided;
+}
+
 GodotBodyPair3D::GodotBodyPair3D(GodotBody3D *p_A, int p_shape_A, GodotBody3D *p_B, int p_shape_B) :
 		GodotBodyContact3D(_arr, 2) {
 	A = p_A;
@@ -106,6 +106,13 @@ void GodotPhysicsServer3D::shape_set_data(RID p_shape, const Variant &p_data) {
 	GodotShape3D *shape = shape_owner.get_or_null(p_shape);
 	ERR_FAIL_NULL(shape);
 	shape->set_data(p_data);
+
+	if (shape->get_type() == SHAPE_CONCAVE_POLYGON) {
+		GodotConcavePolygonShape3D *concave_shape = static_cast<GodotConcavePolygonShape3D *>(shape);
+		if (concave_shape->is_build_pending() && !concave_shape->get_pending_build_list()->in_list()) {
+			pending_shape_build_list.add(concave_shape->get_pending_build_list());
+		}
+	}
 }
 
 void GodotPhysicsServer3D::shape_set_custom_solver_bias(RID p_shape, real_t p_bias) {
@@ -214,6 +221,22 @@ int GodotPhysicsServer3D::space_get_contact_count(RID p_space) const {
 	return space->get_debug_contact_count();
 }
 
+PackedByteArray GodotPhysicsServer3D::space_save_state(RID p_space) const {
+	const GodotSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, PackedByteArray());
+	ERR_FAIL_COND_V_MSG(space->is_locked(), PackedByteArray(), "Space state can't be saved while the space is being stepped.");
+
+	return space->save_state();
+}
+
+bool GodotPhysicsServer3D::space_restore_state(RID p_space, const PackedByteArray &p_state) {
+	GodotSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, false);
+	ERR_FAIL_COND_V_MSG(space->is_locked() || flushing_queries, false, "Space state can't be restored while the space is being stepped or flushing queries. Use call_deferred() instead.");
+
+	return space->restore_state(p_state);
+}
+
 RID GodotPhysicsServer3D::area_create() {
 	GodotArea3D *area = memnew(GodotArea3D);
 	RID rid = area_owner.make_rid(area);
@@ -931,6 +954,12 @@ void GodotPhysicsServer3D::body_set_force_integration_callback(RID p_body, const
 	body->set_force_integration_callback(p_callable, p_udata);
 }
 
+void GodotPhysicsServer3D::body_set_state_sync_batched(RID p_body, bool p_batched) {
+	GodotBody3D *body = body_owner.get_or_null(p_body);
+	ERR_FAIL_NULL(body);
+	body->set_state_sync_batched(p_batched);
+}
+
 void GodotPhysicsServer3D::body_set_ray_pickable(RID p_body, bool p_enable) {
 	GodotBody3D *body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
@@ -1672,21 +1701,34 @@ void GodotPhysicsServer3D::init() {
 }
 
 void GodotPhysicsServer3D::step(real_t p_step) {
+	// Shapes are swapped in even when inactive, so queries in the editor see them too.
+	_finish_shape_builds();
+
 	if (!active) {
 		return;
 	}
 
+	uint64_t time_beg = OS::get_singleton()->get_ticks_usec();
+
 	_update_shapes();
 
 	island_count = 0;
 	active_objects = 0;
 	collision_pairs = 0;
+	for (int i = 0; i <= GodotSpace3D::ELAPSED_TIME_INTEGRATE_VELOCITIES; i++) {
+		elapsed_time[i] = 0;
+	}
 	for (GodotSpace3D *E : active_spaces) {
 		stepper->step(E, p_step);
 		island_count += E->get_island_count();
 		active_objects += E->get_active_objects();
 		collision_pairs += E->get_collision_pairs();
+		for (int i = 0; i <= GodotSpace3D::ELAPSED_TIME_INTEGRATE_VELOCITIES; i++) {
+			elapsed_time[i] += E->get_elapsed_time(GodotSpace3D::ElapsedTime(i));
+		}
 	}
+
+	step_time = OS::get_singleton()->get_ticks_usec() - time_beg;
 }
 
 void GodotPhysicsServer3D::sync() {
@@ -1702,9 +1744,13 @@ void GodotPhysicsServer3D::flush_queries() {
 
 	uint64_t time_beg = OS::get_singleton()->get_ticks_usec();
 
+	elapsed_time[GodotSpace3D::ELAPSED_TIME_STATE_CALLBACKS] = 0;
+	elapsed_time[GodotSpace3D::ELAPSED_TIME_AREA_QUERIES] = 0;
 	for (GodotSpace3D *E : active_spaces) {
 		GodotSpace3D *space = E;
 		space->call_queries();
+		elapsed_time[GodotSpace3D::ELAPSED_TIME_STATE_CALLBACKS] += space->get_elapsed_time(GodotSpace3D::ELAPSED_TIME_STATE_CALLBACKS);
+		elapsed_time[GodotSpace3D::ELAPSED_TIME_AREA_QUERIES] += space->get_elapsed_time(GodotSpace3D::ELAPSED_TIME_AREA_QUERIES);
 	}
 
 	flushing_queries = false;
@@ -1713,10 +1759,14 @@ void GodotPhysicsServer3D::flush_queries() {
 		uint64_t total_time[GodotSpace3D::ELAPSED_TIME_MAX];
 		static const char *time_name[GodotSpace3D::ELAPSED_TIME_MAX] = {
 			"integrate_forces",
+			"broadphase",
 			"generate_islands",
 			"setup_constraints",
+			"pre_solve_constraints",
 			"solve_constraints",
-			"integrate_velocities"
+			"integrate_velocities",
+			"state_callbacks",
+			"area_queries"
 		};
 
 		for (int i = 0; i < GodotSpace3D::ELAPSED_TIME_MAX; i++) {
@@ -1741,6 +1791,9 @@ void GodotPhysicsServer3D::flush_queries() {
 		values.push_front("physics_3d");
 		EngineDebugger::profiler_add_frame_data("servers", values);
 	}
+
+	// Recorded here, so the history pairs each step with the time spent on its callbacks.
+	_record_process_info();
 }
 
 void GodotPhysicsServer3D::end_sync() {
@@ -1762,6 +1815,39 @@ int GodotPhysicsServer3D::get_process_info(ProcessInfo p_info) {
 		case INFO_ISLAND_COUNT: {
 			return island_count;
 		} break;
+		case INFO_STEP_TIME: {
+			return step_time;
+		} break;
+		case INFO_BROADPHASE_TIME: {
+			return elapsed_time[GodotSpace3D::ELAPSED_TIME_BROADPHASE];
+		} break;
+		case INFO_NARROWPHASE_TIME: {
+			return elapsed_time[GodotSpace3D::ELAPSED_TIME_SETUP_CONSTRAINTS];
+		} break;
+		case INFO_ISLAND_GENERATION_TIME: {
+			return elapsed_time[GodotSpace3D::ELAPSED_TIME_GENERATE_ISLANDS];
+		} break;
+		case INFO_CONSTRAINT_SETUP_TIME: {
+			return elapsed_time[GodotSpace3D::ELAPSED_TIME_PRE_SOLVE_CONSTRAINTS];
+		} break;
+		case INFO_CONSTRAINT_SOLVE_TIME: {
+			return elapsed_time[GodotSpace3D::ELAPSED_TIME_SOLVE_CONSTRAINTS];
+		} break;
+		case INFO_INTEGRATION_TIME: {
+			return elapsed_time[GodotSpace3D::ELAPSED_TIME_INTEGRATE_FORCES] + elapsed_time[GodotSpace3D::ELAPSED_TIME_INTEGRATE_VELOCITIES];
+		} break;
+		case INFO_AREA_QUERY_TIME: {
+			return elapsed_time[GodotSpace3D::ELAPSED_TIME_AREA_QUERIES];
+		} break;
+		case INFO_CALLBACK_TIME: {
+			return elapsed_time[GodotSpace3D::ELAPSED_TIME_STATE_CALLBACKS];
+		} break;
+		case INFO_JOB_COUNT: {
+			// Work is split into WorkerThreadPool group tasks directly, there are no jobs to count.
+			return 0;
+		} break;
+		case INFO_MAX: {
+		} break;
 	}
 
 	return 0;
@@ -1774,6 +1860,17 @@ void GodotPhysicsServer3D::_update_shapes() {
 	}
 }
 
+void GodotPhysicsServer3D::_finish_shape_builds() {
+	SelfList<GodotConcavePolygonShape3D> *E = pending_shape_build_list.first();
+	while (E) {
+		SelfList<GodotConcavePolygonShape3D> *next = E->next();
+		if (E->self()->finish_build()) {
+			pending_shape_build_list.remove(E);
+		}
+		E = next;
+	}
+}
+
 void GodotPhysicsServer3D::_shape_col_cbk(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal, void *p_userdata) {
 	CollCbkData *cbk = static_cast<CollCbkData *>(p_userdata);
 
@@ -48,6 +48,10 @@ class GodotPhysicsServer3D : public PhysicsServer3D {
 	int active_objects = 0;
 	int collision_pairs = 0;
 
+	// Summed over the active spaces, in microseconds.
+	uint64_t step_time = 0;
+	uint64_t elapsed_time[GodotSpace3D::ELAPSED_TIME_MAX] = {};
+
 	bool using_threads = false;
 	bool doing_sync = false;
 	bool flushing_queries = false;
@@ -67,6 +71,9 @@ class GodotPhysicsServer3D : public PhysicsServer3D {
 	SelfList<GodotCollisionObject3D>::List pending_shape_update_list;
 	void _update_shapes();
 
+	SelfList<GodotConcavePolygonShape3D>::List pending_shape_build_list;
+	void _finish_shape_builds();
+
 	static GodotPhysicsServer3D *godot_singleton;
 
 public:
@@ -116,6 +123,9 @@ public:
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const override;
 	virtual int space_get_contact_count(RID p_space) const override;
 
+	virtual PackedByteArray space_save_state(RID p_space) const override;
+	virtual bool space_restore_state(RID p_space, const PackedByteArray &p_state) override;
+
 	/* AREA API */
 
 	virtual RID area_create() override;
@@ -251,6 +261,7 @@ public:
 
 	virtual void body_set_state_sync_callback(RID p_body, const Callable &p_callable) override;
 	virtual void body_set_force_integration_callback(RID p_body, const Callable &p_callable, const Variant &p_udata = Variant()) override;
+	virtual void body_set_state_sync_batched(RID p_body, bool p_batched) override;
 
 	virtual void body_set_ray_pickable(RID p_body, bool p_enable) override;
 
@@ -1270,6 +1270,10 @@ GodotFaceShape3D::GodotFaceShape3D() {
 }
 
 Vector<Vector3> GodotConcavePolygonShape3D::get_faces() const {
+	if (pending_build) {
+		return pending_build->source_faces;
+	}
+
 	Vector<Vector3> rfaces;
 	rfaces.resize(faces.size() * 3);
 
@@ -1333,12 +1337,12 @@ Vector3 GodotConcavePolygonShape3D::get_support(const Vector3 &p_normal) const {
 void GodotConcavePolygonShape3D::_cull_segment(int p_idx, _SegmentCullParams *p_params) const {
 	const BVH *params_bvh = &p_params->bvh[p_idx];
 
-	if (!params_bvh->aabb.intersects_segment(p_params->from, p_params->to)) {
+	if (!_get_bvh_aabb(*params_bvh).intersects_segment(p_params->from, p_params->to)) {
 		return;
 	}
 
-	if (params_bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[params_bvh->face_index];
+	if (params_bvh->index < 0) {
+		const Face *f = &p_params->faces[~params_bvh->index];
 		GodotFaceShape3D *face = p_params->face;
 		face->normal = f->normal;
 		face->vertex[0] = p_params->vertices[f->indices[0]];
@@ -1347,7 +1351,7 @@ void GodotConcavePolygonShape3D::_cull_segment(int p_idx, _SegmentCullParams *p_
 
 		Vector3 res;
 		Vector3 normal;
-		int face_index = params_bvh->face_index;
+		int face_index = ~params_bvh->index;
 		if (face->intersect_segment(p_params->from, p_params->to, res, normal, face_index, true)) {
 			real_t d = p_params->dir.dot(res) - p_params->dir.dot(p_params->from);
 			if ((d > 0) && (d < p_params->min_d)) {
@@ -1359,12 +1363,8 @@ void GodotConcavePolygonShape3D::_cull_segment(int p_idx, _SegmentCullParams *p_
 			}
 		}
 	} else {
-		if (params_bvh->left >= 0) {
-			_cull_segment(params_bvh->left, p_params);
-		}
-		if (params_bvh->right >= 0) {
-			_cull_segment(params_bvh->right, p_params);
-		}
+		_cull_segment(p_idx + 1, p_params);
+		_cull_segment(params_bvh->index, p_params);
 	}
 }
 
@@ -1416,12 +1416,12 @@ Vector3 GodotConcavePolygonShape3D::get_closest_point_to(const Vector3 &p_point)
 bool GodotConcavePolygonShape3D::_cull(int p_idx, _CullParams *p_params) const {
 	const BVH *params_bvh = &p_params->bvh[p_idx];
 
-	if (!p_params->aabb.intersects(params_bvh->aabb)) {
+	if (!params_bvh->intersects(p_params->min, p_params->max)) {
 		return false;
 	}
 
-	if (params_bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[params_bvh->face_index];
+	if (params_bvh->index < 0) {
+		const Face *f = &p_params->faces[~params_bvh->index];
 		GodotFaceShape3D *face = p_params->face;
 		face->normal = f->normal;
 		face->vertex[0] = p_params->vertices[f->indices[0]];
@@ -1431,16 +1431,12 @@ bool GodotConcavePolygonShape3D::_cull(int p_idx, _CullParams *p_params) const {
 			return true;
 		}
 	} else {
-		if (params_bvh->left >= 0) {
-			if (_cull(params_bvh->left, p_params)) {
-				return true;
-			}
+		if (_cull(p_idx + 1, p_params)) {
+			return true;
 		}
 
-		if (params_bvh->right >= 0) {
-			if (_cull(params_bvh->right, p_params)) {
-				return true;
-			}
+		if (_cull(params_bvh->index, p_params)) {
+			return true;
 		}
 	}
 
@@ -1454,6 +1450,9 @@ void GodotConcavePolygonShape3D::cull(const AABB &p_local_aabb, QueryCallback p_
 	}
 
 	AABB local_aabb = p_local_aabb;
+	if (!local_aabb.intersects(_get_bvh_aabb(bvh[0]))) {
+		return;
+	}
 
 	// unlock data
 	const Face *fr = faces.ptr();
@@ -1466,6 +1465,14 @@ void GodotConcavePolygonShape3D::cull(const AABB &p_local_aabb, QueryCallback p_
 
 	_CullParams params;
 	params.aabb = local_aabb;
+
+	// Quantize the query bounds the same way as the nodes, so they can be tested directly.
+	Vector3 quantized_min = ((local_aabb.position - bvh_origin) * bvh_scale).floor();
+	Vector3 quantized_max = ((local_aabb.get_end() - bvh_origin) * bvh_scale).ceil();
+	for (int i = 0; i < 3; i++) {
+		params.min[i] = (uint16_t)CLAMP(quantized_min[i], (real_t)0.0, BVH_QUANTIZATION_MAX);
+		params.max[i] = (uint16_t)CLAMP(quantized_max[i], (real_t)0.0, BVH_QUANTIZATION_MAX);
+	}
 	params.face = &face;
 	params.faces = fr;
 	params.vertices = vr;
@@ -1568,54 +1575,48 @@ _Volume_BVH *_volume_build_bvh(_Volume_BVH_Element *p_elements, int p_size, int
 	return bvh;
 }
 
-void GodotConcavePolygonShape3D::_fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx) {
+void GodotConcavePolygonShape3D::_fill_bvh(_Volume_BVH *p_bvh_tree, BuildData *p_data, int &p_idx) {
 	int idx = p_idx;
 
-	p_bvh_array[idx].aabb = p_bvh_tree->aabb;
-	p_bvh_array[idx].face_index = p_bvh_tree->face_index;
-	//printf("%p - %i: %i(%p)  -- %p:%p\n",%p_bvh_array[idx],p_idx,p_bvh_array[i]->face_index,&p_bvh_tree->face_index,p_bvh_tree->left,p_bvh_tree->right);
+	BVH &node = p_data->bvh.write[idx];
 
-	if (p_bvh_tree->left) {
-		p_bvh_array[idx].left = ++p_idx;
-		_fill_bvh(p_bvh_tree->left, p_bvh_array, p_idx);
-
-	} else {
-		p_bvh_array[p_idx].left = -1;
+	Vector3 quantized_min = ((p_bvh_tree->aabb.position - p_data->bvh_origin) * p_data->bvh_scale).floor();
+	Vector3 quantized_max = ((p_bvh_tree->aabb.get_end() - p_data->bvh_origin) * p_data->bvh_scale).ceil();
+	for (int i = 0; i < 3; i++) {
+		node.min[i] = (uint16_t)CLAMP(quantized_min[i], (real_t)0.0, BVH_QUANTIZATION_MAX);
+		node.max[i] = (uint16_t)CLAMP(quantized_max[i], (real_t)0.0, BVH_QUANTIZATION_MAX);
 	}
 
-	if (p_bvh_tree->right) {
-		p_bvh_array[idx].right = ++p_idx;
-		_fill_bvh(p_bvh_tree->right, p_bvh_array, p_idx);
-
+	if (p_bvh_tree->face_index >= 0) {
+		node.index = ~p_bvh_tree->face_index;
 	} else {
-		p_bvh_array[p_idx].right = -1;
+		// Branches always have both children, the left one is stored right after its parent.
+		++p_idx;
+		_fill_bvh(p_bvh_tree->left, p_data, p_idx);
+
+		p_data->bvh.write[idx].index = ++p_idx;
+		_fill_bvh(p_bvh_tree->right, p_data, p_idx);
 	}
 
 	memdelete(p_bvh_tree);
 }
 
-void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_backface_collision) {
-	int src_face_count = p_faces.size();
-	if (src_face_count == 0) {
-		configure(AABB());
-		return;
-	}
-	ERR_FAIL_COND(src_face_count % 3);
-	src_face_count /= 3;
+void GodotConcavePolygonShape3D::_build(BuildData *p_data) {
+	int src_face_count = p_data->source_faces.size() / 3;
 
-	const Vector3 *facesr = p_faces.ptr();
+	const Vector3 *facesr = p_data->source_faces.ptr();
 
 	Vector<_Volume_BVH_Element> bvh_array;
 	bvh_array.resize(src_face_count);
 
 	_Volume_BVH_Element *bvh_arrayw = bvh_array.ptrw();
 
-	faces.resize(src_face_count);
-	Face *facesw = faces.ptrw();
+	p_data->faces.resize(src_face_count);
+	Face *facesw = p_data->faces.ptrw();
 
-	vertices.resize(src_face_count * 3);
+	p_data->vertices.resize(src_face_count * 3);
 
-	Vector3 *verticesw = vertices.ptrw();
+	Vector3 *verticesw = p_data->vertices.ptrw();
 
 	AABB _aabb;
 
@@ -1639,17 +1640,103 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 		}
 	}
 
+	p_data->aabb = _aabb;
+	p_data->bvh_origin = _aabb.position;
+	for (int i = 0; i < 3; i++) {
+		// Flat axes are quantized to zero.
+		p_data->bvh_scale[i] = _aabb.size[i] > 0.0 ? BVH_QUANTIZATION_MAX / _aabb.size[i] : 0.0;
+		p_data->bvh_inv_scale[i] = _aabb.size[i] / BVH_QUANTIZATION_MAX;
+	}
+
 	int count = 0;
 	_Volume_BVH *bvh_tree = _volume_build_bvh(bvh_arrayw, src_face_count, count);
 
-	bvh.resize(count + 1);
-
-	BVH *bvh_arrayw2 = bvh.ptrw();
+	p_data->bvh.resize(count);
 
 	int idx = 0;
-	_fill_bvh(bvh_tree, bvh_arrayw2, idx);
+	_fill_bvh(bvh_tree, p_data, idx);
+}
+
+void GodotConcavePolygonShape3D::_build_task(void *p_data) {
+	_build((BuildData *)p_data);
+}
+
+void GodotConcavePolygonShape3D::_apply_build(BuildData *p_data) {
+	faces = p_data->faces;
+	vertices = p_data->vertices;
+	bvh = p_data->bvh;
+	bvh_origin = p_data->bvh_origin;
+	bvh_scale = p_data->bvh_scale;
+	bvh_inv_scale = p_data->bvh_inv_scale;
+	backface_collision = p_data->backface_collision;
+}
+
+bool GodotConcavePolygonShape3D::finish_build() {
+	if (!pending_build) {
+		return true;
+	}
+
+	// Keep using the previous mesh until the new one is ready.
+	if (!WorkerThreadPool::get_singleton()->is_task_completed(pending_build_task)) {
+		return false;
+	}
+
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(pending_build_task);
+	pending_build_task = WorkerThreadPool::INVALID_TASK_ID;
+
+	_apply_build(pending_build);
+
+	memdelete(pending_build);
+	pending_build = nullptr;
+
+	return true;
+}
+
+void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_backface_collision) {
+	if (pending_build) {
+		// The previous build can't be cancelled, its result is discarded.
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(pending_build_task);
+		pending_build_task = WorkerThreadPool::INVALID_TASK_ID;
+		memdelete(pending_build);
+		pending_build = nullptr;
+	}
+
+	int src_face_count = p_faces.size();
+	if (src_face_count == 0) {
+		faces.clear();
+		vertices.clear();
+		bvh.clear();
+		configure(AABB());
+		return;
+	}
+	ERR_FAIL_COND(src_face_count % 3);
+	src_face_count /= 3;
+
+	BuildData *data = memnew(BuildData);
+	data->source_faces = p_faces;
+	data->backface_collision = p_backface_collision;
+
+	// Without a previous mesh to keep using in the meantime, queries would find nothing until the
+	// build is swapped in, so the first mesh is always built right away.
+	if (src_face_count < BACKGROUND_BUILD_MIN_FACES || faces.is_empty()) {
+		_build(data);
+		_apply_build(data);
+		AABB _aabb = data->aabb;
+		memdelete(data);
+
+		configure(_aabb); // this type of shape has no margin
+		return;
+	}
 
-	backface_collision = p_backface_collision;
+	pending_build = data;
+	pending_build_task = WorkerThreadPool::get_singleton()->add_native_task(&GodotConcavePolygonShape3D::_build_task, data, false, SNAME("GodotPhysics3DConcaveShapeBuild"));
+
+	// The bounds are needed right away by the owners, and are cheap to compute compared to the BVH.
+	const Vector3 *facesr = p_faces.ptr();
+	AABB _aabb(facesr[0], Vector3());
+	for (int i = 1; i < src_face_count * 3; i++) {
+		_aabb.expand_to(facesr[i]);
+	}
 
 	configure(_aabb); // this type of shape has no margin
 }
@@ -1664,12 +1751,20 @@ void GodotConcavePolygonShape3D::set_data(const Variant &p_data) {
 Variant GodotConcavePolygonShape3D::get_data() const {
 	Dictionary d;
 	d["faces"] = get_faces();
-	d["backface_collision"] = backface_collision;
+	d["backface_collision"] = pending_build ? pending_build->backface_collision : backface_collision;
 
 	return d;
 }
 
-GodotConcavePolygonShape3D::GodotConcavePolygonShape3D() {
+GodotConcavePolygonShape3D::GodotConcavePolygonShape3D() :
+		pending_build_list(this) {
+}
+
+GodotConcavePolygonShape3D::~GodotConcavePolygonShape3D() {
+	if (pending_build) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(pending_build_task);
+		memdelete(pending_build);
+	}
 }
 
 /* HEIGHT MAP SHAPE */
@@ -2074,6 +2169,47 @@ Vector3 GodotHeightMapShape3D::get_moment_of_inertia(real_t p_mass) const {
 			(p_mass / 3.0) * (extents.x * extents.x + extents.y * extents.y));
 }
 
+void GodotHeightMapShape3D::_compute_bounds_chunk(int p_cx, int p_cz) {
+	int z0 = p_cz * BOUNDS_CHUNK_SIZE;
+	int x0 = p_cx * BOUNDS_CHUNK_SIZE;
+
+	Range r;
+
+	r.min = _get_height(x0, z0);
+	r.max = r.min;
+
+	// Compute min and max height for this chunk.
+	// We have to include one extra cell to account for neighbors.
+	// Here is why:
+	// Say we have a flat terrain, and a plateau that fits a chunk perfectly.
+	//
+	//   Left        Right
+	// 0---0---0---1---1---1
+	// |   |   |   |   |   |
+	// 0---0---0---1---1---1
+	// |   |   |   |   |   |
+	// 0---0---0---1---1---1
+	//           x
+	//
+	// If the AABB for the Left chunk did not share vertices with the Right,
+	// then we would fail collision tests at x due to a gap.
+	//
+	int z_max = MIN(z0 + BOUNDS_CHUNK_SIZE + 1, depth);
+	int x_max = MIN(x0 + BOUNDS_CHUNK_SIZE + 1, width);
+	for (int z = z0; z < z_max; ++z) {
+		for (int x = x0; x < x_max; ++x) {
+			real_t height = _get_height(x, z);
+			if (height < r.min) {
+				r.min = height;
+			} else if (height > r.max) {
+				r.max = height;
+			}
+		}
+	}
+
+	bounds_grid[p_cx + p_cz * bounds_grid_width] = r;
+}
+
 void GodotHeightMapShape3D::_build_accelerator() {
 	bounds_grid.clear();
 
@@ -2099,46 +2235,27 @@ void GodotHeightMapShape3D::_build_accelerator() {
 
 	// Compute min and max height for all chunks.
 	for (int cz = 0; cz < bounds_grid_depth; ++cz) {
-		int z0 = cz * BOUNDS_CHUNK_SIZE;
-
 		for (int cx = 0; cx < bounds_grid_width; ++cx) {
-			int x0 = cx * BOUNDS_CHUNK_SIZE;
-
-			Range r;
-
-			r.min = _get_height(x0, z0);
-			r.max = r.min;
-
-			// Compute min and max height for this chunk.
-			// We have to include one extra cell to account for neighbors.
-			// Here is why:
-			// Say we have a flat terrain, and a plateau that fits a chunk perfectly.
-			//
-			//   Left        Right
-			// 0---0---0---1---1---1
-			// |   |   |   |   |   |
-			// 0---0---0---1---1---1
-			// |   |   |   |   |   |
-			// 0---0---0---1---1---1
-			//           x
-			//
-			// If the AABB for the Left chunk did not share vertices with the Right,
-			// then we would fail collision tests at x due to a gap.
-			//
-			int z_max = MIN(z0 + BOUNDS_CHUNK_SIZE + 1, depth);
-			int x_max = MIN(x0 + BOUNDS_CHUNK_SIZE + 1, width);
-			for (int z = z0; z < z_max; ++z) {
-				for (int x = x0; x < x_max; ++x) {
-					real_t height = _get_height(x, z);
-					if (height < r.min) {
-						r.min = height;
-					} else if (height > r.max) {
-						r.max = height;
-					}
-				}
-			}
+			_compute_bounds_chunk(cx, cz);
+		}
+	}
+}
+
+void GodotHeightMapShape3D::_update_accelerator(const Rect2i &p_region) {
+	if (bounds_grid.is_empty()) {
+		return;
+	}
+
+	// Chunks also include the first row and column of their neighbors, so the chunks
+	// ending right before the region need to be updated as well.
+	int cx_begin = MAX(p_region.position.x - 1, 0) / BOUNDS_CHUNK_SIZE;
+	int cz_begin = MAX(p_region.position.y - 1, 0) / BOUNDS_CHUNK_SIZE;
+	int cx_end = MIN((p_region.position.x + p_region.size.x - 1) / BOUNDS_CHUNK_SIZE + 1, bounds_grid_width);
+	int cz_end = MIN((p_region.position.y + p_region.size.y - 1) / BOUNDS_CHUNK_SIZE + 1, bounds_grid_depth);
 
-			bounds_grid[cx + cz * bounds_grid_width] = r;
+	for (int cz = cz_begin; cz < cz_end; ++cz) {
+		for (int cx = cx_begin; cx < cx_end; ++cx) {
+			_compute_bounds_chunk(cx, cz);
 		}
 	}
 }
@@ -2164,6 +2281,23 @@ void GodotHeightMapShape3D::_setup(const Vector<real_t> &p_heights, int p_width,
 	configure(aabb_new);
 }
 
+void GodotHeightMapShape3D::_setup_region(const Rect2i &p_region, const Vector<real_t> &p_heights, real_t p_min_height, real_t p_max_height) {
+	real_t *heights_ptrw = heights.ptrw();
+	const real_t *region_ptr = p_heights.ptr();
+	for (int z = 0; z < p_region.size.y; ++z) {
+		memcpy(&heights_ptrw[(p_region.position.y + z) * width + p_region.position.x], &region_ptr[z * p_region.size.x], p_region.size.x * sizeof(real_t));
+	}
+
+	_update_accelerator(p_region);
+
+	// Only the height range can change, the horizontal extents and origin stay the same.
+	AABB aabb_new = get_aabb();
+	aabb_new.position.y = p_min_height;
+	aabb_new.size.y = p_max_height - p_min_height;
+
+	configure(aabb_new);
+}
+
 void GodotHeightMapShape3D::set_data(const Variant &p_data) {
 	ERR_FAIL_COND(p_data.get_type() != Variant::DICTIONARY);
 
@@ -2217,9 +2351,16 @@ void GodotHeightMapShape3D::set_data(const Variant &p_data) {
 		min_height = d["min_height"];
 		max_height = d["max_height"];
 	} else {
-		int heights_size = heights.size();
+		if (d.has("region")) {
+			// Only the updated region is known here, so the height range can grow but not shrink.
+			min_height = get_aabb().position.y;
+			max_height = get_aabb().position.y + get_aabb().size.y;
+		}
+
+		int heights_size = heights_buffer.size();
+		const real_t *heights_ptr = heights_buffer.ptr();
 		for (int i = 0; i < heights_size; ++i) {
-			real_t h = heights[i];
+			real_t h = heights_ptr[i];
 			if (h < min_height) {
 				min_height = h;
 			} else if (h > max_height) {
@@ -2230,6 +2371,17 @@ void GodotHeightMapShape3D::set_data(const Variant &p_data) {
 
 	ERR_FAIL_COND(min_height > max_height);
 
+	if (d.has("region")) {
+		// Partial update, only the heights inside the region are given.
+		Rect2i region = d["region"];
+		ERR_FAIL_COND_MSG(width_new != width || depth_new != depth, "Heightmap region updates can't change the size of the heightmap.");
+		ERR_FAIL_COND_MSG(region.size.x <= 0 || region.size.y <= 0 || !Rect2i(0, 0, width, depth).encloses(region), "Heightmap update region must be inside the heightmap.");
+		ERR_FAIL_COND(heights_buffer.size() != (region.size.x * region.size.y));
+
+		_setup_region(region, heights_buffer, min_height, max_height);
+		return;
+	}
+
 	ERR_FAIL_COND(heights_buffer.size() != (width_new * depth_new));
 
 	// If specified, min and max height will be used as precomputed values.
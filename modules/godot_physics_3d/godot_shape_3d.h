@@ -31,7 +31,9 @@
 #pragma once
 
 #include "core/math/geometry_3d.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/local_vector.h"
+#include "core/templates/self_list.h"
 #include "servers/physics_3d/physics_server_3d.h"
 
 class GodotShape3D;
@@ -315,18 +317,58 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 	Vector<Face> faces;
 	Vector<Vector3> vertices;
 
+	// Nodes are stored depth first, so the left child of a branch is always the next node.
+	// Bounds are quantized relative to the mesh AABB and rounded outwards.
 	struct BVH {
-		AABB aabb;
-		int left = 0;
-		int right = 0;
-
-		int face_index = 0;
+		uint16_t min[3] = {};
+		uint16_t max[3] = {};
+		int32_t index = 0; // Right child of a branch, or bitwise negated face index of a leaf.
+
+		_FORCE_INLINE_ bool intersects(const uint16_t *p_min, const uint16_t *p_max) const {
+			return min[0] <= p_max[0] && max[0] >= p_min[0] &&
+					min[1] <= p_max[1] && max[1] >= p_min[1] &&
+					min[2] <= p_max[2] && max[2] >= p_min[2];
+		}
 	};
 
+	static constexpr real_t BVH_QUANTIZATION_MAX = 65535.0;
+
 	Vector<BVH> bvh;
+	Vector3 bvh_origin;
+	Vector3 bvh_scale; // Quantized units per unit.
+	Vector3 bvh_inv_scale;
+
+	_FORCE_INLINE_ AABB _get_bvh_aabb(const BVH &p_node) const {
+		Vector3 min(p_node.min[0], p_node.min[1], p_node.min[2]);
+		Vector3 max(p_node.max[0], p_node.max[1], p_node.max[2]);
+		return AABB(bvh_origin + min * bvh_inv_scale, (max - min) * bvh_inv_scale);
+	}
+
+	struct BuildData {
+		Vector<Vector3> source_faces;
+		bool backface_collision = false;
+
+		Vector<Face> faces;
+		Vector<Vector3> vertices;
+		Vector<BVH> bvh;
+		Vector3 bvh_origin;
+		Vector3 bvh_scale;
+		Vector3 bvh_inv_scale;
+		AABB aabb;
+	};
+
+	// Meshes with at least this many faces replacing a previous mesh build their BVH on the WorkerThreadPool.
+	// The previous data stays in use until the physics server swaps the new one in at the start of a step.
+	static const int BACKGROUND_BUILD_MIN_FACES = 4096;
+
+	BuildData *pending_build = nullptr;
+	WorkerThreadPool::TaskID pending_build_task = WorkerThreadPool::INVALID_TASK_ID;
+	SelfList<GodotConcavePolygonShape3D> pending_build_list;
 
 	struct _CullParams {
 		AABB aabb;
+		uint16_t min[3] = {};
+		uint16_t max[3] = {};
 		QueryCallback callback = nullptr;
 		void *userdata = nullptr;
 		const Face *faces = nullptr;
@@ -356,13 +398,20 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 	void _cull_segment(int p_idx, _SegmentCullParams *p_params) const;
 	bool _cull(int p_idx, _CullParams *p_params) const;
 
-	void _fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx);
+	static void _fill_bvh(_Volume_BVH *p_bvh_tree, BuildData *p_data, int &p_idx);
+	static void _build(BuildData *p_data);
+	static void _build_task(void *p_data);
 
+	void _apply_build(BuildData *p_data);
 	void _setup(const Vector<Vector3> &p_faces, bool p_backface_collision);
 
 public:
 	Vector<Vector3> get_faces() const;
 
+	_FORCE_INLINE_ bool is_build_pending() const { return pending_build != nullptr; }
+	_FORCE_INLINE_ SelfList<GodotConcavePolygonShape3D> *get_pending_build_list() { return &pending_build_list; }
+	bool finish_build();
+
 	virtual PhysicsServer3D::ShapeType get_type() const override { return PhysicsServer3D::SHAPE_CONCAVE_POLYGON; }
 
 	virtual void project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const override;
@@ -380,6 +429,7 @@ public:
 	virtual Variant get_data() const override;
 
 	GodotConcavePolygonShape3D();
+	~GodotConcavePolygonShape3D();
 };
 
 struct GodotHeightMapShape3D : public GodotConcaveShape3D {
@@ -415,12 +465,15 @@ struct GodotHeightMapShape3D : public GodotConcaveShape3D {
 
 	void _get_cell(const Vector3 &p_point, int &r_x, int &r_y, int &r_z) const;
 
+	void _compute_bounds_chunk(int p_cx, int p_cz);
 	void _build_accelerator();
+	void _update_accelerator(const Rect2i &p_region);
 
 	template <typename ProcessFunction>
 	bool _intersect_grid_segment(ProcessFunction &p_process, const Vector3 &p_begin, const Vector3 &p_end, int p_width, int p_depth, const Vector3 &offset, Vector3 &r_point, Vector3 &r_normal) const;
 
 	void _setup(const Vector<real_t> &p_heights, int p_width, int p_depth, real_t p_min_height, real_t p_max_height);
+	void _setup_region(const Rect2i &p_region, const Vector<real_t> &p_heights, real_t p_min_height, real_t p_max_height);
 
 public:
 	Vector<real_t> get_heights() const;
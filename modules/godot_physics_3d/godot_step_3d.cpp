@@ -40,6 +40,7 @@
 #define ISLAND_COUNT_RESERVE 128
 #define ISLAND_SIZE_RESERVE 512
 #define CONSTRAINT_COUNT_RESERVE 1024
+#define PARALLEL_CONSTRAINT_COLOR_MIN_SIZE 64
 
 void GodotStep3D::_populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island) {
 	p_body->set_island_step(_step);
@@ -133,6 +134,10 @@ void GodotStep3D::_pre_solve_island(LocalVector<GodotConstraint3D *> &p_constrai
 void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 	LocalVector<GodotConstraint3D *> &constraint_island = constraint_islands[p_island_index];
 
+	if (_is_large_island(constraint_island)) {
+		return; // Solved separately by `_solve_large_island`.
+	}
+
 	int current_priority = 1;
 
 	uint32_t constraint_count = constraint_island.size();
@@ -158,6 +163,101 @@ void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 	}
 }
 
+void GodotStep3D::_color_island(const LocalVector<GodotConstraint3D *> &p_constraint_island) {
+	for (LocalVector<GodotConstraint3D *> &constraint_color : constraint_colors) {
+		constraint_color.clear();
+	}
+	body_colors.clear();
+
+	// Greedily give each constraint the first color not used yet by any of its bodies.
+	// Static and kinematic bodies are only read by the solver, so they can be shared.
+	for (GodotConstraint3D *constraint : p_constraint_island) {
+		uint64_t used_colors = 0;
+
+		for (int i = 0; i < constraint->get_body_count(); i++) {
+			const GodotBody3D *body = constraint->get_body_ptr()[i];
+			if (body->get_mode() <= PhysicsServer3D::BODY_MODE_KINEMATIC) {
+				continue;
+			}
+			const uint64_t *body_used_colors = body_colors.getptr(body);
+			if (body_used_colors) {
+				used_colors |= *body_used_colors;
+			}
+		}
+		for (int i = 0; i < constraint->get_soft_body_count(); i++) {
+			const uint64_t *body_used_colors = body_colors.getptr(constraint->get_soft_body_ptr(i));
+			if (body_used_colors) {
+				used_colors |= *body_used_colors;
+			}
+		}
+
+		uint32_t color = 0;
+		while (color < CONSTRAINT_COLOR_MAX && (used_colors & (uint64_t(1) << color))) {
+			color++;
+		}
+		constraint_colors[color].push_back(constraint);
+
+		if (color == CONSTRAINT_COLOR_MAX) {
+			continue;
+		}
+
+		const uint64_t color_bit = uint64_t(1) << color;
+		for (int i = 0; i < constraint->get_body_count(); i++) {
+			const GodotBody3D *body = constraint->get_body_ptr()[i];
+			if (body->get_mode() > PhysicsServer3D::BODY_MODE_KINEMATIC) {
+				body_colors[body] |= color_bit;
+			}
+		}
+		for (int i = 0; i < constraint->get_soft_body_count(); i++) {
+			body_colors[constraint->get_soft_body_ptr(i)] |= color_bit;
+		}
+	}
+}
+
+void GodotStep3D::_solve_colored_constraint(uint32_t p_constraint_index, LocalVector<GodotConstraint3D *> *p_constraints) {
+	(*p_constraints)[p_constraint_index]->solve(delta);
+}
+
+void GodotStep3D::_solve_large_island(const LocalVector<GodotConstraint3D *> &p_constraint_island) {
+	_color_island(p_constraint_island);
+
+	// Same as `_solve_island`, but going through the constraints one color at a time.
+	int current_priority = 1;
+
+	bool has_constraints = !p_constraint_island.is_empty();
+	while (has_constraints) {
+		for (int i = 0; i < iterations; i++) {
+			for (uint32_t color = 0; color <= CONSTRAINT_COLOR_MAX; color++) {
+				LocalVector<GodotConstraint3D *> &constraint_color = constraint_colors[color];
+				if (color == CONSTRAINT_COLOR_MAX || constraint_color.size() < PARALLEL_CONSTRAINT_COLOR_MIN_SIZE) {
+					for (GodotConstraint3D *constraint : constraint_color) {
+						constraint->solve(delta);
+					}
+				} else {
+					WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_colored_constraint, &constraint_color, constraint_color.size(), -1, true, SNAME("Physics3DConstraintSolveColor"));
+					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+				}
+			}
+		}
+
+		// Check priority to keep only higher priority constraints.
+		++current_priority;
+		has_constraints = false;
+		for (LocalVector<GodotConstraint3D *> &constraint_color : constraint_colors) {
+			uint32_t priority_constraint_count = 0;
+			for (uint32_t constraint_index = 0; constraint_index < constraint_color.size(); ++constraint_index) {
+				GodotConstraint3D *constraint = constraint_color[constraint_index];
+				if (constraint->get_priority() >= current_priority) {
+					// Keep this constraint for the next iteration.
+					constraint_color[priority_constraint_count++] = constraint;
+				}
+			}
+			constraint_color.resize(priority_constraint_count);
+			has_constraints = has_constraints || priority_constraint_count > 0;
+		}
+	}
+}
+
 void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const {
 	bool can_sleep = true;
 
@@ -190,6 +290,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	p_space->set_last_step(p_delta);
 
 	iterations = p_space->get_solver_iterations();
+	large_island_constraint_count = MAX(0, p_space->get_large_island_constraint_count());
 	delta = p_delta;
 
 	const SelfList<GodotBody3D>::List *body_list = &p_space->get_active_body_list();
@@ -221,12 +322,18 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	p_space->set_active_objects(active_count);
 
+	{ //profile
+		profile_endtime = OS::get_singleton()->get_ticks_usec();
+		p_space->set_elapsed_time(GodotSpace3D::ELAPSED_TIME_INTEGRATE_FORCES, profile_endtime - profile_begtime);
+		profile_begtime = profile_endtime;
+	}
+
 	// Update the broadphase to register collision pairs.
 	p_space->update();
 
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
-		p_space->set_elapsed_time(GodotSpace3D::ELAPSED_TIME_INTEGRATE_FORCES, profile_endtime - profile_begtime);
+		p_space->set_elapsed_time(GodotSpace3D::ELAPSED_TIME_BROADPHASE, profile_endtime - profile_begtime);
 		profile_begtime = profile_endtime;
 	}
 
@@ -360,13 +467,33 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 		_pre_solve_island(constraint_islands[island_index]);
 	}
 
+	{ //profile
+		profile_endtime = OS::get_singleton()->get_ticks_usec();
+		p_space->set_elapsed_time(GodotSpace3D::ELAPSED_TIME_PRE_SOLVE_CONSTRAINTS, profile_endtime - profile_begtime);
+		profile_begtime = profile_endtime;
+	}
+
 	/* SOLVE CONSTRAINT ISLANDS */
 
+	// Large islands (typically stacks and piles) would keep a single thread busy for most of the step,
+	// so they are solved afterwards, one at a time, with their constraints spread across threads.
+	// This is done regardless of the thread count, so that the simulation gives the same results on every machine.
+	large_islands.clear();
+	for (uint32_t island_index = 0; island_index < island_count; ++island_index) {
+		if (_is_large_island(constraint_islands[island_index])) {
+			large_islands.push_back(island_index);
+		}
+	}
+
 	// WARNING: `_solve_island` modifies the constraint islands for optimization purpose,
 	// their content is not reliable after these calls and shouldn't be used anymore.
 	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_island, nullptr, island_count, -1, true, SNAME("Physics3DConstraintSolveIslands"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
+	for (uint32_t island_index : large_islands) {
+		_solve_large_island(constraint_islands[island_index]);
+	}
+
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
 		p_space->set_elapsed_time(GodotSpace3D::ELAPSED_TIME_SOLVE_CONSTRAINTS, profile_endtime - profile_begtime);
@@ -32,23 +32,40 @@
 
 #include "godot_space_3d.h"
 
+#include "core/templates/hash_map.h"
 #include "core/templates/local_vector.h"
 
 class GodotStep3D {
 	uint64_t _step = 1;
 
 	int iterations = 0;
+	uint32_t large_island_constraint_count = 0;
 	real_t delta = 0.0;
 
 	LocalVector<LocalVector<GodotBody3D *>> body_islands;
 	LocalVector<LocalVector<GodotConstraint3D *>> constraint_islands;
 	LocalVector<GodotConstraint3D *> all_constraints;
 
+	// Islands with many constraints are split into colors of constraints which don't share
+	// any body the solver modifies, so each color can be solved on several threads.
+	// The last color holds the constraints which couldn't be colored, and is solved serially.
+	enum {
+		CONSTRAINT_COLOR_MAX = 64,
+	};
+
+	LocalVector<uint32_t> large_islands;
+	LocalVector<GodotConstraint3D *> constraint_colors[CONSTRAINT_COLOR_MAX + 1];
+	HashMap<const void *, uint64_t> body_colors;
+
 	void _populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _populate_island_soft_body(GodotSoftBody3D *p_soft_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _setup_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
 	void _pre_solve_island(LocalVector<GodotConstraint3D *> &p_constraint_island) const;
 	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr);
+	_FORCE_INLINE_ bool _is_large_island(const LocalVector<GodotConstraint3D *> &p_constraint_island) const { return large_island_constraint_count > 0 && p_constraint_island.size() >= large_island_constraint_count; }
+	void _color_island(const LocalVector<GodotConstraint3D *> &p_constraint_island);
+	void _solve_large_island(const LocalVector<GodotConstraint3D *> &p_constraint_island);
+	void _solve_colored_constraint(uint32_t p_constraint_index, LocalVector<GodotConstraint3D *> *p_constraints);
 	void _check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const;
 
 public:
@@ -53,6 +53,8 @@
 #include "spaces/jolt_space_3d.h"
 #include "spaces/jolt_temp_allocator.h"
 
+#include "core/os/time.h"
+
 JoltPhysicsServer3D::JoltPhysicsServer3D(bool p_on_separate_thread) :
 		on_separate_thread(p_on_separate_thread) {
 	singleton = this;
@@ -267,6 +269,22 @@ int JoltPhysicsServer3D::space_get_contact_count(RID p_space) const {
 #endif
 }
 
+PackedByteArray JoltPhysicsServer3D::space_save_state(RID p_space) const {
+	JoltSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, PackedByteArray());
+	ERR_FAIL_COND_V_MSG(space->is_stepping(), PackedByteArray(), "Space state can't be saved while the space is being stepped.");
+
+	return space->save_state();
+}
+
+bool JoltPhysicsServer3D::space_restore_state(RID p_space, const PackedByteArray &p_state) {
+	JoltSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, false);
+	ERR_FAIL_COND_V_MSG(space->is_stepping() || flushing_queries, false, "Space state can't be restored while the space is being stepped or flushing queries. Use call_deferred() instead.");
+
+	return space->restore_state(p_state);
+}
+
 RID JoltPhysicsServer3D::area_create() {
 	JoltArea3D *area = memnew(JoltArea3D);
 	RID rid = area_owner.make_rid(area);
@@ -948,6 +966,13 @@ void JoltPhysicsServer3D::body_set_force_integration_callback(RID p_body, const
 	body->set_custom_integration_callback(p_callable, p_userdata);
 }
 
+void JoltPhysicsServer3D::body_set_state_sync_batched(RID p_body, bool p_batched) {
+	JoltBody3D *body = body_owner.get_or_null(p_body);
+	ERR_FAIL_NULL(body);
+
+	body->set_state_sync_batched(p_batched);
+}
+
 void JoltPhysicsServer3D::body_set_ray_pickable(RID p_body, bool p_enable) {
 	JoltBody3D *body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
@@ -1625,13 +1650,33 @@ void JoltPhysicsServer3D::step(real_t p_step) {
 		return;
 	}
 
+	const uint64_t time_beg = Time::get_singleton()->get_ticks_usec();
+
+	for (uint64_t &timing : step_timings) {
+		timing = 0;
+	}
+
 	for (JoltSpace3D *active_space : active_spaces) {
 		job_system->pre_step();
 
 		active_space->step((float)p_step);
 
 		job_system->post_step();
+
+		step_timings[INFO_INTEGRATION_TIME] += active_space->get_elapsed_time(JoltSpace3D::ELAPSED_TIME_PRE_STEP);
+		step_timings[INFO_AREA_QUERY_TIME] += active_space->get_elapsed_time(JoltSpace3D::ELAPSED_TIME_POST_STEP);
 	}
+
+	step_timings[INFO_JOB_COUNT] = job_system->take_job_count();
+
+	temp_allocator->update_capacity();
+
+#ifdef DEBUG_ENABLED
+	// Jolt only reports where the time went inside of its own update through the job timings.
+	job_system->add_process_timings(step_timings);
+#endif
+
+	step_timings[INFO_STEP_TIME] = Time::get_singleton()->get_ticks_usec() - time_beg;
 }
 
 void JoltPhysicsServer3D::sync() {
@@ -1649,8 +1694,14 @@ void JoltPhysicsServer3D::flush_queries() {
 
 	flushing_queries = true;
 
+	query_timings[INFO_CALLBACK_TIME] = 0;
+	query_timings[INFO_AREA_QUERY_TIME] = 0;
+
 	for (JoltSpace3D *space : active_spaces) {
 		space->call_queries();
+
+		query_timings[INFO_CALLBACK_TIME] += space->get_elapsed_time(JoltSpace3D::ELAPSED_TIME_STATE_CALLBACKS);
+		query_timings[INFO_AREA_QUERY_TIME] += space->get_elapsed_time(JoltSpace3D::ELAPSED_TIME_AREA_QUERIES);
 	}
 
 	flushing_queries = false;
@@ -1658,6 +1709,9 @@ void JoltPhysicsServer3D::flush_queries() {
 #ifdef DEBUG_ENABLED
 	job_system->flush_timings();
 #endif
+
+	// Recorded here, so the history pairs each step with the time spent on its callbacks.
+	_record_process_info();
 }
 
 bool JoltPhysicsServer3D::is_flushing_queries() const {
@@ -1665,7 +1719,9 @@ bool JoltPhysicsServer3D::is_flushing_queries() const {
 }
 
 int JoltPhysicsServer3D::get_process_info(ProcessInfo p_process_info) {
-	return 0;
+	ERR_FAIL_INDEX_V(p_process_info, INFO_MAX, 0);
+
+	return int(step_timings[p_process_info] + query_timings[p_process_info]);
 }
 
 void JoltPhysicsServer3D::free_space(JoltSpace3D *p_space) {
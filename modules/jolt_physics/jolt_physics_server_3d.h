@@ -59,6 +59,11 @@ class JoltPhysicsServer3D final : public PhysicsServer3D {
 	JoltJobSystem *job_system = nullptr;
 	JoltTempAllocator *temp_allocator = nullptr;
 
+	// Time spent in the last step and the last flush of queries, in microseconds, indexed by `ProcessInfo`.
+	// The job count of the last step is stored here as well.
+	uint64_t step_timings[INFO_MAX] = {};
+	uint64_t query_timings[INFO_MAX] = {};
+
 	bool on_separate_thread = false;
 	bool active = true;
 	bool flushing_queries = false;
@@ -164,6 +169,9 @@ public:
 	virtual PackedVector3Array space_get_contacts(RID p_space) const override;
 	virtual int space_get_contact_count(RID p_space) const override;
 
+	virtual PackedByteArray space_save_state(RID p_space) const override;
+	virtual bool space_restore_state(RID p_space, const PackedByteArray &p_state) override;
+
 	virtual RID area_create() override;
 
 	virtual void area_set_space(RID p_area, RID p_space) override;
@@ -293,6 +301,7 @@ public:
 
 	virtual void body_set_state_sync_callback(RID p_body, const Callable &p_callable) override;
 	virtual void body_set_force_integration_callback(RID p_body, const Callable &p_callable, const Variant &p_userdata) override;
+	virtual void body_set_state_sync_batched(RID p_body, bool p_batched) override;
 
 	virtual void body_set_ray_pickable(RID p_body, bool p_enable) override;
 
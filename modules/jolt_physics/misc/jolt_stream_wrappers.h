@@ -30,14 +30,20 @@
 
 #pragma once
 
-#ifdef DEBUG_ENABLED
+#include "core/templates/local_vector.h"
+#include "core/variant/variant.h"
 
+#ifdef DEBUG_ENABLED
 #include "core/io/file_access.h"
+#endif
 
 #include <Jolt/Jolt.h>
 
 #include <Jolt/Core/StreamIn.h>
 #include <Jolt/Core/StreamOut.h>
+#include <Jolt/Physics/StateRecorder.h>
+
+#ifdef DEBUG_ENABLED
 
 class JoltStreamOutputWrapper final : public JPH::StreamOut {
 	Ref<FileAccess> file_access;
@@ -76,3 +82,49 @@ public:
 };
 
 #endif
+
+class JoltStateRecorder final : public JPH::StateRecorder {
+	LocalVector<uint8_t> buffer;
+	uint32_t read_position = 0;
+	bool failed = false;
+
+public:
+	JoltStateRecorder() = default;
+
+	explicit JoltStateRecorder(const PackedByteArray &p_data) {
+		buffer.resize(p_data.size());
+		memcpy(buffer.ptr(), p_data.ptr(), p_data.size());
+	}
+
+	virtual void WriteBytes(const void *p_data, size_t p_bytes) override {
+		const uint32_t write_position = buffer.size();
+		buffer.resize(write_position + p_bytes);
+		memcpy(buffer.ptr() + write_position, p_data, p_bytes);
+	}
+
+	virtual void ReadBytes(void *p_data, size_t p_bytes) override {
+		if (unlikely(read_position + p_bytes > buffer.size())) {
+			memset(p_data, 0, p_bytes);
+			failed = true;
+			return;
+		}
+
+		memcpy(p_data, buffer.ptr() + read_position, p_bytes);
+		read_position += p_bytes;
+	}
+
+	virtual bool IsEOF() const override {
+		return read_position >= buffer.size();
+	}
+
+	virtual bool IsFailed() const override {
+		return failed;
+	}
+
+	PackedByteArray get_data() const {
+		PackedByteArray data;
+		data.resize(buffer.size());
+		memcpy(data.ptrw(), buffer.ptr(), buffer.size());
+		return data;
+	}
+};
@@ -1066,7 +1066,16 @@ void JoltBody3D::remove_joint(JoltJoint3D *p_joint) {
 	_joints_changed();
 }
 
-void JoltBody3D::call_queries() {
+void JoltBody3D::get_state_sync(PhysicsServer3D::BodyStateSync &r_state) const {
+	r_state.instance_id = instance_id;
+	r_state.transform = get_transform_scaled();
+	r_state.linear_velocity = get_linear_velocity();
+	r_state.angular_velocity = get_angular_velocity();
+	r_state.inverse_inertia_tensor = get_inverse_inertia_tensor();
+	r_state.sleeping = is_sleeping();
+}
+
+void JoltBody3D::call_queries(bool p_state_synced) {
 	if (custom_integration_callback.is_valid()) {
 		const Variant direct_state_variant = get_direct_state();
 		const Variant *args[2] = { &direct_state_variant, &custom_integration_userdata };
@@ -1081,7 +1090,7 @@ void JoltBody3D::call_queries() {
 		}
 	}
 
-	if (state_sync_callback.is_valid()) {
+	if (!p_state_synced && state_sync_callback.is_valid()) {
 		const Variant direct_state_variant = get_direct_state();
 		const Variant *args[1] = { &direct_state_variant };
 
@@ -1095,6 +1104,15 @@ void JoltBody3D::call_queries() {
 	}
 }
 
+void JoltBody3D::on_state_restored() {
+	// Jolt restored the body itself, but the kinematic target is kept on our side.
+	_update_kinematic_transform();
+
+	if (_should_call_queries()) {
+		_enqueue_call_queries();
+	}
+}
+
 void JoltBody3D::pre_step(float p_step) {
 	JoltObject3D::pre_step(p_step);
 
@@ -103,6 +103,7 @@ private:
 	bool custom_center_of_mass = false;
 	bool custom_integrator = false;
 	bool has_point_gravity = false;
+	bool state_sync_batched = false;
 
 	virtual JPH::BroadPhaseLayer _get_broad_phase_layer() const override;
 	virtual JPH::ObjectLayer _get_object_layer() const override;
@@ -165,6 +166,10 @@ public:
 	bool has_state_sync_callback() const { return state_sync_callback.is_valid(); }
 	void set_state_sync_callback(const Callable &p_callback) { state_sync_callback = p_callback; }
 
+	bool is_state_sync_batched() const { return state_sync_batched; }
+	void set_state_sync_batched(bool p_batched) { state_sync_batched = p_batched; }
+	void get_state_sync(PhysicsServer3D::BodyStateSync &r_state) const;
+
 	bool has_custom_integration_callback() const { return custom_integration_callback.is_valid(); }
 	void set_custom_integration_callback(const Callable &p_callback, const Variant &p_userdata) {
 		custom_integration_callback = p_callback;
@@ -245,7 +250,8 @@ public:
 	void add_joint(JoltJoint3D *p_joint);
 	void remove_joint(JoltJoint3D *p_joint);
 
-	void call_queries();
+	void call_queries(bool p_state_synced = false);
+	void on_state_restored();
 
 	virtual void pre_step(float p_step) override;
 
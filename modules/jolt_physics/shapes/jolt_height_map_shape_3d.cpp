@@ -219,9 +219,30 @@ void JoltHeightMapShape3D::set_data(const Variant &p_data) {
 	const Variant maybe_depth = data.get("depth", Variant());
 	ERR_FAIL_COND(maybe_depth.get_type() != Variant::INT);
 
-	heights = maybe_heights;
-	width = maybe_width;
-	depth = maybe_depth;
+	const Variant maybe_region = data.get("region", Variant());
+	if (maybe_region.get_type() == Variant::RECT2I) {
+		// Partial update, only the heights inside the region are given.
+		const Rect2i region = maybe_region;
+		ERR_FAIL_COND_MSG((int)maybe_width != width || (int)maybe_depth != depth, vformat("Heightmap region updates can't change the size of the heightmap. This shape belongs to %s.", _owners_to_string()));
+		ERR_FAIL_COND_MSG(region.size.x <= 0 || region.size.y <= 0 || !Rect2i(0, 0, width, depth).encloses(region), vformat("Heightmap update region must be inside the heightmap. This shape belongs to %s.", _owners_to_string()));
+
+#ifdef REAL_T_IS_DOUBLE
+		const PackedFloat64Array region_heights = maybe_heights;
+#else
+		const PackedFloat32Array region_heights = maybe_heights;
+#endif
+		ERR_FAIL_COND(region_heights.size() != region.size.x * region.size.y);
+
+		real_t *heights_ptrw = heights.ptrw();
+		const real_t *region_heights_ptr = region_heights.ptr();
+		for (int z = 0; z < region.size.y; ++z) {
+			memcpy(&heights_ptrw[(region.position.y + z) * width + region.position.x], &region_heights_ptr[z * region.size.x], region.size.x * sizeof(real_t));
+		}
+	} else {
+		heights = maybe_heights;
+		width = maybe_width;
+		depth = maybe_depth;
+	}
 
 	aabb = _calculate_aabb();
 
@@ -34,28 +34,12 @@
 #include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/os/time.h"
+#include "servers/physics_3d/physics_server_3d.h"
 
 #include <Jolt/Physics/PhysicsSettings.h>
 
 void JoltJobSystem::Job::_execute(void *p_user_data) {
-	Job *job = static_cast<Job *>(p_user_data);
-
-#ifdef DEBUG_ENABLED
-	const uint64_t time_start = Time::get_singleton()->get_ticks_usec();
-#endif
-
-	job->Execute();
-
-#ifdef DEBUG_ENABLED
-	const uint64_t time_end = Time::get_singleton()->get_ticks_usec();
-	const uint64_t time_elapsed = time_end - time_start;
-
-	timings_lock.lock();
-	timings_by_job[job->name] += time_elapsed;
-	timings_lock.unlock();
-#endif
-
-	job->Release();
+	static_cast<Job *>(p_user_data)->run();
 }
 
 JoltJobSystem::Job::Job(const char *p_name, JPH::ColorArg p_color, JPH::JobSystem *p_job_system, const JPH::JobSystem::JobFunction &p_job_function, JPH::uint32 p_dependency_count) :
@@ -95,6 +79,25 @@ JoltJobSystem::Job *JoltJobSystem::Job::pop_completed() {
 	return prev_head;
 }
 
+void JoltJobSystem::Job::run() {
+#ifdef DEBUG_ENABLED
+	const uint64_t time_start = Time::get_singleton()->get_ticks_usec();
+#endif
+
+	Execute();
+
+#ifdef DEBUG_ENABLED
+	const uint64_t time_end = Time::get_singleton()->get_ticks_usec();
+	const uint64_t time_elapsed = time_end - time_start;
+
+	timings_lock.lock();
+	timings_by_job[name] += time_elapsed;
+	timings_lock.unlock();
+#endif
+
+	Release();
+}
+
 void JoltJobSystem::Job::queue() {
 	AddRef();
 
@@ -127,6 +130,8 @@ JPH::JobHandle JoltJobSystem::CreateJob(const char *p_name, JPH::ColorArg p_colo
 		_reclaim_jobs();
 	}
 
+	job_count.fetch_add(1, std::memory_order_relaxed);
+
 	// This will increment the job's reference count, so must happen before we queue the job
 	JPH::JobHandle job_handle(job);
 
@@ -142,9 +147,31 @@ void JoltJobSystem::QueueJob(JPH::JobSystem::Job *p_job) {
 }
 
 void JoltJobSystem::QueueJobs(JPH::JobSystem::Job **p_jobs, JPH::uint p_job_count) {
+	if (p_job_count == 1) {
+		QueueJob(p_jobs[0]);
+		return;
+	}
+
+	// Queuing one group task for all of the jobs avoids paying the overhead of a separate task for each of them.
+	JobBatch *batch = memnew(JobBatch);
+	batch->jobs.resize(p_job_count);
+
 	for (JPH::uint i = 0; i < p_job_count; ++i) {
-		QueueJob(p_jobs[i]);
+		Job *job = static_cast<Job *>(p_jobs[i]);
+		job->AddRef();
+		batch->jobs[i] = job;
 	}
+
+	static const String task_name("Jolt Physics");
+
+	batch->group_id = WorkerThreadPool::get_singleton()->add_native_group_task(&_execute_batch, batch, (int)p_job_count, -1, true, task_name);
+
+	MutexLock batches_lock(batches_mutex);
+	batches.push_back(batch);
+}
+
+void JoltJobSystem::_execute_batch(void *p_user_data, uint32_t p_index) {
+	static_cast<JobBatch *>(p_user_data)->jobs[p_index]->run();
 }
 
 void JoltJobSystem::FreeJob(JPH::JobSystem::Job *p_job) {
@@ -157,6 +184,17 @@ void JoltJobSystem::_reclaim_jobs() {
 	}
 }
 
+void JoltJobSystem::_reclaim_batches() {
+	MutexLock batches_lock(batches_mutex);
+
+	for (JobBatch *batch : batches) {
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(batch->group_id);
+		memdelete(batch);
+	}
+
+	batches.clear();
+}
+
 JoltJobSystem::JoltJobSystem() :
 		JPH::JobSystemWithBarrier(JPH::cMaxPhysicsBarriers),
 		thread_count(MAX(1, WorkerThreadPool::get_singleton()->get_thread_count())) {
@@ -168,11 +206,58 @@ void JoltJobSystem::pre_step() {
 }
 
 void JoltJobSystem::post_step() {
+	// All jobs have run by now, this only releases the group tasks.
+	_reclaim_batches();
+
 	_reclaim_jobs();
 }
 
 #ifdef DEBUG_ENABLED
 
+void JoltJobSystem::add_process_timings(uint64_t *r_timings) const {
+	struct JobCategory {
+		const char *name = nullptr;
+		PhysicsServer3D::ProcessInfo info = PhysicsServer3D::INFO_MAX;
+	};
+
+	static const JobCategory categories[] = {
+		{ "UpdateBroadPhasePrepare", PhysicsServer3D::INFO_BROADPHASE_TIME },
+		{ "UpdateBroadPhaseFinalize", PhysicsServer3D::INFO_BROADPHASE_TIME },
+		{ "FindCollisions", PhysicsServer3D::INFO_NARROWPHASE_TIME },
+		{ "FindCCDContacts", PhysicsServer3D::INFO_NARROWPHASE_TIME },
+		{ "SoftBodyCollide", PhysicsServer3D::INFO_NARROWPHASE_TIME },
+		{ "DetermineActiveConstraints", PhysicsServer3D::INFO_ISLAND_GENERATION_TIME },
+		{ "BuildIslandsFromConstraints", PhysicsServer3D::INFO_ISLAND_GENERATION_TIME },
+		{ "FinalizeIslands", PhysicsServer3D::INFO_ISLAND_GENERATION_TIME },
+		{ "BodySetIslandIndex", PhysicsServer3D::INFO_ISLAND_GENERATION_TIME },
+		{ "SetupVelocityConstraints", PhysicsServer3D::INFO_CONSTRAINT_SETUP_TIME },
+		{ "SoftBodyPrepare", PhysicsServer3D::INFO_CONSTRAINT_SETUP_TIME },
+		{ "SolveVelocityConstraints", PhysicsServer3D::INFO_CONSTRAINT_SOLVE_TIME },
+		{ "SolvePositionConstraints", PhysicsServer3D::INFO_CONSTRAINT_SOLVE_TIME },
+		{ "ResolveCCDContacts", PhysicsServer3D::INFO_CONSTRAINT_SOLVE_TIME },
+		{ "SoftBodySimulate", PhysicsServer3D::INFO_CONSTRAINT_SOLVE_TIME },
+		{ "SoftBodyFinalize", PhysicsServer3D::INFO_CONSTRAINT_SOLVE_TIME },
+		{ "ApplyGravity", PhysicsServer3D::INFO_INTEGRATION_TIME },
+		{ "PreIntegrateVelocity", PhysicsServer3D::INFO_INTEGRATION_TIME },
+		{ "IntegrateVelocity", PhysicsServer3D::INFO_INTEGRATION_TIME },
+		{ "PostIntegrateVelocity", PhysicsServer3D::INFO_INTEGRATION_TIME },
+		{ "ContactRemovedCallbacks", PhysicsServer3D::INFO_CALLBACK_TIME },
+		{ "StepListeners", PhysicsServer3D::INFO_CALLBACK_TIME },
+	};
+
+	for (const KeyValue<const void *, uint64_t> &E : timings_by_job) {
+		// The same name can be stored at different addresses, so the actual strings are compared here.
+		const char *job_name = static_cast<const char *>(E.key);
+
+		for (const JobCategory &category : categories) {
+			if (strcmp(job_name, category.name) == 0) {
+				r_timings[category.info] += E.value;
+				break;
+			}
+		}
+	}
+}
+
 void JoltJobSystem::flush_timings() {
 	const StringName profiler_name = SNAME("servers");
 
@@ -30,8 +30,11 @@
 
 #pragma once
 
+#include "core/object/worker_thread_pool.h"
+#include "core/os/mutex.h"
 #include "core/os/spin_lock.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 
 #include <Jolt/Jolt.h>
 
@@ -64,6 +67,7 @@ class JoltJobSystem final : public JPH::JobSystemWithBarrier {
 		static Job *pop_completed();
 
 		void queue();
+		void run();
 
 		Job &operator=(const Job &p_other) = delete;
 		Job &operator=(Job &&p_other) = delete;
@@ -78,6 +82,17 @@ class JoltJobSystem final : public JPH::JobSystemWithBarrier {
 	inline static SpinLock timings_lock;
 #endif
 
+	// Jobs that become ready together are run as the elements of a single group task.
+	struct JobBatch {
+		LocalVector<Job *> jobs;
+		WorkerThreadPool::GroupID group_id = -1;
+	};
+
+	LocalVector<JobBatch *> batches;
+	Mutex batches_mutex;
+
+	std::atomic<uint32_t> job_count = 0;
+
 	JPH::FixedSizeFreeList<Job> jobs;
 
 	int thread_count = 0;
@@ -89,7 +104,10 @@ class JoltJobSystem final : public JPH::JobSystemWithBarrier {
 	virtual void QueueJobs(JPH::JobSystem::Job **p_jobs, JPH::uint p_job_count) override;
 	virtual void FreeJob(JPH::JobSystem::Job *p_job) override;
 
+	static void _execute_batch(void *p_user_data, uint32_t p_index);
+
 	void _reclaim_jobs();
+	void _reclaim_batches();
 
 public:
 	JoltJobSystem();
@@ -97,7 +115,13 @@ public:
 	void pre_step();
 	void post_step();
 
+	// Returns the number of jobs created since the last call.
+	uint32_t take_job_count() { return job_count.exchange(0, std::memory_order_relaxed); }
+
 #ifdef DEBUG_ENABLED
+	// Adds the time spent in each job since the last flush to the matching `PhysicsServer3D::ProcessInfo`.
+	void add_process_timings(uint64_t *r_timings) const;
+
 	void flush_timings();
 #endif
 };
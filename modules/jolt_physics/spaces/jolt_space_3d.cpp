@@ -191,10 +191,20 @@ void JoltSpace3D::step(float p_step) {
 	stepping = true;
 	last_step = p_step;
 
+	uint64_t time_beg = Time::get_singleton()->get_ticks_usec();
+
 	_pre_step(p_step);
 
+	uint64_t time_end = Time::get_singleton()->get_ticks_usec();
+	elapsed_time[ELAPSED_TIME_PRE_STEP] = time_end - time_beg;
+	time_beg = time_end;
+
 	const JPH::EPhysicsUpdateError update_error = physics_system->Update(p_step, 1, temp_allocator, job_system);
 
+	time_end = Time::get_singleton()->get_ticks_usec();
+	elapsed_time[ELAPSED_TIME_UPDATE] = time_end - time_beg;
+	time_beg = time_end;
+
 	if ((update_error & JPH::EPhysicsUpdateError::ManifoldCacheFull) != JPH::EPhysicsUpdateError::None) {
 		WARN_PRINT_ONCE(vformat("Jolt Physics manifold cache exceeded capacity and contacts were ignored. "
 								"Consider increasing maximum number of contact constraints in project settings. "
@@ -218,21 +228,48 @@ void JoltSpace3D::step(float p_step) {
 
 	_post_step(p_step);
 
+	elapsed_time[ELAPSED_TIME_POST_STEP] = Time::get_singleton()->get_ticks_usec() - time_beg;
+
 	stepping = false;
 }
 
 void JoltSpace3D::call_queries() {
+	uint64_t time_beg = Time::get_singleton()->get_ticks_usec();
+
+	const PhysicsServer3D::BodyStateSyncBatchCallback state_sync_batch_callback = PhysicsServer3D::get_body_state_sync_batch_callback();
+
 	while (body_call_queries_list.first()) {
 		JoltBody3D *body = body_call_queries_list.first()->self();
 		body_call_queries_list.remove(body_call_queries_list.first());
-		body->call_queries();
+
+		bool state_synced = false;
+		if (state_sync_batch_callback != nullptr && body->is_state_sync_batched()) {
+			state_sync_batch.resize(state_sync_batch.size() + 1);
+			body->get_state_sync(state_sync_batch[state_sync_batch.size() - 1]);
+			state_synced = true;
+		}
+
+		body->call_queries(state_synced);
 	}
 
+	// Batched bodies are synced after the force integration and state sync callbacks of all the other bodies,
+	// but still before the area callbacks run.
+	if (!state_sync_batch.is_empty()) {
+		state_sync_batch_callback(state_sync_batch.ptr(), state_sync_batch.size());
+		state_sync_batch.clear();
+	}
+
+	const uint64_t time_end = Time::get_singleton()->get_ticks_usec();
+	elapsed_time[ELAPSED_TIME_STATE_CALLBACKS] = time_end - time_beg;
+	time_beg = time_end;
+
 	while (area_call_queries_list.first()) {
 		JoltArea3D *body = area_call_queries_list.first()->self();
 		area_call_queries_list.remove(area_call_queries_list.first());
 		body->call_queries();
 	}
+
+	elapsed_time[ELAPSED_TIME_AREA_QUERIES] = Time::get_singleton()->get_ticks_usec() - time_beg;
 }
 
 double JoltSpace3D::get_param(PhysicsServer3D::SpaceParameter p_param) const {
@@ -552,6 +589,34 @@ void JoltSpace3D::remove_joint(JoltJoint3D *p_joint) {
 	remove_joint(p_joint->get_jolt_ref());
 }
 
+PackedByteArray JoltSpace3D::save_state() {
+	flush_pending_objects();
+
+	JoltStateRecorder recorder;
+	physics_system->SaveState(recorder);
+
+	return recorder.get_data();
+}
+
+bool JoltSpace3D::restore_state(const PackedByteArray &p_state) {
+	flush_pending_objects();
+
+	JoltStateRecorder recorder(p_state);
+	const bool restored = physics_system->RestoreState(recorder);
+	ERR_FAIL_COND_V_MSG(!restored || recorder.IsFailed(), false, vformat("Failed to restore the state of physics space with RID '%d'. Bodies can't be added to or removed from the space after its state was saved.", rid.get_id()));
+
+	JPH::BodyIDVector body_ids;
+	physics_system->GetBodies(body_ids);
+
+	for (const JPH::BodyID &body_id : body_ids) {
+		if (JoltBody3D *body = try_get_body(body_id)) {
+			body->on_state_restored();
+		}
+	}
+
+	return true;
+}
+
 #ifdef DEBUG_ENABLED
 
 void JoltSpace3D::dump_debug_snapshot(const String &p_dir) {
@@ -54,11 +54,24 @@ class JoltShapedObject3D;
 class JoltSoftBody3D;
 
 class JoltSpace3D {
+public:
+	enum ElapsedTime {
+		ELAPSED_TIME_PRE_STEP,
+		ELAPSED_TIME_UPDATE,
+		ELAPSED_TIME_POST_STEP,
+		// Measured while flushing queries, not during the step.
+		ELAPSED_TIME_STATE_CALLBACKS,
+		ELAPSED_TIME_AREA_QUERIES,
+		ELAPSED_TIME_MAX,
+	};
+
+private:
 	Mutex pending_objects_mutex;
 	Mutex body_call_queries_mutex;
 
 	SelfList<JoltBody3D>::List body_call_queries_list;
 	SelfList<JoltArea3D>::List area_call_queries_list;
+	LocalVector<PhysicsServer3D::BodyStateSync> state_sync_batch;
 	SelfList<JoltShapedObject3D>::List shapes_changed_list;
 	SelfList<JoltShapedObject3D>::List needs_optimization_list;
 
@@ -76,6 +89,8 @@ class JoltSpace3D {
 	JoltPhysicsDirectSpaceState3D *direct_state = nullptr;
 	JoltArea3D *default_area = nullptr;
 
+	uint64_t elapsed_time[ELAPSED_TIME_MAX] = {};
+
 	float last_step = 0.0f;
 
 	bool active = false;
@@ -131,6 +146,8 @@ public:
 
 	float get_last_step() const { return last_step; }
 
+	uint64_t get_elapsed_time(ElapsedTime p_time) const { return elapsed_time[p_time]; }
+
 	JPH::Body *add_object(const JoltObject3D &p_object, const JPH::BodyCreationSettings &p_settings, bool p_sleeping = false);
 	JPH::Body *add_object(const JoltObject3D &p_object, const JPH::SoftBodyCreationSettings &p_settings, bool p_sleeping = false);
 	void remove_object(const JPH::BodyID &p_jolt_id);
@@ -154,6 +171,9 @@ public:
 	void remove_joint(JPH::Constraint *p_jolt_ref);
 	void remove_joint(JoltJoint3D *p_joint);
 
+	PackedByteArray save_state();
+	bool restore_state(const PackedByteArray &p_state);
+
 #ifdef DEBUG_ENABLED
 	void dump_debug_snapshot(const String &p_dir);
 	const PackedVector3Array &get_debug_contacts() const;
@@ -86,15 +86,12 @@ void *JoltTempAllocator::Allocate(uint32_t p_size) {
 	if (new_top <= capacity) {
 		ptr = base + top;
 	} else {
-		WARN_PRINT_ONCE(vformat("Jolt Physics temporary memory allocator exceeded capacity of %d MiB. "
-								"Falling back to slower general-purpose allocator. "
-								"Consider increasing maximum temporary memory in project settings.",
-				JoltProjectSettings::temp_memory_mib));
-
+		// The buffer grows to fit this in the next call to `update_capacity`.
 		ptr = JPH::Allocate(p_size);
 	}
 
 	top = new_top;
+	peak = MAX(peak, top);
 
 	return ptr;
 }
@@ -118,3 +115,42 @@ void JoltTempAllocator::Free(void *p_ptr, uint32_t p_size) {
 
 	top = new_top;
 }
+
+void JoltTempAllocator::update_capacity() {
+	ERR_FAIL_COND_MSG(top != 0, "Jolt Physics temporary memory can't be resized while in use.");
+
+	constexpr uint64_t MIB = 1024 * 1024;
+	const uint64_t min_capacity = (uint64_t)JoltProjectSettings::temp_memory_b;
+
+	uint64_t new_capacity = capacity;
+
+	if (peak > capacity) {
+		// Leave some headroom, so that a slowly growing simulation doesn't resize on every step.
+		new_capacity = align_up(peak + peak / 4, MIB);
+		shrink_peak = 0;
+		shrink_update_count = 0;
+	} else {
+		shrink_peak = MAX(shrink_peak, peak);
+
+		if (++shrink_update_count >= SHRINK_UPDATE_COUNT) {
+			if (capacity > min_capacity && shrink_peak < capacity / 4) {
+				new_capacity = MAX(min_capacity, align_up(shrink_peak * 2, MIB));
+			}
+
+			shrink_peak = 0;
+			shrink_update_count = 0;
+		}
+	}
+
+	peak = 0;
+
+	if (new_capacity == capacity) {
+		return;
+	}
+
+	print_verbose(vformat("Jolt Physics: Resizing temporary memory from %d MiB to %d MiB.", capacity / MIB, new_capacity / MIB));
+
+	JPH::Free(base);
+	base = static_cast<uint8_t *>(JPH::Allocate((size_t)new_capacity));
+	capacity = new_capacity;
+}
@@ -37,8 +37,14 @@
 #include <cstdint>
 
 class JoltTempAllocator final : public JPH::TempAllocator {
+	// Number of updates the usage must stay low for before the buffer shrinks.
+	static constexpr uint32_t SHRINK_UPDATE_COUNT = 600;
+
 	uint64_t capacity = 0;
 	uint64_t top = 0;
+	uint64_t peak = 0;
+	uint64_t shrink_peak = 0;
+	uint32_t shrink_update_count = 0;
 	uint8_t *base = nullptr;
 
 public:
@@ -47,4 +53,7 @@ public:
 
 	virtual void *Allocate(JPH::uint p_size) override;
 	virtual void Free(void *p_ptr, JPH::uint p_size) override;
+
+	// Resizes the buffer to fit the peak usage since the last update. Must be called while nothing is allocated.
+	void update_capacity();
 };
@@ -88,6 +88,7 @@ private:
 	int contact_count = 0;
 
 	bool custom_integrator = false;
+	bool state_sync_batched = false;
 
 	CCDMode ccd_mode = CCD_MODE_DISABLED;
 
@@ -136,6 +137,9 @@ private:
 	void _body_state_changed(PhysicsDirectBodyState2D *p_state);
 
 	void _sync_body_state(PhysicsDirectBodyState2D *p_state);
+	void _sync_batched_body_state(const PhysicsServer2D::BodyStateSync &p_state);
+	bool _can_batch_state_sync() const;
+	void _update_state_sync_batched();
 
 protected:
 	void _notification(int p_what);
@@ -148,6 +152,9 @@ protected:
 	void _apply_body_mode();
 
 public:
+	// Registered as the physics server's batch callback, applies the state of all the batched bodies that moved.
+	static void sync_batched_body_states(const PhysicsServer2D::BodyStateSync *p_states, uint32_t p_count);
+
 	void set_lock_rotation_enabled(bool p_lock_rotation);
 	bool is_lock_rotation_enabled() const;
 
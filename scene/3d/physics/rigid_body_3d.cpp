@@ -266,20 +266,80 @@ void RigidBody3D::_body_state_changed(PhysicsDirectBodyState3D *p_state) {
 	unlock_callback();
 }
 
+bool RigidBody3D::_can_batch_state_sync() const {
+	// The regular callback is still needed to give `_integrate_forces()` a direct state, and to report contacts.
+	return !GDVIRTUAL_IS_OVERRIDDEN(_integrate_forces) && !contact_monitor && max_contacts_reported == 0;
+}
+
+void RigidBody3D::_update_state_sync_batched() {
+	bool batched = _can_batch_state_sync();
+	if (batched != state_sync_batched) {
+		state_sync_batched = batched;
+		PhysicsServer3D::get_singleton()->body_set_state_sync_batched(get_rid(), batched);
+	}
+}
+
+void RigidBody3D::_sync_batched_body_state(const PhysicsServer3D::BodyStateSync &p_state) {
+	if (unlikely(!_can_batch_state_sync())) {
+		// A script overriding `_integrate_forces()` was attached since batching was enabled, go back to the regular callback.
+		_update_state_sync_batched();
+
+		PhysicsDirectBodyState3D *state = PhysicsServer3D::get_singleton()->body_get_direct_state(get_rid());
+		if (state) {
+			_body_state_changed(state);
+		}
+		return;
+	}
+
+	lock_callback();
+
+	if (likely(p_state.transform != get_global_transform())) {
+		set_ignore_transform_notification(true);
+		set_global_transform(p_state.transform);
+		set_ignore_transform_notification(false);
+	}
+
+	linear_velocity = p_state.linear_velocity;
+	angular_velocity = p_state.angular_velocity;
+	inverse_inertia_tensor = p_state.inverse_inertia_tensor;
+	contact_count = 0;
+
+	if (sleeping != p_state.sleeping) {
+		sleeping = p_state.sleeping;
+		emit_signal(SceneStringName(sleeping_state_changed));
+	}
+
+	_on_transform_changed();
+
+	unlock_callback();
+}
+
+void RigidBody3D::sync_batched_body_states(const PhysicsServer3D::BodyStateSync *p_states, uint32_t p_count) {
+	for (uint32_t i = 0; i < p_count; i++) {
+		RigidBody3D *body = Object::cast_to<RigidBody3D>(ObjectDB::get_instance(p_states[i].instance_id));
+		if (body) {
+			body->_sync_batched_body_state(p_states[i]);
+		}
+	}
+}
+
 void RigidBody3D::_notification(int p_what) {
-#ifdef TOOLS_ENABLED
 	switch (p_what) {
 		case NOTIFICATION_ENTER_TREE: {
+			_update_state_sync_batched();
+#ifdef TOOLS_ENABLED
 			if (Engine::get_singleton()->is_editor_hint()) {
 				set_notify_local_transform(true); // Used for warnings and only in editor.
 			}
+#endif
 		} break;
 
+#ifdef TOOLS_ENABLED
 		case NOTIFICATION_LOCAL_TRANSFORM_CHANGED: {
 			update_configuration_warnings();
 		} break;
-	}
 #endif
+	}
 }
 
 void RigidBody3D::_apply_body_mode() {
@@ -532,6 +592,7 @@ void RigidBody3D::set_max_contacts_reported(int p_amount) {
 	ERR_FAIL_INDEX_MSG(p_amount, MAX_CONTACTS_REPORTED_3D_MAX, "Max contacts reported allocates memory (about 80 bytes each), and therefore must not be set too high.");
 	max_contacts_reported = p_amount;
 	PhysicsServer3D::get_singleton()->body_set_max_contacts_reported(get_rid(), p_amount);
+	_update_state_sync_batched();
 }
 
 int RigidBody3D::get_max_contacts_reported() const {
@@ -632,6 +693,8 @@ void RigidBody3D::set_contact_monitor(bool p_enabled) {
 		contact_monitor->locked = false;
 	}
 
+	_update_state_sync_batched();
+
 	notify_property_list_changed();
 }
 
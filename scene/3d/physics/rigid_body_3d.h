@@ -85,6 +85,7 @@ private:
 	int contact_count = 0;
 
 	bool custom_integrator = false;
+	bool state_sync_batched = false;
 
 	struct ShapePair {
 		int body_shape = 0;
@@ -130,6 +131,8 @@ private:
 	static void _body_state_changed_callback(void *p_instance, PhysicsDirectBodyState3D *p_state);
 
 	void _sync_body_state(PhysicsDirectBodyState3D *p_state);
+	void _sync_batched_body_state(const PhysicsServer3D::BodyStateSync &p_state);
+	void _update_state_sync_batched();
 
 protected:
 	void _notification(int p_what);
@@ -140,10 +143,14 @@ protected:
 	GDVIRTUAL1(_integrate_forces, RequiredParam<PhysicsDirectBodyState3D>)
 
 	virtual void _body_state_changed(PhysicsDirectBodyState3D *p_state);
+	virtual bool _can_batch_state_sync() const;
 
 	void _apply_body_mode();
 
 public:
+	// Registered as the physics server's batch callback, applies the state of all the batched bodies that moved.
+	static void sync_batched_body_states(const PhysicsServer3D::BodyStateSync *p_states, uint32_t p_count);
+
 	void set_lock_rotation_enabled(bool p_lock_rotation);
 	bool is_lock_rotation_enabled() const;
 
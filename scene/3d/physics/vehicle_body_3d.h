@@ -240,6 +240,7 @@ class VehicleBody3D : public RigidBody3D {
 
 	static void _body_state_changed_callback(void *p_instance, PhysicsDirectBodyState3D *p_state);
 	virtual void _body_state_changed(PhysicsDirectBodyState3D *p_state) override;
+	virtual bool _can_batch_state_sync() const override { return false; } // Wheels are simulated in the state callback.
 
 protected:
 	void _notification(int p_what);
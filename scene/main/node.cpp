@@ -132,7 +132,7 @@ void Node::_notification(int p_notification) {
 			}
 
 			{ // Update threaded process mode.
-				if (data.process_thread_group == PROCESS_THREAD_GROUP_INHERIT) {
+				if (!_needs_own_process_thread_group(data.parent ? data.parent->data.process_thread_group_owner : nullptr)) {
 					if (data.parent) {
 						data.process_thread_group_owner = data.parent->data.process_thread_group_owner;
 					}
@@ -169,16 +169,16 @@ void Node::_notification(int p_notification) {
 			data.is_translation_domain_dirty = true;
 
 			if (data.input) {
-				add_to_group("_vp_input" + itos(get_viewport()->get_instance_id()));
+				add_to_group(get_viewport()->input_group);
 			}
 			if (data.shortcut_input) {
-				add_to_group("_vp_shortcut_input" + itos(get_viewport()->get_instance_id()));
+				add_to_group(get_viewport()->shortcut_input_group);
 			}
 			if (data.unhandled_input) {
-				add_to_group("_vp_unhandled_input" + itos(get_viewport()->get_instance_id()));
+				add_to_group(get_viewport()->unhandled_input_group);
 			}
 			if (data.unhandled_key_input) {
-				add_to_group("_vp_unhandled_key_input" + itos(get_viewport()->get_instance_id()));
+				add_to_group(get_viewport()->unhandled_key_input_group);
 			}
 
 			data.tree->nodes_in_tree_count++;
@@ -209,16 +209,16 @@ void Node::_notification(int p_notification) {
 			data.tree->nodes_in_tree_count--;
 
 			if (data.input) {
-				remove_from_group("_vp_input" + itos(get_viewport()->get_instance_id()));
+				remove_from_group(get_viewport()->input_group);
 			}
 			if (data.shortcut_input) {
-				remove_from_group("_vp_shortcut_input" + itos(get_viewport()->get_instance_id()));
+				remove_from_group(get_viewport()->shortcut_input_group);
 			}
 			if (data.unhandled_input) {
-				remove_from_group("_vp_unhandled_input" + itos(get_viewport()->get_instance_id()));
+				remove_from_group(get_viewport()->unhandled_input_group);
 			}
 			if (data.unhandled_key_input) {
-				remove_from_group("_vp_unhandled_key_input" + itos(get_viewport()->get_instance_id()));
+				remove_from_group(get_viewport()->unhandled_key_input_group);
 			}
 
 			// Remove from processing first.
@@ -353,6 +353,10 @@ void Node::_propagate_enter_tree() {
 		data.viewport = data.parent->data.viewport;
 	}
 
+	// Groups and process lists get the nodes of the whole subtree at once, see `SceneTree::_end_enter_tree_batch()`.
+	SceneTree *tree = data.tree;
+	tree->_begin_enter_tree_batch();
+
 	for (KeyValue<StringName, GroupData> &E : data.grouped) {
 		E.value.group = data.tree->add_to_group(E.key, this);
 	}
@@ -385,7 +389,8 @@ void Node::_propagate_enter_tree() {
 #ifdef DEBUG_ENABLED
 	SceneDebugger::add_to_cache(data.scene_file_path, this);
 #endif
-	// enter groups
+
+	tree->_end_enter_tree_batch();
 }
 
 void Node::_propagate_after_exit_tree() {
@@ -580,20 +585,36 @@ void Node::_move_child(Node *p_child, int p_index, bool p_ignore_end) {
 	move_child_notify(p_child);
 	notification(NOTIFICATION_CHILD_ORDER_CHANGED);
 	emit_signal(SNAME("child_order_changed"));
-	p_child->_propagate_groups_dirty();
+	p_child->_propagate_groups_dirty(p_child, p_index > child_index);
 
 	data.blocked--;
 }
 
-void Node::_propagate_groups_dirty() {
+void Node::_propagate_groups_dirty(const Node *p_moved, bool p_moved_later) {
 	for (const KeyValue<StringName, GroupData> &E : data.grouped) {
-		if (E.value.group) {
-			E.value.group->changed = true;
+		SceneTreeGroup *group = E.value.group;
+		if (!group) {
+			continue;
+		}
+		group->changed = true;
+
+		// Only the moved subtree changed places, the order within it and outside of it is the same.
+		// So the first node stays first, unless it moved past siblings that may have nodes of the group.
+		Node *first = group->first;
+		if (!first) {
+			continue;
+		}
+		if (first == p_moved || p_moved->is_ancestor_of(first)) {
+			if (p_moved_later) {
+				group->first = nullptr;
+			}
+		} else if (first->is_greater_than(this)) {
+			group->first = this;
 		}
 	}
 
 	for (KeyValue<StringName, Node *> &K : data.children) {
-		K.value->_propagate_groups_dirty();
+		K.value->_propagate_groups_dirty(p_moved, p_moved_later);
 	}
 }
 
@@ -1092,8 +1113,8 @@ void Node::_remove_tree_from_process_thread_group() {
 	}
 
 	for (KeyValue<StringName, Node *> &K : data.children) {
-		if (K.value->data.process_thread_group != PROCESS_THREAD_GROUP_INHERIT) {
-			continue;
+		if (K.value->data.process_thread_group_owner == K.value) {
+			continue; // Owns its group, which is left untouched.
 		}
 
 		K.value->_remove_tree_from_process_thread_group();
@@ -1117,11 +1138,42 @@ void Node::_add_tree_to_process_thread_group(Node *p_owner) {
 	}
 
 	for (KeyValue<StringName, Node *> &K : data.children) {
-		if (K.value->data.process_thread_group != PROCESS_THREAD_GROUP_INHERIT) {
-			continue;
+		Node *child = K.value;
+		bool needs_own_group = child->_needs_own_process_thread_group(p_owner);
+
+		if (child->data.process_thread_group_owner == child) {
+			if (needs_own_group) {
+				continue;
+			}
+			// An automatic group now nested in a threaded group, merge it into the latter.
+			child->_remove_tree_from_process_thread_group();
+			child->_remove_process_group();
+			child->_add_tree_to_process_thread_group(p_owner);
+		} else if (needs_own_group) {
+			// An automatic group no longer nested in a threaded group, split it out.
+			child->data.process_thread_group_owner = child;
+			child->_add_process_group();
+			child->_add_tree_to_process_thread_group(child);
+		} else {
+			child->_add_tree_to_process_thread_group(p_owner);
 		}
+	}
+}
+
+bool Node::_is_process_thread_group_threaded() const {
+	// Automatic groups only exist when they are processed in a sub-thread.
+	return data.process_thread_group == PROCESS_THREAD_GROUP_SUB_THREAD || data.process_thread_group == PROCESS_THREAD_GROUP_AUTO;
+}
 
-		K.value->_add_tree_to_process_thread_group(p_owner);
+bool Node::_needs_own_process_thread_group(const Node *p_parent_owner) const {
+	switch (data.process_thread_group) {
+		case PROCESS_THREAD_GROUP_INHERIT:
+			return false;
+		case PROCESS_THREAD_GROUP_AUTO:
+			// Already processed in a sub-thread along with the rest of its group otherwise.
+			return p_parent_owner == nullptr || !p_parent_owner->_is_process_thread_group_threaded();
+		default:
+			return true;
 	}
 }
 bool Node::is_processing_internal() const {
@@ -1148,6 +1200,42 @@ int Node::get_process_thread_group_order() const {
 	return data.process_thread_group_order;
 }
 
+void Node::set_process_thread_access(ProcessThreadAccess p_access) {
+	ERR_FAIL_COND_MSG(data.tree && !Thread::is_main_thread(), "Changing the process thread access can only be done from the main thread. Use call_deferred(\"set_process_thread_access\",access).");
+	if (data.process_thread_access == p_access) {
+		return;
+	}
+	if (!is_inside_tree()) {
+		// Not yet in the tree; trivial update.
+		data.process_thread_access = p_access;
+		return;
+	}
+
+	// The group keeps count of what its processing nodes access.
+	if (_is_any_processing()) {
+		_remove_from_process_thread_group();
+	}
+
+	data.process_thread_access = p_access;
+
+	if (_is_any_processing()) {
+		_add_to_process_thread_group();
+	}
+}
+
+Node::ProcessThreadAccess Node::get_process_thread_access() const {
+	return data.process_thread_access;
+}
+
+#ifdef DEBUG_ENABLED
+bool Node::_is_readable_from_automatic_thread_group() const {
+	if (!data.tree) {
+		return true;
+	}
+	return data.tree->_is_readable_from_process_group(current_process_thread_group, this);
+}
+#endif // DEBUG_ENABLED
+
 void Node::set_process_priority(int p_priority) {
 	ERR_THREAD_GUARD
 	if (data.process_priority == p_priority) {
@@ -1174,6 +1262,24 @@ int Node::get_process_priority() const {
 	return data.process_priority;
 }
 
+void Node::set_process_batch_func(ProcessBatchFunc p_func) {
+	ERR_THREAD_GUARD
+	data.process_batch_func = p_func;
+}
+
+Node::ProcessBatchFunc Node::get_process_batch_func() const {
+	return data.process_batch_func;
+}
+
+void Node::set_physics_process_batch_func(ProcessBatchFunc p_func) {
+	ERR_THREAD_GUARD
+	data.physics_process_batch_func = p_func;
+}
+
+Node::ProcessBatchFunc Node::get_physics_process_batch_func() const {
+	return data.physics_process_batch_func;
+}
+
 void Node::set_physics_process_priority(int p_priority) {
 	ERR_THREAD_GUARD
 	if (data.physics_process_priority == p_priority) {
@@ -1213,18 +1319,15 @@ void Node::set_process_thread_group(ProcessThreadGroup p_mode) {
 	}
 
 	_remove_tree_from_process_thread_group();
-	if (data.process_thread_group != PROCESS_THREAD_GROUP_INHERIT) {
+	if (data.process_thread_group_owner == this) {
 		_remove_process_group();
 	}
 
 	data.process_thread_group = p_mode;
 
-	if (p_mode == PROCESS_THREAD_GROUP_INHERIT) {
-		if (data.parent) {
-			data.process_thread_group_owner = data.parent->data.process_thread_group_owner;
-		} else {
-			data.process_thread_group_owner = nullptr;
-		}
+	Node *parent_owner = data.parent ? data.parent->data.process_thread_group_owner : nullptr;
+	if (!_needs_own_process_thread_group(parent_owner)) {
+		data.process_thread_group_owner = parent_owner;
 	} else {
 		data.process_thread_group_owner = this;
 		_add_process_group();
@@ -1264,9 +1367,9 @@ void Node::set_process_input(bool p_enable) {
 	}
 
 	if (p_enable) {
-		add_to_group("_vp_input" + itos(get_viewport()->get_instance_id()));
+		add_to_group(get_viewport()->input_group);
 	} else {
-		remove_from_group("_vp_input" + itos(get_viewport()->get_instance_id()));
+		remove_from_group(get_viewport()->input_group);
 	}
 }
 
@@ -1285,9 +1388,9 @@ void Node::set_process_shortcut_input(bool p_enable) {
 	}
 
 	if (p_enable) {
-		add_to_group("_vp_shortcut_input" + itos(get_viewport()->get_instance_id()));
+		add_to_group(get_viewport()->shortcut_input_group);
 	} else {
-		remove_from_group("_vp_shortcut_input" + itos(get_viewport()->get_instance_id()));
+		remove_from_group(get_viewport()->shortcut_input_group);
 	}
 }
 
@@ -1306,9 +1409,9 @@ void Node::set_process_unhandled_input(bool p_enable) {
 	}
 
 	if (p_enable) {
-		add_to_group("_vp_unhandled_input" + itos(get_viewport()->get_instance_id()));
+		add_to_group(get_viewport()->unhandled_input_group);
 	} else {
-		remove_from_group("_vp_unhandled_input" + itos(get_viewport()->get_instance_id()));
+		remove_from_group(get_viewport()->unhandled_input_group);
 	}
 }
 
@@ -1327,9 +1430,9 @@ void Node::set_process_unhandled_key_input(bool p_enable) {
 	}
 
 	if (p_enable) {
-		add_to_group("_vp_unhandled_key_input" + itos(get_viewport()->get_instance_id()));
+		add_to_group(get_viewport()->unhandled_key_input_group);
 	} else {
-		remove_from_group("_vp_unhandled_key_input" + itos(get_viewport()->get_instance_id()));
+		remove_from_group(get_viewport()->unhandled_key_input_group);
 	}
 }
 
@@ -1901,6 +2004,47 @@ Node *Node::_get_child_by_name(const StringName &p_name) const {
 	}
 }
 
+Node *Node::_get_cached_node(const NodePath &p_path, const StringName *p_names, int p_name_count) const {
+	const uint32_t hash = p_path.hash();
+	for (uint32_t i = 0; i < NodePathCache::SIZE; i++) {
+		if (data.node_path_cache->hashes[i] != hash || data.node_path_cache->nodes[i].is_null() || data.node_path_cache->paths[i] != p_path) {
+			continue;
+		}
+
+		// Names are unique among siblings, so if the names going up from the node match the path,
+		// the node is still the one the path resolves to.
+		Node *node = ObjectDB::get_instance<Node>(data.node_path_cache->nodes[i]);
+		Node *current = node;
+		for (int j = p_name_count - 1; j >= 0 && current; j--) {
+			if (current->data.name != p_names[j]) {
+				current = nullptr;
+				break;
+			}
+			current = current->data.parent;
+		}
+
+		if (current == this) {
+			return node;
+		}
+		data.node_path_cache->nodes[i] = ObjectID();
+		return nullptr;
+	}
+	return nullptr;
+}
+
+void Node::_cache_node(const NodePath &p_path, Node *p_node) const {
+	if (!data.node_path_cache) {
+		data.node_path_cache = memnew(NodePathCache);
+	}
+
+	NodePathCache &cache = *data.node_path_cache;
+	uint32_t index = cache.next;
+	cache.next = (cache.next + 1) % NodePathCache::SIZE;
+	cache.paths[index] = p_path;
+	cache.hashes[index] = p_path.hash();
+	cache.nodes[index] = p_node->get_instance_id();
+}
+
 Node *Node::get_node_or_null(const NodePath &p_path) const {
 	ERR_THREAD_GUARD_V(nullptr);
 	if (p_path.is_empty()) {
@@ -1909,6 +2053,19 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 
 	ERR_FAIL_COND_V_MSG(!data.tree && p_path.is_absolute(), nullptr, "Can't use get_node() with absolute paths from outside the active scene tree.");
 
+	const Vector<StringName> names = p_path.get_names();
+	const StringName *names_ptr = names.ptr();
+	const int name_count = names.size();
+
+	// Only relative paths made of plain names are cached, and only when there's more than one name to look up.
+	bool cacheable = !p_path.is_absolute() && name_count > 1;
+	if (cacheable && data.node_path_cache) {
+		Node *cached = _get_cached_node(p_path, names_ptr, name_count);
+		if (cached) {
+			return cached;
+		}
+	}
+
 	Node *current = nullptr;
 	Node *root = nullptr;
 
@@ -1921,12 +2078,13 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 		}
 	}
 
-	for (int i = 0; i < p_path.get_name_count(); i++) {
-		StringName name = p_path.get_name(i);
+	for (int i = 0; i < name_count; i++) {
+		const StringName &name = names_ptr[i];
 		Node *next = nullptr;
 
 		if (name == SNAME(".")) {
 			next = current;
+			cacheable = false;
 
 		} else if (name == SNAME("..")) {
 			if (current == nullptr || !current->data.parent) {
@@ -1934,6 +2092,7 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 			}
 
 			next = current->data.parent;
+			cacheable = false;
 		} else if (current == nullptr) {
 			if (name == root->get_name()) {
 				next = root;
@@ -1948,6 +2107,7 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 				return nullptr;
 			}
 			next = *unique;
+			cacheable = false;
 		} else {
 			next = nullptr;
 			const Node *const *node = current->data.children.getptr(name);
@@ -1960,6 +2120,10 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 		current = next;
 	}
 
+	if (cacheable && current) {
+		_cache_node(p_path, current);
+	}
+
 	return current;
 }
 
@@ -3823,6 +3987,9 @@ void Node::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_process_thread_group_order", "order"), &Node::set_process_thread_group_order);
 	ClassDB::bind_method(D_METHOD("get_process_thread_group_order"), &Node::get_process_thread_group_order);
 
+	ClassDB::bind_method(D_METHOD("set_process_thread_access", "access"), &Node::set_process_thread_access);
+	ClassDB::bind_method(D_METHOD("get_process_thread_access"), &Node::get_process_thread_access);
+
 	ClassDB::bind_method(D_METHOD("queue_accessibility_update"), &Node::queue_accessibility_update);
 	ClassDB::bind_method(D_METHOD("get_accessibility_element"), &Node::get_accessibility_element);
 
@@ -3991,6 +4158,11 @@ void Node::_bind_methods() {
 	BIND_ENUM_CONSTANT(PROCESS_THREAD_GROUP_INHERIT);
 	BIND_ENUM_CONSTANT(PROCESS_THREAD_GROUP_MAIN_THREAD);
 	BIND_ENUM_CONSTANT(PROCESS_THREAD_GROUP_SUB_THREAD);
+	BIND_ENUM_CONSTANT(PROCESS_THREAD_GROUP_AUTO);
+
+	BIND_ENUM_CONSTANT(PROCESS_THREAD_ACCESS_SUBTREE);
+	BIND_ENUM_CONSTANT(PROCESS_THREAD_ACCESS_READ_OUTSIDE);
+	BIND_ENUM_CONSTANT(PROCESS_THREAD_ACCESS_WRITE_OUTSIDE);
 
 	BIND_BITFIELD_FLAG(FLAG_PROCESS_THREAD_MESSAGES);
 	BIND_BITFIELD_FLAG(FLAG_PROCESS_THREAD_MESSAGES_PHYSICS);
@@ -4040,9 +4212,10 @@ void Node::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_physics_priority"), "set_physics_process_priority", "get_physics_process_priority");
 
 	ADD_SUBGROUP("Thread Group", "process_thread");
-	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group", PROPERTY_HINT_ENUM, "Inherit,Main Thread,Sub Thread"), "set_process_thread_group", "get_process_thread_group");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group", PROPERTY_HINT_ENUM, "Inherit,Main Thread,Sub Thread,Auto"), "set_process_thread_group", "get_process_thread_group");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group_order"), "set_process_thread_group_order", "get_process_thread_group_order");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_messages", PROPERTY_HINT_FLAGS, "Process,Physics Process"), "set_process_thread_messages", "get_process_thread_messages");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_access", PROPERTY_HINT_ENUM, "Subtree,Read Outside,Write Outside"), "set_process_thread_access", "get_process_thread_access");
 
 	ADD_GROUP("Physics Interpolation", "physics_interpolation_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "physics_interpolation_mode", PROPERTY_HINT_ENUM, "Inherit,On,Off"), "set_physics_interpolation_mode", "get_physics_interpolation_mode");
@@ -4124,6 +4297,9 @@ Node::Node() {
 }
 
 Node::~Node() {
+	if (data.node_path_cache) {
+		memdelete(data.node_path_cache);
+	}
 	data.grouped.clear();
 	data.owned.clear();
 	data.children.clear();
@@ -36,6 +36,7 @@
 #include "core/object/ref_counted.h"
 #include "core/os/thread_safe.h"
 #include "core/templates/iterable.h"
+#include "core/templates/span.h"
 #include "scene/scene_string_names.h" // IWYU pragma: export. Make available to all Nodes.
 
 class MultiplayerAPI;
@@ -88,6 +89,13 @@ public:
 		PROCESS_THREAD_GROUP_INHERIT,
 		PROCESS_THREAD_GROUP_MAIN_THREAD,
 		PROCESS_THREAD_GROUP_SUB_THREAD,
+		PROCESS_THREAD_GROUP_AUTO,
+	};
+
+	enum ProcessThreadAccess {
+		PROCESS_THREAD_ACCESS_SUBTREE,
+		PROCESS_THREAD_ACCESS_READ_OUTSIDE,
+		PROCESS_THREAD_ACCESS_WRITE_OUTSIDE,
 	};
 
 	enum ProcessThreadMessages {
@@ -187,6 +195,9 @@ private:
 		}
 	};
 
+	// Processes a run of nodes at once, in place of sending them `NOTIFICATION_PROCESS` or `NOTIFICATION_PHYSICS_PROCESS`.
+	typedef void (*ProcessBatchFunc)(Span<Node *> p_nodes, double p_delta);
+
 	struct ComparatorWithPriority {
 		bool operator()(const Node *p_a, const Node *p_b) const { return p_b->data.process_priority == p_a->data.process_priority ? p_b->is_greater_than(p_a) : p_b->data.process_priority > p_a->data.process_priority; }
 	};
@@ -195,6 +206,16 @@ private:
 		bool operator()(const Node *p_a, const Node *p_b) const { return p_b->data.physics_process_priority == p_a->data.physics_process_priority ? p_b->is_greater_than(p_a) : p_b->data.physics_process_priority > p_a->data.physics_process_priority; }
 	};
 
+	// Paths of several names recently resolved from this node. A cached node is checked by walking
+	// back up to this node, which is cheaper than looking up each name in the children along the path.
+	struct NodePathCache {
+		static constexpr uint32_t SIZE = 4;
+		NodePath paths[SIZE];
+		uint32_t hashes[SIZE] = {};
+		ObjectID nodes[SIZE];
+		uint32_t next = 0;
+	};
+
 	// This Data struct is to avoid namespace pollution in derived classes.
 	struct Data {
 		String scene_file_path;
@@ -207,6 +228,7 @@ private:
 		mutable bool children_cache_dirty = false;
 		mutable LocalVector<Node *> children_cache;
 		HashMap<StringName, Node *> owned_unique_nodes;
+		mutable NodePathCache *node_path_cache = nullptr;
 		bool unique_name_in_owner = false;
 		InternalMode internal_mode = INTERNAL_MODE_DISABLED;
 		mutable int internal_children_front_count_cache = 0;
@@ -232,6 +254,7 @@ private:
 		ProcessThreadGroup process_thread_group = PROCESS_THREAD_GROUP_INHERIT;
 		Node *process_thread_group_owner = nullptr;
 		int process_thread_group_order = 0;
+		ProcessThreadAccess process_thread_access = PROCESS_THREAD_ACCESS_SUBTREE;
 		BitField<ProcessThreadMessages> process_thread_messages = {};
 		void *process_group = nullptr; // to avoid cyclic dependency
 
@@ -242,6 +265,9 @@ private:
 		int process_priority = 0;
 		int physics_process_priority = 0;
 
+		ProcessBatchFunc process_batch_func = nullptr;
+		ProcessBatchFunc physics_process_batch_func = nullptr;
+
 		// Keep bitpacked values together to get better packing.
 		ProcessMode process_mode : 3;
 		PhysicsInterpolationMode physics_interpolation_mode : 2;
@@ -315,7 +341,7 @@ private:
 	void _propagate_physics_interpolated(bool p_interpolated);
 	void _propagate_physics_interpolation_reset_requested(bool p_requested);
 	void _propagate_process_owner(Node *p_owner, int p_pause_notification, int p_enabled_notification);
-	void _propagate_groups_dirty();
+	void _propagate_groups_dirty(const Node *p_moved, bool p_moved_later);
 	void _propagate_translation_domain_dirty();
 	Array _get_node_and_resource(const NodePath &p_path);
 
@@ -343,6 +369,9 @@ private:
 
 	void _clean_up_owner();
 
+	Node *_get_cached_node(const NodePath &p_path, const StringName *p_names, int p_name_count) const;
+	void _cache_node(const NodePath &p_path, Node *p_node) const;
+
 	_FORCE_INLINE_ void _update_children_cache() const {
 		if (unlikely(data.children_cache_dirty)) {
 			_update_children_cache_impl();
@@ -358,6 +387,17 @@ private:
 	void _remove_from_process_thread_group();
 	void _remove_tree_from_process_thread_group();
 	void _add_tree_to_process_thread_group(Node *p_owner);
+	bool _is_process_thread_group_threaded() const;
+	bool _needs_own_process_thread_group(const Node *p_parent_owner) const;
+#ifdef DEBUG_ENABLED
+	bool _is_readable_from_automatic_thread_group() const;
+#endif // DEBUG_ENABLED
+
+	// Scripts and extensions may override how the node processes, so such nodes are never processed in a batch.
+	_FORCE_INLINE_ ProcessBatchFunc _get_process_batch_func(bool p_physics) const {
+		ProcessBatchFunc func = p_physics ? data.physics_process_batch_func : data.process_batch_func;
+		return (func && !get_script_instance() && !_get_extension()) ? func : nullptr;
+	}
 
 	static thread_local Node *current_process_thread_group;
 
@@ -670,9 +710,17 @@ public:
 	void set_process_priority(int p_priority);
 	int get_process_priority() const;
 
+	void set_process_batch_func(ProcessBatchFunc p_func);
+	ProcessBatchFunc get_process_batch_func() const;
+	void set_physics_process_batch_func(ProcessBatchFunc p_func);
+	ProcessBatchFunc get_physics_process_batch_func() const;
+
 	void set_process_thread_group_order(int p_order);
 	int get_process_thread_group_order() const;
 
+	void set_process_thread_access(ProcessThreadAccess p_access);
+	ProcessThreadAccess get_process_thread_access() const;
+
 	void set_physics_process_priority(int p_priority);
 	int get_physics_process_priority() const;
 
@@ -711,6 +759,12 @@ public:
 			return is_current_thread_safe_for_nodes() || unlikely(!data.tree);
 		} else {
 			// Thread processing.
+#ifdef DEBUG_ENABLED
+			// Automatic groups are scheduled from what they declared to read, which is checked here.
+			if (current_process_thread_group->data.process_thread_group == PROCESS_THREAD_GROUP_AUTO && current_process_thread_group != data.process_thread_group_owner) {
+				return _is_readable_from_automatic_thread_group();
+			}
+#endif // DEBUG_ENABLED
 			return true;
 		}
 	}
@@ -905,6 +959,7 @@ public:
 VARIANT_ENUM_CAST(Node::DuplicateFlags);
 VARIANT_ENUM_CAST(Node::ProcessMode);
 VARIANT_ENUM_CAST(Node::ProcessThreadGroup);
+VARIANT_ENUM_CAST(Node::ProcessThreadAccess);
 VARIANT_BITFIELD_CAST(Node::ProcessThreadMessages);
 VARIANT_ENUM_CAST(Node::InternalMode);
 VARIANT_ENUM_CAST(Node::PhysicsInterpolationMode);
@@ -179,19 +179,37 @@ SceneTreeGroup *SceneTree::add_to_group(const StringName &p_group, Node *p_node)
 		E = group_map.insert(p_group, SceneTreeGroup());
 	}
 
+#ifdef DEV_ENABLED
+	// Node keeps track of its own groups, so this linear search is only a sanity check.
 	ERR_FAIL_COND_V_MSG(E->value.nodes.has(p_node), &E->value, "Already in group: " + p_group + ".");
+#endif
+	if (enter_tree_batch_depth > 0) {
+		pending_group_entries.push_back({ &E->value, p_node, pending_group_entries.size() });
+		return &E->value;
+	}
+
 	E->value.nodes.push_back(p_node);
 	E->value.changed = true;
+	if (E->value.first && E->value.first->is_greater_than(p_node)) {
+		E->value.first = p_node;
+	}
 	return &E->value;
 }
 
 void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
 	_THREAD_SAFE_METHOD_
+	_flush_pending_group_entries();
 
 	HashMap<StringName, SceneTreeGroup>::Iterator E = group_map.find(p_group);
 	ERR_FAIL_COND(!E);
 
-	E->value.nodes.erase(p_node);
+	// Subtrees leave the tree in reverse tree order, so the node is usually found near the end.
+	int64_t idx = E->value.nodes.rfind(p_node);
+	ERR_FAIL_COND(idx < 0);
+	E->value.nodes.remove_at(idx);
+	if (E->value.first == p_node) {
+		E->value.first = nullptr;
+	}
 	if (E->value.nodes.is_empty()) {
 		group_map.remove(E);
 	}
@@ -352,18 +370,46 @@ void SceneTree::_update_group_order(SceneTreeGroup &g) {
 	node_sort.sort(gr_nodes, gr_node_count);
 
 	g.changed = false;
+	g.first = gr_nodes[0];
 }
 
 RequiredResult<Window> SceneTree::get_root() const {
 	return root;
 }
 
+void SceneTree::_call_group_node(Node *p_node, const StringName &p_function, const Variant **p_args, int p_argcount, GroupCallCache &r_cache) {
+	Callable::CallError ce;
+	if (!p_node->get_script_instance() && p_function != CoreStringName(free_)) {
+		// Same as `Object::callp()` without a script, but groups are usually made of nodes of the same
+		// few classes, so the method found for a node is reused for the next ones of the same class.
+		// Nodes with a script go through `callp()`, as the script may define or override the method.
+		const StringName &class_name = p_node->get_class_name();
+		if (!r_cache.method_valid || class_name != r_cache.class_name) {
+			r_cache.class_name = class_name;
+			r_cache.method = ClassDB::get_method(class_name, p_function);
+			r_cache.method_valid = true;
+		}
+		if (r_cache.method) {
+			p_node->call_method_bind(r_cache.method, p_args, p_argcount, ce);
+		} else {
+			ce.error = Callable::CallError::CALL_ERROR_INVALID_METHOD;
+		}
+	} else {
+		p_node->callp(p_function, p_args, p_argcount, ce);
+	}
+
+	if (unlikely(ce.error != Callable::CallError::CALL_OK && ce.error != Callable::CallError::CALL_ERROR_INVALID_METHOD)) {
+		ERR_PRINT(vformat("Error calling group method on node \"%s\": %s.", p_node->get_name(), Variant::get_callable_error_text(Callable(p_node, p_function), p_args, p_argcount, ce)));
+	}
+}
+
 void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, const Variant **p_args, int p_argcount) {
 	Vector<Node *> nodes_copy;
 
 	{
 		_THREAD_SAFE_METHOD_
 
+		_flush_pending_group_entries();
 		HashMap<StringName, SceneTreeGroup>::Iterator E = group_map.find(p_group);
 		if (!E) {
 			return;
@@ -397,7 +443,7 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 		nodes_copy = g.nodes;
 	}
 
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr();
 	int gr_node_count = nodes_copy.size();
 
 	{
@@ -405,6 +451,8 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 		nodes_removed_on_group_call_lock++;
 	}
 
+	GroupCallCache call_cache;
+
 	if (p_call_flags & GROUP_CALL_REVERSE) {
 		for (int i = gr_node_count - 1; i >= 0; i--) {
 			if (nodes_removed_on_group_call_lock && nodes_removed_on_group_call.has(gr_nodes[i])) {
@@ -413,11 +461,7 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 
 			Node *node = gr_nodes[i];
 			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				Callable::CallError ce;
-				node->callp(p_function, p_args, p_argcount, ce);
-				if (unlikely(ce.error != Callable::CallError::CALL_OK && ce.error != Callable::CallError::CALL_ERROR_INVALID_METHOD)) {
-					ERR_PRINT(vformat("Error calling group method on node \"%s\": %s.", node->get_name(), Variant::get_callable_error_text(Callable(node, p_function), p_args, p_argcount, ce)));
-				}
+				_call_group_node(node, p_function, p_args, p_argcount, call_cache);
 			} else {
 				MessageQueue::get_singleton()->push_callp(node, p_function, p_args, p_argcount);
 			}
@@ -431,11 +475,7 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 
 			Node *node = gr_nodes[i];
 			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				Callable::CallError ce;
-				node->callp(p_function, p_args, p_argcount, ce);
-				if (unlikely(ce.error != Callable::CallError::CALL_OK && ce.error != Callable::CallError::CALL_ERROR_INVALID_METHOD)) {
-					ERR_PRINT(vformat("Error calling group method on node \"%s\": %s.", node->get_name(), Variant::get_callable_error_text(Callable(node, p_function), p_args, p_argcount, ce)));
-				}
+				_call_group_node(node, p_function, p_args, p_argcount, call_cache);
 			} else {
 				MessageQueue::get_singleton()->push_callp(node, p_function, p_args, p_argcount);
 			}
@@ -455,6 +495,7 @@ void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_gr
 	Vector<Node *> nodes_copy;
 	{
 		_THREAD_SAFE_METHOD_
+		_flush_pending_group_entries();
 		HashMap<StringName, SceneTreeGroup>::Iterator E = group_map.find(p_group);
 		if (!E) {
 			return;
@@ -469,7 +510,7 @@ void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_gr
 		nodes_copy = g.nodes;
 	}
 
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr();
 	int gr_node_count = nodes_copy.size();
 
 	{
@@ -518,6 +559,7 @@ void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group
 	{
 		_THREAD_SAFE_METHOD_
 
+		_flush_pending_group_entries();
 		HashMap<StringName, SceneTreeGroup>::Iterator E = group_map.find(p_group);
 		if (!E) {
 			return;
@@ -531,7 +573,7 @@ void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group
 
 		nodes_copy = g.nodes;
 	}
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr();
 	int gr_node_count = nodes_copy.size();
 
 	{
@@ -1219,14 +1261,24 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 				n->notification(Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
 			}
 			if (n->is_physics_processing()) {
-				n->notification(Node::NOTIFICATION_PHYSICS_PROCESS);
+				Node::ProcessBatchFunc batch_func = n->_get_process_batch_func(true);
+				if (batch_func) {
+					i = _process_batch(p_group, nodes_ptr, i, node_count, batch_func, true);
+				} else {
+					n->notification(Node::NOTIFICATION_PHYSICS_PROCESS);
+				}
 			}
 		} else {
 			if (n->is_processing_internal()) {
 				n->notification(Node::NOTIFICATION_INTERNAL_PROCESS);
 			}
 			if (n->is_processing()) {
-				n->notification(Node::NOTIFICATION_PROCESS);
+				Node::ProcessBatchFunc batch_func = n->_get_process_batch_func(false);
+				if (batch_func) {
+					i = _process_batch(p_group, nodes_ptr, i, node_count, batch_func, false);
+				} else {
+					n->notification(Node::NOTIFICATION_PROCESS);
+				}
 			}
 		}
 	}
@@ -1234,13 +1286,63 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 	p_group->call_queue.flush(); // Flush messages also after processing (for potential deferred calls).
 }
 
+uint32_t SceneTree::_process_batch(ProcessGroup *p_group, Node *const *p_nodes, uint32_t p_from, uint32_t p_count, Node::ProcessBatchFunc p_func, bool p_physics) {
+	// Gather the run of nodes starting at `p_from` that are processed by the same function. Nodes that
+	// are skipped don't end the run. The run is gathered into the group's scratch list, as `p_nodes`
+	// may still share its buffer with the process list.
+	// Nodes that also process internally end the run, so that each node still gets its internal
+	// notification right before it's processed, as with individual processing. The first node of the
+	// run already got its own.
+	LocalVector<Node *> &batch = p_group->batch_nodes;
+	batch.clear();
+	batch.push_back(p_nodes[p_from]);
+
+	uint32_t i = p_from + 1;
+	for (; i < p_count; i++) {
+		Node *n = p_nodes[i];
+		if (nodes_removed_on_group_call.has(n) || !n->can_process() || !n->is_inside_tree()) {
+			continue;
+		}
+
+		if (p_physics) {
+			if (!n->is_physics_processing() || n->is_physics_processing_internal() || n->_get_process_batch_func(true) != p_func) {
+				break;
+			}
+		} else {
+			if (!n->is_processing() || n->is_processing_internal() || n->_get_process_batch_func(false) != p_func) {
+				break;
+			}
+		}
+
+		batch.push_back(n);
+	}
+
+	p_func(Span<Node *>(batch.ptr(), batch.size()), p_physics ? physics_process_time : process_time);
+
+	// Resume right before the node that ended the run.
+	return i - 1;
+}
+
 void SceneTree::_process_groups_thread(uint32_t p_index, bool p_physics) {
 	Node::current_process_thread_group = local_process_group_cache[p_index]->owner;
 	_process_group(local_process_group_cache[p_index], p_physics);
 	Node::current_process_thread_group = nullptr;
 }
 
+void SceneTree::_process_groups_threaded(bool p_physics) {
+	if (local_process_group_cache.is_empty()) {
+		return;
+	}
+
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_groups_thread, p_physics, local_process_group_cache.size(), -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
+	thread_groups_usec += OS::get_singleton()->get_ticks_usec() - begin;
+}
+
 void SceneTree::_process(bool p_physics) {
+	_flush_pending_process_entries();
+
 	if (process_groups_dirty) {
 		{
 			// First, remove dirty groups.
@@ -1250,6 +1352,8 @@ void SceneTree::_process(bool p_physics) {
 
 			for (uint32_t i = 0; i < pg_count; i++) {
 				if (pg_ptr[i]->removed) {
+					// Nothing references removed groups anymore, and no group is being processed at this point.
+					group_allocator.free(pg_ptr[i]);
 					// Replace removed with last.
 					pg_ptr[i] = pg_ptr[pg_count - 1];
 					// Retry
@@ -1284,24 +1388,38 @@ void SceneTree::_process(bool p_physics) {
 	nodes_removed_on_group_call_lock++;
 
 	int current_order = process_groups[0]->owner ? process_groups[0]->owner->data.process_thread_group_order : 0;
-	bool current_threaded = process_groups[0]->owner ? process_groups[0]->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD : false;
+	bool current_threaded = process_groups[0]->owner ? process_groups[0]->owner->_is_process_thread_group_threaded() : false;
 
 	for (uint32_t i = 0; i <= group_count; i++) {
 		int order = i < group_count && process_groups[i]->owner ? process_groups[i]->owner->data.process_thread_group_order : 0;
-		bool threaded = i < group_count && process_groups[i]->owner ? process_groups[i]->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD : false;
+		bool threaded = i < group_count && process_groups[i]->owner ? process_groups[i]->owner->_is_process_thread_group_threaded() : false;
 
 		if (i == group_count || current_order != order || current_threaded != threaded) {
 			if (process_count > 0) {
 				// Proceed to process the group.
-				bool using_threads = process_groups[from]->owner && process_groups[from]->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD && !node_threading_disabled;
+				bool using_threads = process_groups[from]->owner && process_groups[from]->owner->_is_process_thread_group_threaded() && !node_threading_disabled;
 
 				if (using_threads) {
 					local_process_group_cache.clear();
+					local_process_group_read_cache.clear();
+					local_process_group_serial_cache.clear();
 				}
 				for (uint32_t j = from; j < i; j++) {
 					if (process_groups[j]->last_pass == process_last_pass) {
 						if (using_threads) {
-							local_process_group_cache.push_back(process_groups[j]);
+							ProcessGroup *pg = process_groups[j];
+							pg->phase = _get_process_group_phase(pg, p_physics);
+							switch (pg->phase) {
+								case PROCESS_GROUP_PHASE_PARALLEL: {
+									local_process_group_cache.push_back(pg);
+								} break;
+								case PROCESS_GROUP_PHASE_PARALLEL_READ: {
+									local_process_group_read_cache.push_back(pg);
+								} break;
+								case PROCESS_GROUP_PHASE_SERIAL: {
+									local_process_group_serial_cache.push_back(pg);
+								} break;
+							}
 						} else {
 							_process_group(process_groups[j], p_physics);
 						}
@@ -1309,8 +1427,22 @@ void SceneTree::_process(bool p_physics) {
 				}
 
 				if (using_threads) {
-					WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_groups_thread, p_physics, local_process_group_cache.size(), -1, true);
-					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
+					_process_groups_threaded(p_physics);
+
+					// Groups reading other nodes see them once they were processed.
+					if (!local_process_group_read_cache.is_empty()) {
+						process_read_phase_pass++;
+						for (ProcessGroup *pg : local_process_group_read_cache) {
+							pg->read_phase_pass = process_read_phase_pass;
+						}
+						SWAP(local_process_group_cache, local_process_group_read_cache);
+						_process_groups_threaded(p_physics);
+					}
+
+					// Groups writing other nodes can't run alongside anything else.
+					for (ProcessGroup *pg : local_process_group_serial_cache) {
+						_process_group(pg, p_physics);
+					}
 				}
 			}
 
@@ -1363,8 +1495,8 @@ bool SceneTree::ProcessGroupSort::operator()(const ProcessGroup *p_left, const P
 	int right_order = p_right->owner ? p_right->owner->data.process_thread_group_order : 0;
 
 	if (left_order == right_order) {
-		int left_threaded = p_left->owner != nullptr && p_left->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD ? 0 : 1;
-		int right_threaded = p_right->owner != nullptr && p_right->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD ? 0 : 1;
+		int left_threaded = p_left->owner != nullptr && p_left->owner->_is_process_thread_group_threaded() ? 0 : 1;
+		int right_threaded = p_right->owner != nullptr && p_right->owner->_is_process_thread_group_threaded() ? 0 : 1;
 		return left_threaded < right_threaded;
 	} else {
 		return left_order < right_order;
@@ -1376,6 +1508,7 @@ void SceneTree::_remove_process_group(Node *p_node) {
 	ProcessGroup *pg = (ProcessGroup *)p_node->data.process_group;
 	ERR_FAIL_NULL(pg);
 	ERR_FAIL_COND(pg->removed);
+	_flush_pending_process_entries();
 	pg->removed = true;
 	pg->owner = nullptr;
 	p_node->data.process_group = nullptr;
@@ -1386,7 +1519,8 @@ void SceneTree::_add_process_group(Node *p_node) {
 	_THREAD_SAFE_METHOD_
 	ERR_FAIL_NULL(p_node);
 
-	ProcessGroup *pg = memnew(ProcessGroup);
+	// Groups share a call queue allocator, so that scenes with many small groups stay cheap.
+	ProcessGroup *pg = group_allocator.alloc(process_group_call_queue_allocator);
 
 	pg->owner = p_node;
 	p_node->data.process_group = pg;
@@ -1398,16 +1532,22 @@ void SceneTree::_add_process_group(Node *p_node) {
 
 void SceneTree::_remove_node_from_process_group(Node *p_node, Node *p_owner) {
 	_THREAD_SAFE_METHOD_
+	_flush_pending_process_entries();
 	ProcessGroup *pg = p_owner ? (ProcessGroup *)p_owner->data.process_group : &default_process_group;
 
+	// Search from the end, as the most recently added nodes are usually the first ones to be removed.
 	if (p_node->is_processing() || p_node->is_processing_internal()) {
-		bool found = pg->nodes.erase(p_node);
-		ERR_FAIL_COND(!found);
+		int64_t idx = pg->nodes.rfind(p_node);
+		ERR_FAIL_COND(idx < 0);
+		pg->nodes.remove_at(idx);
+		_update_process_group_access(pg, p_node, false, -1);
 	}
 
 	if (p_node->is_physics_processing() || p_node->is_physics_processing_internal()) {
-		bool found = pg->physics_nodes.erase(p_node);
-		ERR_FAIL_COND(!found);
+		int64_t idx = pg->physics_nodes.rfind(p_node);
+		ERR_FAIL_COND(idx < 0);
+		pg->physics_nodes.remove_at(idx);
+		_update_process_group_access(pg, p_node, true, -1);
 	}
 }
 
@@ -1415,22 +1555,191 @@ void SceneTree::_add_node_to_process_group(Node *p_node, Node *p_owner) {
 	_THREAD_SAFE_METHOD_
 	ProcessGroup *pg = p_owner ? (ProcessGroup *)p_owner->data.process_group : &default_process_group;
 
-	if (p_node->is_processing() || p_node->is_processing_internal()) {
+	bool process = p_node->is_processing() || p_node->is_processing_internal();
+	bool physics_process = p_node->is_physics_processing() || p_node->is_physics_processing_internal();
+
+	if (process) {
+		_update_process_group_access(pg, p_node, false, 1);
+	}
+	if (physics_process) {
+		_update_process_group_access(pg, p_node, true, 1);
+	}
+
+	if (enter_tree_batch_depth > 0) {
+		pending_process_entries.push_back({ pg, p_node, pending_process_entries.size(), process, physics_process });
+		return;
+	}
+
+	if (process) {
 		pg->nodes.push_back(p_node);
 		pg->node_order_dirty = true;
 	}
 
-	if (p_node->is_physics_processing() || p_node->is_physics_processing_internal()) {
+	if (physics_process) {
 		pg->physics_nodes.push_back(p_node);
 		pg->physics_node_order_dirty = true;
 	}
 }
 
+void SceneTree::_end_enter_tree_batch() {
+	ERR_FAIL_COND(enter_tree_batch_depth == 0);
+	enter_tree_batch_depth--;
+	if (enter_tree_batch_depth == 0) {
+		_flush_pending_group_entries();
+		_flush_pending_process_entries();
+	}
+}
+
+void SceneTree::_insert_pending_group_entries() {
+	_THREAD_SAFE_METHOD_
+
+	struct EntrySort {
+		_FORCE_INLINE_ bool operator()(const PendingGroupEntry &p_left, const PendingGroupEntry &p_right) const {
+			return p_left.group == p_right.group ? p_left.index < p_right.index : p_left.group < p_right.group;
+		}
+	};
+	pending_group_entries.sort_custom<EntrySort>();
+
+	// Each group grows once for all of its new nodes.
+	const PendingGroupEntry *entries = pending_group_entries.ptr();
+	uint32_t entry_count = pending_group_entries.size();
+	uint32_t from = 0;
+	while (from < entry_count) {
+		SceneTreeGroup &g = *entries[from].group;
+		uint32_t to = from + 1;
+		while (to < entry_count && entries[to].group == &g) {
+			to++;
+		}
+
+		int prev_size = g.nodes.size();
+		g.nodes.resize(prev_size + (to - from));
+		Node **gr_nodes = g.nodes.ptrw() + prev_size;
+		for (uint32_t i = from; i < to; i++) {
+			gr_nodes[i - from] = entries[i].node;
+			if (g.first && g.first->is_greater_than(entries[i].node)) {
+				g.first = entries[i].node;
+			}
+		}
+		g.changed = true;
+
+		from = to;
+	}
+
+	pending_group_entries.clear();
+}
+
+void SceneTree::_insert_pending_process_entries() {
+	_THREAD_SAFE_METHOD_
+
+	struct EntrySort {
+		_FORCE_INLINE_ bool operator()(const PendingProcessEntry &p_left, const PendingProcessEntry &p_right) const {
+			return p_left.group == p_right.group ? p_left.index < p_right.index : p_left.group < p_right.group;
+		}
+	};
+	pending_process_entries.sort_custom<EntrySort>();
+
+	// Each process list grows once for all of its new nodes, and is sorted by priority once before processing.
+	const PendingProcessEntry *entries = pending_process_entries.ptr();
+	uint32_t entry_count = pending_process_entries.size();
+	uint32_t from = 0;
+	while (from < entry_count) {
+		ProcessGroup *pg = entries[from].group;
+		uint32_t to = from + 1;
+		uint32_t process_count = entries[from].process;
+		uint32_t physics_process_count = entries[from].physics_process;
+		while (to < entry_count && entries[to].group == pg) {
+			process_count += entries[to].process;
+			physics_process_count += entries[to].physics_process;
+			to++;
+		}
+
+		int process_from = pg->nodes.size();
+		int physics_process_from = pg->physics_nodes.size();
+		pg->nodes.resize(process_from + process_count);
+		pg->physics_nodes.resize(physics_process_from + physics_process_count);
+		Node **nodes = pg->nodes.ptrw() + process_from;
+		Node **physics_nodes = pg->physics_nodes.ptrw() + physics_process_from;
+		for (uint32_t i = from; i < to; i++) {
+			if (entries[i].process) {
+				*nodes++ = entries[i].node;
+			}
+			if (entries[i].physics_process) {
+				*physics_nodes++ = entries[i].node;
+			}
+		}
+		if (process_count > 0) {
+			pg->node_order_dirty = true;
+		}
+		if (physics_process_count > 0) {
+			pg->physics_node_order_dirty = true;
+		}
+
+		from = to;
+	}
+
+	pending_process_entries.clear();
+}
+
+void SceneTree::_update_process_group_access(ProcessGroup *p_group, const Node *p_node, bool p_physics, int p_delta) {
+	switch (p_node->data.process_thread_access) {
+		case Node::PROCESS_THREAD_ACCESS_SUBTREE:
+			break;
+		case Node::PROCESS_THREAD_ACCESS_READ_OUTSIDE:
+			p_group->read_outside_count[p_physics] += p_delta;
+			break;
+		case Node::PROCESS_THREAD_ACCESS_WRITE_OUTSIDE:
+			p_group->write_outside_count[p_physics] += p_delta;
+			break;
+	}
+}
+
+SceneTree::ProcessGroupPhase SceneTree::_get_process_group_phase(const ProcessGroup *p_group, bool p_physics) const {
+	// Only automatic groups are scheduled from the declarations, other threaded groups are trusted to be independent.
+	if (!p_group->owner || p_group->owner->data.process_thread_group != Node::PROCESS_THREAD_GROUP_AUTO) {
+		return PROCESS_GROUP_PHASE_PARALLEL;
+	}
+
+	if (p_group->write_outside_count[p_physics] > 0) {
+		return PROCESS_GROUP_PHASE_SERIAL;
+	}
+	if (p_group->read_outside_count[p_physics] > 0) {
+		return PROCESS_GROUP_PHASE_PARALLEL_READ;
+	}
+	return PROCESS_GROUP_PHASE_PARALLEL;
+}
+
+#ifdef DEBUG_ENABLED
+bool SceneTree::_is_readable_from_process_group(const Node *p_group_owner, const Node *p_node) const {
+	const ProcessGroup *pg = (const ProcessGroup *)p_group_owner->data.process_group;
+	if (!pg) {
+		return true;
+	}
+
+	switch (pg->phase) {
+		case PROCESS_GROUP_PHASE_PARALLEL: {
+			ERR_FAIL_V_MSG(false, vformat("%s: Can't be read while processing the automatic thread group of %s, as none of its nodes declared reading outside of the group. Set their `process_thread_access` to Read Outside.", p_node->get_description(), p_group_owner->get_description()));
+		} break;
+		case PROCESS_GROUP_PHASE_PARALLEL_READ: {
+			// Groups reading outside of their subtree run together, so they can't read each other.
+			const Node *owner = p_node->data.process_thread_group_owner;
+			const ProcessGroup *other = owner ? (const ProcessGroup *)owner->data.process_group : nullptr;
+			if (other && other != pg && other->read_phase_pass == pg->read_phase_pass) {
+				ERR_FAIL_V_MSG(false, vformat("%s: Can't be read while processing the automatic thread group of %s, as its own automatic thread group is processed at the same time.", p_node->get_description(), p_group_owner->get_description()));
+			}
+		} break;
+		case PROCESS_GROUP_PHASE_SERIAL: {
+		} break;
+	}
+	return true;
+}
+#endif // DEBUG_ENABLED
+
 void SceneTree::_call_input_pause(const StringName &p_group, CallInputType p_call_type, const Ref<InputEvent> &p_input, Viewport *p_viewport) {
 	Vector<Node *> nodes_copy;
 	{
 		_THREAD_SAFE_METHOD_
 
+		_flush_pending_group_entries();
 		HashMap<StringName, SceneTreeGroup>::Iterator E = group_map.find(p_group);
 		if (!E) {
 			return;
@@ -1448,7 +1757,7 @@ void SceneTree::_call_input_pause(const StringName &p_group, CallInputType p_cal
 	}
 
 	int gr_node_count = nodes_copy.size();
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr();
 
 	{
 		_THREAD_SAFE_METHOD_
@@ -1554,6 +1863,7 @@ int64_t SceneTree::get_frame() const {
 TypedArray<Node> SceneTree::_get_nodes_in_group(const StringName &p_group) {
 	_THREAD_SAFE_METHOD_
 	TypedArray<Node> ret;
+	_flush_pending_group_entries();
 	HashMap<StringName, SceneTreeGroup>::Iterator E = group_map.find(p_group);
 	if (!E) {
 		return ret;
@@ -1567,7 +1877,7 @@ TypedArray<Node> SceneTree::_get_nodes_in_group(const StringName &p_group) {
 
 	ret.resize(nc);
 
-	Node **ptr = E->value.nodes.ptrw();
+	Node *const *ptr = E->value.nodes.ptr();
 	for (int i = 0; i < nc; i++) {
 		ret[i] = ptr[i];
 	}
@@ -1582,6 +1892,7 @@ bool SceneTree::has_group(const StringName &p_identifier) const {
 
 int SceneTree::get_node_count_in_group(const StringName &p_group) const {
 	_THREAD_SAFE_METHOD_
+	const_cast<SceneTree *>(this)->_flush_pending_group_entries();
 	HashMap<StringName, SceneTreeGroup>::ConstIterator E = group_map.find(p_group);
 	if (!E) {
 		return 0;
@@ -1592,22 +1903,37 @@ int SceneTree::get_node_count_in_group(const StringName &p_group) const {
 
 Node *SceneTree::get_first_node_in_group(const StringName &p_group) {
 	_THREAD_SAFE_METHOD_
+	_flush_pending_group_entries();
 	HashMap<StringName, SceneTreeGroup>::Iterator E = group_map.find(p_group);
 	if (!E) {
 		return nullptr; // No group.
 	}
 
-	_update_group_order(E->value); // Update order just in case.
-
-	if (E->value.nodes.is_empty()) {
+	SceneTreeGroup &g = E->value;
+	if (g.nodes.is_empty()) {
 		return nullptr;
 	}
 
-	return E->value.nodes[0];
+	if (!g.changed) {
+		return g.nodes[0];
+	}
+
+	// Finding the first node doesn't need the whole group to be sorted.
+	if (!g.first) {
+		Node *const *gr_nodes = g.nodes.ptr();
+		g.first = gr_nodes[0];
+		for (int i = 1; i < g.nodes.size(); i++) {
+			if (g.first->is_greater_than(gr_nodes[i])) {
+				g.first = gr_nodes[i];
+			}
+		}
+	}
+	return g.first;
 }
 
 Vector<Node *> SceneTree::get_nodes_in_group(const StringName &p_group) {
 	_THREAD_SAFE_METHOD_
+	_flush_pending_group_entries();
 	HashMap<StringName, SceneTreeGroup>::Iterator E = group_map.find(p_group);
 	if (!E) {
 		return {};
@@ -2249,7 +2575,7 @@ SceneTree::~SceneTree() {
 	// Process groups are not deleted immediately, they may remain around. Delete them now.
 	for (uint32_t i = 0; i < process_groups.size(); i++) {
 		if (process_groups[i] != &default_process_group) {
-			memdelete(process_groups[i]);
+			group_allocator.free(process_groups[i]);
 		}
 	}
 
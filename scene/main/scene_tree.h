@@ -36,6 +36,7 @@
 #include "core/os/thread_safe.h"
 #include "core/templates/paged_allocator.h"
 #include "core/templates/self_list.h"
+#include "core/templates/span.h"
 #include "scene/main/scene_tree_fti.h"
 
 #include <cstdlib>
@@ -84,6 +85,10 @@ public:
 struct SceneTreeGroup {
 	Vector<Node *> nodes;
 	bool changed = false;
+	// First node in tree order, when known while the group is not sorted. It's kept up to date as
+	// nodes join the group or move, but it's lost when the first node leaves the group or moves
+	// after some of its siblings, and the next `get_first_node_in_group()` then scans the group.
+	Node *first = nullptr;
 };
 
 class SceneTree : public MainLoop {
@@ -97,15 +102,32 @@ public:
 private:
 	CallQueue::Allocator *process_group_call_queue_allocator = nullptr;
 
+	// When the threaded groups of an automatic group are processed, inferred from what their nodes declared to access.
+	enum ProcessGroupPhase {
+		PROCESS_GROUP_PHASE_PARALLEL, // Only accesses its own nodes, runs alongside the other groups.
+		PROCESS_GROUP_PHASE_PARALLEL_READ, // Reads other nodes, runs once the groups above are done.
+		PROCESS_GROUP_PHASE_SERIAL, // Writes other nodes, runs alone on the main thread.
+	};
+
 	struct ProcessGroup {
 		CallQueue call_queue;
 		Vector<Node *> nodes;
 		Vector<Node *> physics_nodes;
+		LocalVector<Node *> batch_nodes; // Scratch list for gathering batch processed nodes.
 		bool node_order_dirty = true;
 		bool physics_node_order_dirty = true;
 		bool removed = false;
 		Node *owner = nullptr;
 		uint64_t last_pass = 0;
+
+		// Processing nodes that declared to access nodes outside of the group, for regular and physics processing.
+		uint32_t read_outside_count[2] = {};
+		uint32_t write_outside_count[2] = {};
+		ProcessGroupPhase phase = PROCESS_GROUP_PHASE_PARALLEL;
+		uint64_t read_phase_pass = 0; // Set to `process_read_phase_pass` when processed in the reading phase.
+
+		ProcessGroup(CallQueue::Allocator *p_call_queue_allocator = nullptr) :
+				call_queue(p_call_queue_allocator) {}
 	};
 
 	struct ProcessGroupSort {
@@ -117,7 +139,11 @@ private:
 	LocalVector<ProcessGroup *> process_groups;
 	bool process_groups_dirty = true;
 	LocalVector<ProcessGroup *> local_process_group_cache; // Used when processing to group what needs to
+	LocalVector<ProcessGroup *> local_process_group_read_cache; // Automatic groups processed after the others.
+	LocalVector<ProcessGroup *> local_process_group_serial_cache; // Automatic groups processed on the main thread.
+	uint64_t process_read_phase_pass = 0;
 	uint64_t process_last_pass = 1;
+	uint64_t thread_groups_usec = 0; // Total time spent waiting for groups processed on worker threads.
 
 	ProcessGroup default_process_group;
 
@@ -148,6 +174,24 @@ private:
 	HashMap<StringName, SceneTreeGroup> group_map;
 	bool _quit = false;
 
+	// While a subtree enters the tree, its nodes are only queued for their groups and process lists.
+	// They are inserted at once when the subtree is done entering, or before anything reads them.
+	struct PendingGroupEntry {
+		SceneTreeGroup *group = nullptr;
+		Node *node = nullptr;
+		uint32_t index = 0; // Keeps the insertion order when sorting by group.
+	};
+	struct PendingProcessEntry {
+		ProcessGroup *group = nullptr;
+		Node *node = nullptr;
+		uint32_t index = 0;
+		bool process = false;
+		bool physics_process = false;
+	};
+	uint32_t enter_tree_batch_depth = 0;
+	LocalVector<PendingGroupEntry> pending_group_entries;
+	LocalVector<PendingProcessEntry> pending_process_entries;
+
 	// Static so we can get directly instead of via SceneTree pointer.
 	static bool _physics_interpolation_enabled;
 
@@ -198,6 +242,28 @@ private:
 
 	_FORCE_INLINE_ void _update_group_order(SceneTreeGroup &g);
 
+	void _begin_enter_tree_batch() { enter_tree_batch_depth++; }
+	void _end_enter_tree_batch();
+	void _insert_pending_group_entries();
+	void _insert_pending_process_entries();
+	_FORCE_INLINE_ void _flush_pending_group_entries() {
+		if (unlikely(!pending_group_entries.is_empty())) {
+			_insert_pending_group_entries();
+		}
+	}
+	_FORCE_INLINE_ void _flush_pending_process_entries() {
+		if (unlikely(!pending_process_entries.is_empty())) {
+			_insert_pending_process_entries();
+		}
+	}
+
+	struct GroupCallCache {
+		StringName class_name;
+		MethodBind *method = nullptr;
+		bool method_valid = false;
+	};
+	void _call_group_node(Node *p_node, const StringName &p_function, const Variant **p_args, int p_argcount, GroupCallCache &r_cache);
+
 	TypedArray<Node> _get_nodes_in_group(const StringName &p_group);
 
 	Node *current_scene = nullptr;
@@ -238,7 +304,14 @@ private:
 	void remove_from_group(const StringName &p_group, Node *p_node);
 
 	void _process_group(ProcessGroup *p_group, bool p_physics);
+	uint32_t _process_batch(ProcessGroup *p_group, Node *const *p_nodes, uint32_t p_from, uint32_t p_count, void (*p_func)(Span<Node *>, double), bool p_physics);
 	void _process_groups_thread(uint32_t p_index, bool p_physics);
+	void _process_groups_threaded(bool p_physics);
+	void _update_process_group_access(ProcessGroup *p_group, const Node *p_node, bool p_physics, int p_delta);
+	ProcessGroupPhase _get_process_group_phase(const ProcessGroup *p_group, bool p_physics) const;
+#ifdef DEBUG_ENABLED
+	bool _is_readable_from_process_group(const Node *p_group_owner, const Node *p_node) const;
+#endif // DEBUG_ENABLED
 	void _process(bool p_physics);
 
 	void _remove_process_group(Node *p_node);
@@ -408,9 +481,12 @@ public:
 	int64_t get_frame() const;
 
 	int get_node_count() const;
+	uint64_t get_thread_groups_usec() const { return thread_groups_usec; }
 
 	void queue_delete(RequiredParam<Object> rp_object);
 
+	// Returns a snapshot sharing the group's list, in tree order. It's only copied if the group
+	// changes while the snapshot is alive, so it can be iterated without copying the group.
 	Vector<Node *> get_nodes_in_group(const StringName &p_group);
 	Node *get_first_node_in_group(const StringName &p_group);
 	bool has_group(const StringName &p_identifier) const;
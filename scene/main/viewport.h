@@ -294,6 +294,7 @@ private:
 
 	Ref<World2D> world_2d;
 
+	friend class Node; // Joins the input groups when entering the tree.
 	StringName input_group;
 	StringName shortcut_input_group;
 	StringName unhandled_input_group;
@@ -148,6 +148,7 @@
 #include "scene/resources/placeholder_textures.h"
 #include "scene/resources/portable_compressed_texture.h"
 #include "scene/resources/resource_format_text.h"
+#include "scene/resources/scene_pool.h"
 #include "scene/resources/shader_include.h"
 #include "scene/resources/shader_include_resource_format.h"
 #include "scene/resources/shader_resource_format.h"
@@ -725,6 +726,7 @@ void register_scene_types() {
 	GDREGISTER_CLASS(PhysicalBoneSimulator3D);
 	GDREGISTER_CLASS(PhysicalBone3D);
 	GDREGISTER_CLASS(SoftBody3D);
+	PhysicsServer3D::set_body_state_sync_batch_callback(RigidBody3D::sync_batched_body_states);
 #endif // PHYSICS_3D_DISABLED
 
 	GDREGISTER_CLASS(BoneAttachment3D);
@@ -813,6 +815,7 @@ void register_scene_types() {
 	GDREGISTER_CLASS(CollisionPolygon2D);
 	GDREGISTER_CLASS(RayCast2D);
 	GDREGISTER_CLASS(ShapeCast2D);
+	PhysicsServer2D::set_body_state_sync_batch_callback(RigidBody2D::sync_batched_body_states);
 #endif // PHYSICS_2D_DISABLED
 	GDREGISTER_CLASS(VisibleOnScreenNotifier2D);
 	GDREGISTER_CLASS(VisibleOnScreenEnabler2D);
@@ -1085,6 +1088,7 @@ void register_scene_types() {
 
 	GDREGISTER_ABSTRACT_CLASS(SceneState);
 	GDREGISTER_CLASS(PackedScene);
+	GDREGISTER_CLASS(ScenePool);
 
 	GDREGISTER_CLASS(SceneTree);
 	GDREGISTER_ABSTRACT_CLASS(SceneTreeTimer); // sorry, you can't create it
@@ -60,6 +60,7 @@ public:
 	real_t get_max_height() const;
 
 	void update_map_data_from_image(const Ref<Image> &p_image, real_t p_height_min, real_t p_height_max);
+	void update_map_data_region(const Rect2i &p_region, const Vector<real_t> &p_data);
 
 	virtual Vector<Vector3> get_debug_mesh_lines() const override;
 	virtual Ref<ArrayMesh> get_debug_arraymesh_faces(const Color &p_modulate) const override;
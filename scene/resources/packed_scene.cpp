@@ -152,6 +152,53 @@ static Node *_find_node_by_id(Node *p_owner, Node *p_node, int32_t p_id) {
 	return nullptr;
 }
 
+const SceneState::InstantiationPlan *SceneState::_get_instantiation_plan() const {
+	if (Engine::get_singleton()->is_editor_hint()) {
+		return nullptr; // Classes and scenes can change at any time in the editor.
+	}
+
+	if (instantiation_plan_ready.is_set()) {
+		return &instantiation_plan;
+	}
+
+	MutexLock lock(instantiation_plan_mutex);
+	if (instantiation_plan_ready.is_set()) {
+		return &instantiation_plan;
+	}
+
+	int sname_count = names.size();
+	instantiation_plan.node_setters.resize(nodes.size());
+	for (int i = 0; i < nodes.size(); i++) {
+		const NodeData &n = nodes[i];
+		instantiation_plan.node_setters[i] = instantiation_plan.setters.size();
+
+		// Only nodes created from a class that can't be changed by an extension get resolved setters.
+		bool native = n.type != TYPE_INSTANTIATED && n.instance < 0 && !(i == 0 && base_scene_idx >= 0) && n.type >= 0 && n.type < sname_count;
+		if (native) {
+			ClassDB::APIType api = ClassDB::get_api_type(names[n.type]);
+			native = ClassDB::class_exists(names[n.type]) && (api == ClassDB::API_CORE || api == ClassDB::API_EDITOR);
+		}
+
+		for (const NodeData::Property &prop : n.properties) {
+			InstantiationPlan::Setter setter;
+			if (native && !(prop.name & FLAG_PATH_PROPERTY_IS_NODE) && prop.name >= 0 && prop.name < sname_count && names[prop.name] != CoreStringName(script)) {
+				setter.method = ClassDB::get_property_setter_bind(names[n.type], names[prop.name], &setter.index);
+			}
+			instantiation_plan.setters.push_back(setter);
+		}
+	}
+
+	instantiation_plan_ready.set();
+	return &instantiation_plan;
+}
+
+void SceneState::_clear_instantiation_plan() {
+	MutexLock lock(instantiation_plan_mutex);
+	instantiation_plan_ready.clear();
+	instantiation_plan.node_setters.clear();
+	instantiation_plan.setters.clear();
+}
+
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
@@ -199,6 +246,8 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	bool deep_search_warned = false;
 
+	const InstantiationPlan *plan = _get_instantiation_plan();
+
 	for (int i = 0; i < nc; i++) {
 		const NodeData &n = nd[i];
 
@@ -225,6 +274,7 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 		Node *node = nullptr;
 		MissingNode *missing_node = nullptr;
 		bool is_inherited_scene = false;
+		bool is_created_from_type = false;
 
 		if (i == 0 && base_scene_idx >= 0) {
 			// Scene inheritance on root node.
@@ -318,6 +368,7 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			Object *obj = ClassDB::instantiate(snames[n.type]);
 
 			node = Object::cast_to<Node>(obj);
+			is_created_from_type = node != nullptr;
 
 			if (!node) {
 				if (obj) {
@@ -365,6 +416,7 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			int nprop_count = n.properties.size();
 			if (nprop_count) {
 				const NodeData::Property *nprops = &n.properties[0];
+				const InstantiationPlan::Setter *nsetters = (plan && is_created_from_type) ? plan->setters.ptr() + plan->node_setters[i] : nullptr;
 
 				Dictionary missing_resource_properties;
 
@@ -491,7 +543,12 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						}
 
 						if (set_valid) {
-							node->set(snames[nprops[j].name], value, &valid);
+							if (nsetters && nsetters[j].method && !node->get_script_instance()) {
+								// Same as `Object::set()` for a node without script, minus the lookup.
+								ClassDB::set_property_with_setter_bind(node, nsetters[j].method, nsetters[j].index, value, &valid);
+							} else {
+								node->set(snames[nprops[j].name], value, &valid);
+							}
 						}
 						if (p_edit_state == GEN_EDIT_STATE_INSTANCE && value.get_type() != Variant::OBJECT) {
 							value = value.duplicate(true); // Duplicate arrays and dictionaries for the editor.
@@ -1435,6 +1492,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	_clear_instantiation_plan();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1669,6 +1727,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 
 	ERR_FAIL_COND_MSG(version > PACKED_SCENE_VERSION, "Save format version too new.");
 
+	_clear_instantiation_plan();
+
 	const int node_count = p_dictionary["node_count"];
 	const Vector<int> snodes = p_dictionary["nodes"];
 	ERR_FAIL_COND(snodes.size() < node_count);
@@ -2297,6 +2357,7 @@ Vector<Ref<Resource>> SceneState::get_sub_resources() {
 //add
 
 int SceneState::add_name(const StringName &p_name) {
+	_clear_instantiation_plan();
 	names.push_back(p_name);
 	return names.size() - 1;
 }
@@ -2321,6 +2382,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 	nd.instance = p_instance;
 	nd.index = p_index;
 
+	_clear_instantiation_plan();
 	nodes.push_back(nd);
 
 	ids.push_back(p_unique_id);
@@ -2339,6 +2401,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 		prop.name |= FLAG_PATH_PROPERTY_IS_NODE;
 	}
 	prop.value = p_value;
+	_clear_instantiation_plan();
 	nodes.write[p_node].properties.push_back(prop);
 }
 
@@ -2527,6 +2590,24 @@ Node *PackedScene::instantiate(GenEditState p_edit_state) const {
 	return s;
 }
 
+TypedArray<Node> PackedScene::instantiate_multiple(int p_count, GenEditState p_edit_state) const {
+	ERR_FAIL_COND_V(p_count < 0, TypedArray<Node>());
+
+	TypedArray<Node> ret;
+	ret.resize(p_count);
+	for (int i = 0; i < p_count; i++) {
+		Node *s = instantiate(p_edit_state);
+		if (!s) {
+			for (int j = 0; j < i; j++) {
+				memdelete(Object::cast_to<Node>(ret[j]));
+			}
+			ERR_FAIL_V(TypedArray<Node>());
+		}
+		ret[i] = s;
+	}
+	return ret;
+}
+
 void PackedScene::replace_state(Ref<SceneState> p_by) {
 	state = p_by;
 	state->set_path(get_path());
@@ -2613,6 +2694,7 @@ void PackedScene::reset_state() {
 void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pack", "path"), &PackedScene::pack);
 	ClassDB::bind_method(D_METHOD("instantiate", "edit_state"), &PackedScene::instantiate, DEFVAL(GEN_EDIT_STATE_DISABLED));
+	ClassDB::bind_method(D_METHOD("instantiate_multiple", "count", "edit_state"), &PackedScene::instantiate_multiple, DEFVAL(GEN_EDIT_STATE_DISABLED));
 	ClassDB::bind_method(D_METHOD("can_instantiate"), &PackedScene::can_instantiate);
 	ClassDB::bind_method(D_METHOD("_set_bundled_scene", "scene"), &PackedScene::_set_bundled_scene);
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
@@ -31,6 +31,8 @@
 #pragma once
 
 #include "core/io/resource.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
 #include "scene/main/node.h"
 
 class PackedScene;
@@ -92,6 +94,25 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// Property setters of natively created nodes, resolved on the first instantiation outside of the editor
+	// so that the next ones can call them directly instead of looking properties up by name.
+	struct InstantiationPlan {
+		struct Setter {
+			MethodBind *method = nullptr;
+			int index = -1;
+		};
+
+		LocalVector<uint32_t> node_setters; // Offset of the setters of each node's properties.
+		LocalVector<Setter> setters;
+	};
+
+	mutable InstantiationPlan instantiation_plan;
+	mutable SafeFlag instantiation_plan_ready;
+	mutable BinaryMutex instantiation_plan_mutex;
+
+	const InstantiationPlan *_get_instantiation_plan() const;
+	void _clear_instantiation_plan();
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map, HashSet<int32_t> &ids_saved);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -271,6 +292,7 @@ public:
 
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
+	TypedArray<Node> instantiate_multiple(int p_count, GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
 
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
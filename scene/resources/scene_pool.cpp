@@ -0,0 +1,256 @@
+/**************************************************************************/
+/*  scene_pool.cpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "scene_pool.h"
+
+#include "core/object/class_db.h"
+
+void ScenePool::_capture_node_defaults(Node *p_root, Node *p_node) {
+	NodeDefaults node_defaults;
+	node_defaults.path = p_root->get_path_to(p_node);
+
+	List<PropertyInfo> plist;
+	p_node->get_property_list(&plist);
+	for (const PropertyInfo &pi : plist) {
+		if (!(pi.usage & PROPERTY_USAGE_STORAGE) || pi.name == CoreStringName(script)) {
+			continue;
+		}
+		Variant value = p_node->get(pi.name);
+		if (value.get_type() == Variant::ARRAY || value.get_type() == Variant::DICTIONARY) {
+			value = value.duplicate(true); // Don't share containers with the instance they were taken from.
+		}
+		node_defaults.properties.push_back(pi.name);
+		node_defaults.values.push_back(value);
+	}
+	default_paths.insert(node_defaults.path);
+	defaults.push_back(node_defaults);
+
+	for (int i = 0; i < p_node->get_child_count(false); i++) {
+		_capture_node_defaults(p_root, p_node->get_child(i, false));
+	}
+}
+
+void ScenePool::_capture_defaults(Node *p_root) {
+	defaults.clear();
+	default_paths.clear();
+	_capture_node_defaults(p_root, p_root);
+	defaults_ready = true;
+}
+
+void ScenePool::_free_added_children(Node *p_root, Node *p_node) {
+	// Internal children are left alone, they are managed by the node that added them.
+	for (int i = p_node->get_child_count(false) - 1; i >= 0; i--) {
+		Node *child = p_node->get_child(i, false);
+		if (default_paths.has(p_root->get_path_to(child))) {
+			_free_added_children(p_root, child);
+		} else {
+			p_node->remove_child(child);
+			memdelete(child);
+		}
+	}
+}
+
+void ScenePool::_reset(Node *p_root) {
+	// Children added while the instance was in use would pile up with every reuse.
+	_free_added_children(p_root, p_root);
+
+	for (const NodeDefaults &node_defaults : defaults) {
+		Node *node = p_root->get_node_or_null(node_defaults.path);
+		if (!node) {
+			continue; // Removed while it was in use.
+		}
+
+		// Every stored property is compared, not only the ones the scene sets: setters don't report changes, and
+		// properties left at their class default in the scene (like the position of the root) change at runtime too.
+		// Only the ones that changed are set again, most properties of a recycled instance are still at their defaults.
+		for (uint32_t i = 0; i < node_defaults.properties.size(); i++) {
+			const Variant &value = node_defaults.values[i];
+			if (node->get(node_defaults.properties[i]) == value) {
+				continue;
+			}
+			if (value.get_type() == Variant::ARRAY || value.get_type() == Variant::DICTIONARY) {
+				node->set(node_defaults.properties[i], value.duplicate(true));
+			} else {
+				node->set(node_defaults.properties[i], value);
+			}
+		}
+
+		node->request_ready();
+	}
+}
+
+Node *ScenePool::_instantiate() {
+	ERR_FAIL_COND_V_MSG(scene.is_null(), nullptr, "ScenePool has no scene to instantiate.");
+
+	Node *node = scene->instantiate();
+	ERR_FAIL_NULL_V(node, nullptr);
+
+	if (!defaults_ready) {
+		_capture_defaults(node);
+	}
+
+	if (instances.size() >= instances_prune_size) {
+		// Forget instances that were freed by the user instead of being released.
+		LocalVector<ObjectID> freed;
+		for (const ObjectID &id : instances) {
+			if (!ObjectDB::get_instance(id)) {
+				freed.push_back(id);
+			}
+		}
+		for (const ObjectID &id : freed) {
+			instances.erase(id);
+		}
+		instances_prune_size = MAX(64u, instances.size() * 2);
+	}
+	instances.insert(node->get_instance_id());
+
+	return node;
+}
+
+void ScenePool::set_scene(const Ref<PackedScene> &p_scene) {
+	if (scene == p_scene) {
+		return;
+	}
+
+	clear();
+	instances.clear();
+	defaults.clear();
+	default_paths.clear();
+	defaults_ready = false;
+	scene = p_scene;
+}
+
+Ref<PackedScene> ScenePool::get_scene() const {
+	return scene;
+}
+
+void ScenePool::set_max_size(int p_max_size) {
+	ERR_FAIL_COND(p_max_size < 0);
+	max_size = p_max_size;
+
+	while (available.size() > (uint32_t)max_size) {
+		Node *node = ObjectDB::get_instance<Node>(available[available.size() - 1]);
+		instances.erase(available[available.size() - 1]);
+		available.resize(available.size() - 1);
+		if (node) {
+			memdelete(node);
+		}
+	}
+}
+
+int ScenePool::get_max_size() const {
+	return max_size;
+}
+
+void ScenePool::prewarm(int p_count) {
+	ERR_FAIL_COND(p_count < 0);
+
+	int count = MIN(p_count, max_size) - (int)available.size();
+	for (int i = 0; i < count; i++) {
+		Node *node = _instantiate();
+		ERR_FAIL_NULL(node);
+		available.push_back(node->get_instance_id());
+	}
+}
+
+Node *ScenePool::acquire() {
+	while (!available.is_empty()) {
+		ObjectID id = available[available.size() - 1];
+		available.resize(available.size() - 1);
+
+		Node *node = ObjectDB::get_instance<Node>(id);
+		if (node) {
+			return node;
+		}
+		instances.erase(id);
+	}
+
+	return _instantiate();
+}
+
+void ScenePool::release(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+	ObjectID id = p_node->get_instance_id();
+	ERR_FAIL_COND_MSG(!instances.has(id), "Node was not acquired from this ScenePool.");
+	ERR_FAIL_COND_MSG(available.has(id), "Node was already released to this ScenePool.");
+	ERR_FAIL_COND_MSG(p_node->is_queued_for_deletion(), "Can't release a node that is queued for deletion.");
+
+	// Leaving the tree takes physics objects out of their space and visuals out of their scenario,
+	// and entering it again puts them back, so their server resources need no extra handling.
+	Node *parent = p_node->get_parent();
+	if (parent) {
+		parent->remove_child(p_node);
+		ERR_FAIL_COND_MSG(p_node->get_parent(), "Node could not be removed from its parent, use `release.call_deferred(node)` instead.");
+	}
+
+	if (available.size() >= (uint32_t)max_size) {
+		instances.erase(id);
+		p_node->queue_free();
+		return;
+	}
+
+	_reset(p_node);
+	available.push_back(id);
+}
+
+int ScenePool::get_available_count() const {
+	return available.size();
+}
+
+void ScenePool::clear() {
+	for (const ObjectID &id : available) {
+		Node *node = ObjectDB::get_instance<Node>(id);
+		instances.erase(id);
+		if (node) {
+			memdelete(node);
+		}
+	}
+	available.clear();
+}
+
+void ScenePool::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_scene", "scene"), &ScenePool::set_scene);
+	ClassDB::bind_method(D_METHOD("get_scene"), &ScenePool::get_scene);
+	ClassDB::bind_method(D_METHOD("set_max_size", "max_size"), &ScenePool::set_max_size);
+	ClassDB::bind_method(D_METHOD("get_max_size"), &ScenePool::get_max_size);
+
+	ClassDB::bind_method(D_METHOD("prewarm", "count"), &ScenePool::prewarm);
+	ClassDB::bind_method(D_METHOD("acquire"), &ScenePool::acquire);
+	ClassDB::bind_method(D_METHOD("release", "node"), &ScenePool::release);
+	ClassDB::bind_method(D_METHOD("get_available_count"), &ScenePool::get_available_count);
+	ClassDB::bind_method(D_METHOD("clear"), &ScenePool::clear);
+
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "scene", PROPERTY_HINT_RESOURCE_TYPE, "PackedScene"), "set_scene", "get_scene");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_size", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), "set_max_size", "get_max_size");
+}
+
+ScenePool::~ScenePool() {
+	clear();
+}
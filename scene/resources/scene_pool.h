@@ -0,0 +1,84 @@
+/**************************************************************************/
+/*  scene_pool.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/object/ref_counted.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
+#include "scene/resources/packed_scene.h"
+
+class ScenePool : public RefCounted {
+	GDCLASS(ScenePool, RefCounted);
+
+	// State of a freshly instantiated scene, used to reset released instances. Holds all the stored properties,
+	// including the ones at their class default, as any of them can be changed while the instance is in use.
+	struct NodeDefaults {
+		NodePath path;
+		LocalVector<StringName> properties;
+		LocalVector<Variant> values;
+	};
+
+	Ref<PackedScene> scene;
+	int max_size = 64;
+
+	LocalVector<NodeDefaults> defaults;
+	HashSet<NodePath> default_paths;
+	bool defaults_ready = false;
+
+	LocalVector<ObjectID> available;
+	HashSet<ObjectID> instances;
+	uint32_t instances_prune_size = 64;
+
+	void _capture_defaults(Node *p_root);
+	void _capture_node_defaults(Node *p_root, Node *p_node);
+	void _free_added_children(Node *p_root, Node *p_node);
+	void _reset(Node *p_root);
+	Node *_instantiate();
+
+protected:
+	static void _bind_methods();
+
+public:
+	void set_scene(const Ref<PackedScene> &p_scene);
+	Ref<PackedScene> get_scene() const;
+
+	void set_max_size(int p_max_size);
+	int get_max_size() const;
+
+	void prewarm(int p_count);
+	Node *acquire();
+	void release(Node *p_node);
+
+	int get_available_count() const;
+	void clear();
+
+	~ScenePool();
+};
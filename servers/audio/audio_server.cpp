@@ -37,6 +37,7 @@
 #include "core/math/audio_frame.h"
 #include "core/object/class_db.h"
 #include "core/os/os.h"
+#include "core/os/thread.h"
 #include "core/string/string_name.h"
 #include "core/templates/pair.h"
 #include "scene/scene_string_names.h"
@@ -1665,7 +1666,15 @@ void AudioServer::finish() {
 /* MISC config */
 
 void AudioServer::lock() {
+	if (!Thread::is_main_thread()) {
+		AudioDriver::get_singleton()->lock();
+		return;
+	}
+
+	// The mixing thread holds the lock while mixing, which stalls the main thread.
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
 	AudioDriver::get_singleton()->lock();
+	main_thread_lock_wait_usec += OS::get_singleton()->get_ticks_usec() - begin;
 }
 
 void AudioServer::unlock() {
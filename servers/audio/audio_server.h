@@ -215,6 +215,7 @@ private:
 #ifdef DEBUG_ENABLED
 	SafeNumeric<uint64_t> prof_time;
 #endif
+	uint64_t main_thread_lock_wait_usec = 0;
 
 	float channel_disable_threshold_db = 0.0f;
 	uint32_t channel_disable_frames = 0;
@@ -463,6 +464,8 @@ public:
 
 	virtual void lock();
 	virtual void unlock();
+	// Total time the main thread spent waiting in `lock()`, in microseconds.
+	uint64_t get_main_thread_lock_wait_usec() const { return main_thread_lock_wait_usec; }
 
 	virtual SpeakerMode get_speaker_mode() const;
 	virtual float get_mix_rate() const;
@@ -359,6 +359,69 @@ Dictionary PhysicsDirectSpaceState2D::_intersect_ray(RequiredParam<PhysicsRayQue
 	return d;
 }
 
+Dictionary PhysicsDirectSpaceState2D::_intersect_rays(RequiredParam<PhysicsRayQueryParameters2D> rp_ray_query, const PackedVector2Array &p_from, const PackedVector2Array &p_to) {
+	EXTRACT_PARAM_OR_FAIL_V(p_ray_query, rp_ray_query, Dictionary());
+	ERR_FAIL_COND_V_MSG(p_from.size() != p_to.size(), Dictionary(), "The arrays of ray origins and ends must have the same size.");
+
+	const int count = p_from.size();
+
+	LocalVector<RayResult> results;
+	results.resize(count);
+	LocalVector<bool> hits;
+	hits.resize(count);
+
+	intersect_rays(p_ray_query->get_parameters(), p_from.ptr(), p_to.ptr(), count, results.ptr(), hits.ptr());
+
+	PackedByteArray hit;
+	hit.resize(count);
+	PackedVector2Array position;
+	position.resize(count);
+	PackedVector2Array normal;
+	normal.resize(count);
+	PackedInt64Array collider_id;
+	collider_id.resize(count);
+	PackedInt32Array shape;
+	shape.resize(count);
+
+	uint8_t *hit_ptr = hit.ptrw();
+	Vector2 *position_ptr = position.ptrw();
+	Vector2 *normal_ptr = normal.ptrw();
+	int64_t *collider_id_ptr = collider_id.ptrw();
+	int32_t *shape_ptr = shape.ptrw();
+	for (int i = 0; i < count; i++) {
+		hit_ptr[i] = hits[i];
+		if (hits[i]) {
+			position_ptr[i] = results[i].position;
+			normal_ptr[i] = results[i].normal;
+			collider_id_ptr[i] = (int64_t)results[i].collider_id;
+			shape_ptr[i] = results[i].shape;
+		} else {
+			position_ptr[i] = Vector2();
+			normal_ptr[i] = Vector2();
+			collider_id_ptr[i] = 0;
+			shape_ptr[i] = -1;
+		}
+	}
+
+	Dictionary d;
+	d["hit"] = hit;
+	d["position"] = position;
+	d["normal"] = normal;
+	d["collider_id"] = collider_id;
+	d["shape"] = shape;
+
+	return d;
+}
+
+void PhysicsDirectSpaceState2D::intersect_rays(const RayParameters &p_parameters, const Vector2 *p_from, const Vector2 *p_to, int p_count, RayResult *r_results, bool *r_hits) {
+	RayParameters parameters = p_parameters;
+	for (int i = 0; i < p_count; i++) {
+		parameters.from = p_from[i];
+		parameters.to = p_to[i];
+		r_hits[i] = intersect_ray(parameters, r_results[i]);
+	}
+}
+
 TypedArray<Dictionary> PhysicsDirectSpaceState2D::_intersect_point(RequiredParam<PhysicsPointQueryParameters2D> rp_point_query, int p_max_results) {
 	EXTRACT_PARAM_OR_FAIL_V(p_point_query, rp_point_query, TypedArray<Dictionary>());
 
@@ -464,6 +527,7 @@ PhysicsDirectSpaceState2D::PhysicsDirectSpaceState2D() {
 void PhysicsDirectSpaceState2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("intersect_point", "parameters", "max_results"), &PhysicsDirectSpaceState2D::_intersect_point, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("intersect_ray", "parameters"), &PhysicsDirectSpaceState2D::_intersect_ray);
+	ClassDB::bind_method(D_METHOD("intersect_rays", "parameters", "from", "to"), &PhysicsDirectSpaceState2D::_intersect_rays);
 	ClassDB::bind_method(D_METHOD("intersect_shape", "parameters", "max_results"), &PhysicsDirectSpaceState2D::_intersect_shape, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("cast_motion", "parameters"), &PhysicsDirectSpaceState2D::_cast_motion);
 	ClassDB::bind_method(D_METHOD("collide_shape", "parameters", "max_results"), &PhysicsDirectSpaceState2D::_collide_shape, DEFVAL(32));
@@ -647,6 +711,8 @@ void PhysicsServer2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("space_set_param", "space", "param", "value"), &PhysicsServer2D::space_set_param);
 	ClassDB::bind_method(D_METHOD("space_get_param", "space", "param"), &PhysicsServer2D::space_get_param);
 	ClassDB::bind_method(D_METHOD("space_get_direct_state", "space"), &PhysicsServer2D::space_get_direct_state);
+	ClassDB::bind_method(D_METHOD("space_save_state", "space"), &PhysicsServer2D::space_save_state);
+	ClassDB::bind_method(D_METHOD("space_restore_state", "space", "state"), &PhysicsServer2D::space_restore_state);
 
 	ClassDB::bind_method(D_METHOD("area_create"), &PhysicsServer2D::area_create);
 	ClassDB::bind_method(D_METHOD("area_set_space", "area", "space"), &PhysicsServer2D::area_set_space);
@@ -684,6 +750,7 @@ void PhysicsServer2D::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("area_set_monitor_callback", "area", "callback"), &PhysicsServer2D::area_set_monitor_callback);
 	ClassDB::bind_method(D_METHOD("area_set_area_monitor_callback", "area", "callback"), &PhysicsServer2D::area_set_area_monitor_callback);
+	ClassDB::bind_method(D_METHOD("area_set_monitor_batch_callback", "area", "callback"), &PhysicsServer2D::area_set_monitor_batch_callback);
 	ClassDB::bind_method(D_METHOD("area_set_monitorable", "area", "monitorable"), &PhysicsServer2D::area_set_monitorable);
 
 	ClassDB::bind_method(D_METHOD("body_create"), &PhysicsServer2D::body_create);
@@ -803,6 +870,7 @@ void PhysicsServer2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_active", "active"), &PhysicsServer2D::set_active);
 
 	ClassDB::bind_method(D_METHOD("get_process_info", "process_info"), &PhysicsServer2D::get_process_info);
+	ClassDB::bind_method(D_METHOD("get_process_info_history", "process_info"), &PhysicsServer2D::get_process_info_history);
 
 	BIND_ENUM_CONSTANT(SPACE_PARAM_CONTACT_RECYCLE_RADIUS);
 	BIND_ENUM_CONSTANT(SPACE_PARAM_CONTACT_MAX_SEPARATION);
@@ -898,6 +966,46 @@ void PhysicsServer2D::_bind_methods() {
 	BIND_ENUM_CONSTANT(INFO_ACTIVE_OBJECTS);
 	BIND_ENUM_CONSTANT(INFO_COLLISION_PAIRS);
 	BIND_ENUM_CONSTANT(INFO_ISLAND_COUNT);
+	BIND_ENUM_CONSTANT(INFO_STEP_TIME);
+	BIND_ENUM_CONSTANT(INFO_BROADPHASE_TIME);
+	BIND_ENUM_CONSTANT(INFO_NARROWPHASE_TIME);
+	BIND_ENUM_CONSTANT(INFO_ISLAND_GENERATION_TIME);
+	BIND_ENUM_CONSTANT(INFO_CONSTRAINT_SETUP_TIME);
+	BIND_ENUM_CONSTANT(INFO_CONSTRAINT_SOLVE_TIME);
+	BIND_ENUM_CONSTANT(INFO_INTEGRATION_TIME);
+	BIND_ENUM_CONSTANT(INFO_AREA_QUERY_TIME);
+	BIND_ENUM_CONSTANT(INFO_CALLBACK_TIME);
+}
+
+void PhysicsServer2D::area_set_monitor_batch_callback(RID p_area, const Callable &p_callback) {
+	ERR_FAIL_MSG("Batched area monitoring is not supported by this physics server.");
+}
+
+PackedInt32Array PhysicsServer2D::get_process_info_history(ProcessInfo p_info) const {
+	ERR_FAIL_INDEX_V(p_info, INFO_MAX, PackedInt32Array());
+
+	MutexLock lock(process_info_history_mutex);
+
+	PackedInt32Array history;
+	history.resize(process_info_history_count);
+	int32_t *w = history.ptrw();
+	int first = (process_info_history_next - process_info_history_count + PROCESS_INFO_HISTORY_SIZE) % PROCESS_INFO_HISTORY_SIZE;
+	for (int i = 0; i < process_info_history_count; i++) {
+		w[i] = process_info_history[(first + i) % PROCESS_INFO_HISTORY_SIZE][p_info];
+	}
+	return history;
+}
+
+void PhysicsServer2D::_record_process_info() {
+	int info[INFO_MAX];
+	for (int i = 0; i < INFO_MAX; i++) {
+		info[i] = get_process_info(ProcessInfo(i));
+	}
+
+	MutexLock lock(process_info_history_mutex);
+	memcpy(process_info_history[process_info_history_next], info, sizeof(info));
+	process_info_history_next = (process_info_history_next + 1) % PROCESS_INFO_HISTORY_SIZE;
+	process_info_history_count = MIN(process_info_history_count + 1, PROCESS_INFO_HISTORY_SIZE);
 }
 
 PhysicsServer2D::PhysicsServer2D() {
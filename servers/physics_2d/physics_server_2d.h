@@ -124,6 +124,7 @@ class PhysicsDirectSpaceState2D : public Object {
 	GDCLASS(PhysicsDirectSpaceState2D, Object);
 
 	Dictionary _intersect_ray(RequiredParam<PhysicsRayQueryParameters2D> rp_ray_query);
+	Dictionary _intersect_rays(RequiredParam<PhysicsRayQueryParameters2D> rp_ray_query, const PackedVector2Array &p_from, const PackedVector2Array &p_to);
 	TypedArray<Dictionary> _intersect_point(RequiredParam<PhysicsPointQueryParameters2D> rp_point_query, int p_max_results = 32);
 	TypedArray<Dictionary> _intersect_shape(RequiredParam<PhysicsShapeQueryParameters2D> rp_shape_query, int p_max_results = 32);
 	Vector<real_t> _cast_motion(RequiredParam<PhysicsShapeQueryParameters2D> rp_shape_query);
@@ -156,6 +157,9 @@ public:
 	};
 
 	virtual bool intersect_ray(const RayParameters &p_parameters, RayResult &r_result) = 0;
+	// Casts `p_count` rays sharing `p_parameters` except for their ends, which are taken from `p_from` and `p_to`.
+	// `r_hits[i]` is set to whether ray `i` hit something, in which case `r_results[i]` holds the closest hit.
+	virtual void intersect_rays(const RayParameters &p_parameters, const Vector2 *p_from, const Vector2 *p_to, int p_count, RayResult *r_results, bool *r_hits);
 
 	struct ShapeResult {
 		RID rid;
@@ -287,6 +291,9 @@ public:
 	virtual Vector<Vector2> space_get_contacts(RID p_space) const = 0;
 	virtual int space_get_contact_count(RID p_space) const = 0;
 
+	virtual PackedByteArray space_save_state(RID p_space) const = 0;
+	virtual bool space_restore_state(RID p_space, const PackedByteArray &p_state) = 0;
+
 	//missing space parameters
 
 	/* AREA API */
@@ -355,6 +362,7 @@ public:
 
 	virtual void area_set_monitor_callback(RID p_area, const Callable &p_callback) = 0;
 	virtual void area_set_area_monitor_callback(RID p_area, const Callable &p_callback) = 0;
+	virtual void area_set_monitor_batch_callback(RID p_area, const Callable &p_callback);
 
 	/* BODY API */
 
@@ -488,6 +496,30 @@ public:
 	virtual void body_set_state_sync_callback(RID p_body, const Callable &p_callable) = 0;
 	virtual void body_set_force_integration_callback(RID p_body, const Callable &p_callable, const Variant &p_udata = Variant()) = 0;
 
+	struct BodyStateSync {
+		ObjectID instance_id;
+		Transform2D transform;
+		Vector2 linear_velocity;
+		real_t angular_velocity = 0.0;
+		bool sleeping = false;
+	};
+
+	typedef void (*BodyStateSyncBatchCallback)(const BodyStateSync *p_states, uint32_t p_count);
+
+private:
+	inline static BodyStateSyncBatchCallback body_state_sync_batch_callback = nullptr;
+
+public:
+	// Bodies with batched state sync don't call their state sync callback when they move. Their state is collected instead,
+	// and passed to the batch callback in a single call per space when flushing queries. This avoids going through a
+	// `Callable` and a direct body state for every body, which is where most of the sync time goes with many bodies.
+	// The batch callback runs once every moved body went through its own queries, so batched bodies are only moved after
+	// all the force integration and state sync callbacks of the space ran, and still see the other batched bodies' old state.
+	virtual void body_set_state_sync_batched(RID p_body, bool p_batched) = 0;
+
+	static void set_body_state_sync_batch_callback(BodyStateSyncBatchCallback p_callback) { body_state_sync_batch_callback = p_callback; }
+	static BodyStateSyncBatchCallback get_body_state_sync_batch_callback() { return body_state_sync_batch_callback; }
+
 	virtual bool body_collide_shape(RID p_body, int p_body_shape, RID p_shape, const Transform2D &p_shape_xform, const Vector2 &p_motion, Vector2 *r_results, int p_result_max, int &r_result_count) = 0;
 
 	virtual void body_set_pickable(RID p_body, bool p_pickable) = 0;
@@ -598,6 +630,10 @@ public:
 		AREA_BODY_REMOVED
 	};
 
+	// Number of values per event passed to the area monitor batch callback. The RID of the other object is passed as its
+	// raw ID, use `RID::from_uint64()` (or `rid_from_int64()` from scripts) to decode it.
+	static constexpr int AREA_MONITOR_EVENT_SIZE = 5;
+
 	/* MISC */
 
 	virtual void free_rid(RID p_rid) = 0;
@@ -620,11 +656,35 @@ public:
 	enum ProcessInfo {
 		INFO_ACTIVE_OBJECTS,
 		INFO_COLLISION_PAIRS,
-		INFO_ISLAND_COUNT
+		INFO_ISLAND_COUNT,
+		INFO_STEP_TIME,
+		INFO_BROADPHASE_TIME,
+		INFO_NARROWPHASE_TIME,
+		INFO_ISLAND_GENERATION_TIME,
+		INFO_CONSTRAINT_SETUP_TIME,
+		INFO_CONSTRAINT_SOLVE_TIME,
+		INFO_INTEGRATION_TIME,
+		INFO_AREA_QUERY_TIME,
+		INFO_CALLBACK_TIME,
+		INFO_MAX,
 	};
 
 	virtual int get_process_info(ProcessInfo p_info) = 0;
+	virtual PackedInt32Array get_process_info_history(ProcessInfo p_info) const;
+
+protected:
+	// Number of physics steps kept by `get_process_info_history()`.
+	static constexpr int PROCESS_INFO_HISTORY_SIZE = 120;
 
+	mutable Mutex process_info_history_mutex;
+	int process_info_history[PROCESS_INFO_HISTORY_SIZE][INFO_MAX] = {};
+	int process_info_history_next = 0;
+	int process_info_history_count = 0;
+
+	// Called by the implementations once per step, after the process info has been updated.
+	void _record_process_info();
+
+public:
 	PhysicsServer2D();
 	~PhysicsServer2D();
 };
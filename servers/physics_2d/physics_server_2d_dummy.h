@@ -164,6 +164,9 @@ public:
 	virtual Vector<Vector2> space_get_contacts(RID p_space) const override { return Vector<Vector2>(); }
 	virtual int space_get_contact_count(RID p_space) const override { return 0; }
 
+	virtual PackedByteArray space_save_state(RID p_space) const override { return PackedByteArray(); }
+	virtual bool space_restore_state(RID p_space, const PackedByteArray &p_state) override { return false; }
+
 	/* AREA API */
 
 	virtual RID area_create() override { return RID(); }
@@ -207,6 +210,7 @@ public:
 
 	virtual void area_set_monitor_callback(RID p_area, const Callable &p_callback) override {}
 	virtual void area_set_area_monitor_callback(RID p_area, const Callable &p_callback) override {}
+	virtual void area_set_monitor_batch_callback(RID p_area, const Callable &p_callback) override {}
 
 	/* BODY API */
 
@@ -293,6 +297,7 @@ public:
 
 	virtual void body_set_state_sync_callback(RID p_body, const Callable &p_callable) override {}
 	virtual void body_set_force_integration_callback(RID p_body, const Callable &p_callable, const Variant &p_udata = Variant()) override {}
+	virtual void body_set_state_sync_batched(RID p_body, bool p_batched) override {}
 
 	virtual bool body_collide_shape(RID p_body, int p_body_shape, RID p_shape, const Transform2D &p_shape_xform, const Vector2 &p_motion, Vector2 *r_results, int p_result_max, int &r_result_count) override { return false; }
 
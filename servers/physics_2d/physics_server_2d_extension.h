@@ -245,6 +245,25 @@ public:
 	EXBIND1RC(Vector<Vector2>, space_get_contacts, RID)
 	EXBIND1RC(int, space_get_contact_count, RID)
 
+	GDVIRTUAL1RC(PackedByteArray, _space_save_state, RID)
+	GDVIRTUAL2R(bool, _space_restore_state, RID, const PackedByteArray &)
+
+	virtual PackedByteArray space_save_state(RID p_space) const override {
+		PackedByteArray ret;
+		if (GDVIRTUAL_CALL(_space_save_state, p_space, ret)) {
+			return ret;
+		}
+		ERR_FAIL_V_MSG(PackedByteArray(), "This physics server doesn't support saving space states.");
+	}
+
+	virtual bool space_restore_state(RID p_space, const PackedByteArray &p_state) override {
+		bool ret = false;
+		if (GDVIRTUAL_CALL(_space_restore_state, p_space, p_state, ret)) {
+			return ret;
+		}
+		ERR_FAIL_V_MSG(false, "This physics server doesn't support restoring space states.");
+	}
+
 	/* AREA API */
 
 	//EXBIND0RID(area);
@@ -384,6 +403,9 @@ public:
 	EXBIND2(body_set_state_sync_callback, RID, const Callable &)
 	EXBIND3(body_set_force_integration_callback, RID, const Callable &, const Variant &)
 
+	// Batched state sync is only available to the built-in servers, extensions keep calling the state sync callback of each body.
+	void body_set_state_sync_batched(RID p_body, bool p_batched) override {}
+
 	virtual bool body_collide_shape(RID p_body, int p_body_shape, RID p_shape, const Transform2D &p_shape_xform, const Vector2 &p_motion, Vector2 *r_results, int p_result_max, int &r_result_count) override {
 		bool ret = false;
 		GDVIRTUAL_CALL(_body_collide_shape, p_body, p_body_shape, p_shape, p_shape_xform, p_motion, r_results, p_result_max, &r_result_count, ret);
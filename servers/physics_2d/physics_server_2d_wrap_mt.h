@@ -128,6 +128,9 @@ public:
 		return physics_server_2d->space_get_contact_count(p_space);
 	}
 
+	FUNC1RC(PackedByteArray, space_save_state, RID);
+	FUNC2R(bool, space_restore_state, RID, const PackedByteArray &);
+
 	/* AREA API */
 
 	//FUNC0RID(area);
@@ -170,6 +173,7 @@ public:
 
 	FUNC2(area_set_monitor_callback, RID, const Callable &);
 	FUNC2(area_set_area_monitor_callback, RID, const Callable &);
+	FUNC2(area_set_monitor_batch_callback, RID, const Callable &);
 
 	/* BODY API */
 
@@ -257,6 +261,7 @@ public:
 
 	FUNC2(body_set_state_sync_callback, RID, const Callable &);
 	FUNC3(body_set_force_integration_callback, RID, const Callable &, const Variant &);
+	FUNC2(body_set_state_sync_batched, RID, bool);
 
 	bool body_collide_shape(RID p_body, int p_body_shape, RID p_shape, const Transform2D &p_shape_xform, const Vector2 &p_motion, Vector2 *r_results, int p_result_max, int &r_result_count) override {
 		return physics_server_2d->body_collide_shape(p_body, p_body_shape, p_shape, p_shape_xform, p_motion, r_results, p_result_max, r_result_count);
@@ -328,6 +333,10 @@ public:
 		return physics_server_2d->get_process_info(p_info);
 	}
 
+	PackedInt32Array get_process_info_history(ProcessInfo p_info) const override {
+		return physics_server_2d->get_process_info_history(p_info);
+	}
+
 	PhysicsServer2DWrapMT(PhysicsServer2D *p_contained, bool p_create_thread);
 	~PhysicsServer2DWrapMT();
 
@@ -199,6 +199,46 @@ TypedArray<RID> PhysicsRayQueryParameters3D::get_exclude() const {
 	return ret;
 }
 
+///////////////////////////////////////////////////////
+
+void PhysicsCommandBuffer3D::_record(PhysicsServer3D::CommandType p_type, RID p_rid, int p_key, const Variant &p_value) {
+	commands.resize(commands.size() + 1);
+
+	PhysicsServer3D::Command &command = commands[commands.size() - 1];
+	command.type = p_type;
+	command.rid = p_rid;
+	command.key = p_key;
+	command.value = p_value;
+}
+
+void PhysicsCommandBuffer3D::body_set_state(RID p_body, PhysicsServer3D::BodyState p_state, const Variant &p_value) {
+	_record(PhysicsServer3D::COMMAND_BODY_SET_STATE, p_body, p_state, p_value);
+}
+
+void PhysicsCommandBuffer3D::body_set_param(RID p_body, PhysicsServer3D::BodyParameter p_param, const Variant &p_value) {
+	_record(PhysicsServer3D::COMMAND_BODY_SET_PARAM, p_body, p_param, p_value);
+}
+
+void PhysicsCommandBuffer3D::area_set_param(RID p_area, PhysicsServer3D::AreaParameter p_param, const Variant &p_value) {
+	_record(PhysicsServer3D::COMMAND_AREA_SET_PARAM, p_area, p_param, p_value);
+}
+
+void PhysicsCommandBuffer3D::area_set_transform(RID p_area, const Transform3D &p_transform) {
+	_record(PhysicsServer3D::COMMAND_AREA_SET_TRANSFORM, p_area, 0, p_transform);
+}
+
+void PhysicsCommandBuffer3D::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("body_set_state", "body", "state", "value"), &PhysicsCommandBuffer3D::body_set_state);
+	ClassDB::bind_method(D_METHOD("body_set_param", "body", "param", "value"), &PhysicsCommandBuffer3D::body_set_param);
+	ClassDB::bind_method(D_METHOD("area_set_param", "area", "param", "value"), &PhysicsCommandBuffer3D::area_set_param);
+	ClassDB::bind_method(D_METHOD("area_set_transform", "area", "transform"), &PhysicsCommandBuffer3D::area_set_transform);
+
+	ClassDB::bind_method(D_METHOD("get_command_count"), &PhysicsCommandBuffer3D::get_command_count);
+	ClassDB::bind_method(D_METHOD("clear"), &PhysicsCommandBuffer3D::clear);
+}
+
+///////////////////////////////////////////////////////
+
 void PhysicsRayQueryParameters3D::_bind_methods() {
 	ClassDB::bind_static_method("PhysicsRayQueryParameters3D", D_METHOD("create", "from", "to", "collision_mask", "exclude"), &PhysicsRayQueryParameters3D::create, DEFVAL(UINT32_MAX), DEFVAL(TypedArray<RID>()));
 
@@ -383,6 +423,75 @@ Dictionary PhysicsDirectSpaceState3D::_intersect_ray(RequiredParam<PhysicsRayQue
 	return d;
 }
 
+Dictionary PhysicsDirectSpaceState3D::_intersect_rays(RequiredParam<PhysicsRayQueryParameters3D> rp_ray_query, const PackedVector3Array &p_from, const PackedVector3Array &p_to) {
+	EXTRACT_PARAM_OR_FAIL_V(p_ray_query, rp_ray_query, Dictionary());
+	ERR_FAIL_COND_V_MSG(p_from.size() != p_to.size(), Dictionary(), "The arrays of ray origins and ends must have the same size.");
+
+	const int count = p_from.size();
+
+	LocalVector<RayResult> results;
+	results.resize(count);
+	LocalVector<bool> hits;
+	hits.resize(count);
+
+	intersect_rays(p_ray_query->get_parameters(), p_from.ptr(), p_to.ptr(), count, results.ptr(), hits.ptr());
+
+	PackedByteArray hit;
+	hit.resize(count);
+	PackedVector3Array position;
+	position.resize(count);
+	PackedVector3Array normal;
+	normal.resize(count);
+	PackedInt64Array collider_id;
+	collider_id.resize(count);
+	PackedInt32Array shape;
+	shape.resize(count);
+	PackedInt32Array face_index;
+	face_index.resize(count);
+
+	uint8_t *hit_ptr = hit.ptrw();
+	Vector3 *position_ptr = position.ptrw();
+	Vector3 *normal_ptr = normal.ptrw();
+	int64_t *collider_id_ptr = collider_id.ptrw();
+	int32_t *shape_ptr = shape.ptrw();
+	int32_t *face_index_ptr = face_index.ptrw();
+	for (int i = 0; i < count; i++) {
+		hit_ptr[i] = hits[i];
+		if (hits[i]) {
+			position_ptr[i] = results[i].position;
+			normal_ptr[i] = results[i].normal;
+			collider_id_ptr[i] = (int64_t)results[i].collider_id;
+			shape_ptr[i] = results[i].shape;
+			face_index_ptr[i] = results[i].face_index;
+		} else {
+			position_ptr[i] = Vector3();
+			normal_ptr[i] = Vector3();
+			collider_id_ptr[i] = 0;
+			shape_ptr[i] = -1;
+			face_index_ptr[i] = -1;
+		}
+	}
+
+	Dictionary d;
+	d["hit"] = hit;
+	d["position"] = position;
+	d["normal"] = normal;
+	d["collider_id"] = collider_id;
+	d["shape"] = shape;
+	d["face_index"] = face_index;
+
+	return d;
+}
+
+void PhysicsDirectSpaceState3D::intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_hits) {
+	RayParameters parameters = p_parameters;
+	for (int i = 0; i < p_count; i++) {
+		parameters.from = p_from[i];
+		parameters.to = p_to[i];
+		r_hits[i] = intersect_ray(parameters, r_results[i]);
+	}
+}
+
 TypedArray<Dictionary> PhysicsDirectSpaceState3D::_intersect_point(RequiredParam<PhysicsPointQueryParameters3D> rp_point_query, int p_max_results) {
 	EXTRACT_PARAM_OR_FAIL_V(p_point_query, rp_point_query, TypedArray<Dictionary>());
 
@@ -488,6 +597,7 @@ PhysicsDirectSpaceState3D::PhysicsDirectSpaceState3D() {
 void PhysicsDirectSpaceState3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("intersect_point", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_intersect_point, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("intersect_ray", "parameters"), &PhysicsDirectSpaceState3D::_intersect_ray);
+	ClassDB::bind_method(D_METHOD("intersect_rays", "parameters", "from", "to"), &PhysicsDirectSpaceState3D::_intersect_rays);
 	ClassDB::bind_method(D_METHOD("intersect_shape", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_intersect_shape, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("cast_motion", "parameters"), &PhysicsDirectSpaceState3D::_cast_motion);
 	ClassDB::bind_method(D_METHOD("collide_shape", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_collide_shape, DEFVAL(32));
@@ -722,6 +832,8 @@ void PhysicsServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("space_set_param", "space", "param", "value"), &PhysicsServer3D::space_set_param);
 	ClassDB::bind_method(D_METHOD("space_get_param", "space", "param"), &PhysicsServer3D::space_get_param);
 	ClassDB::bind_method(D_METHOD("space_get_direct_state", "space"), &PhysicsServer3D::space_get_direct_state);
+	ClassDB::bind_method(D_METHOD("space_save_state", "space"), &PhysicsServer3D::space_save_state);
+	ClassDB::bind_method(D_METHOD("space_restore_state", "space", "state"), &PhysicsServer3D::space_restore_state);
 
 	ClassDB::bind_method(D_METHOD("area_create"), &PhysicsServer3D::area_create);
 	ClassDB::bind_method(D_METHOD("area_set_space", "area", "space"), &PhysicsServer3D::area_set_space);
@@ -1049,6 +1161,9 @@ void PhysicsServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_active", "active"), &PhysicsServer3D::set_active);
 
 	ClassDB::bind_method(D_METHOD("get_process_info", "process_info"), &PhysicsServer3D::get_process_info);
+	ClassDB::bind_method(D_METHOD("get_process_info_history", "process_info"), &PhysicsServer3D::get_process_info_history);
+
+	ClassDB::bind_method(D_METHOD("submit_command_buffer", "command_buffer"), &PhysicsServer3D::_submit_command_buffer);
 
 	BIND_ENUM_CONSTANT(SHAPE_WORLD_BOUNDARY);
 	BIND_ENUM_CONSTANT(SHAPE_SEPARATION_RAY);
@@ -1115,6 +1230,16 @@ void PhysicsServer3D::_bind_methods() {
 	BIND_ENUM_CONSTANT(INFO_ACTIVE_OBJECTS);
 	BIND_ENUM_CONSTANT(INFO_COLLISION_PAIRS);
 	BIND_ENUM_CONSTANT(INFO_ISLAND_COUNT);
+	BIND_ENUM_CONSTANT(INFO_STEP_TIME);
+	BIND_ENUM_CONSTANT(INFO_BROADPHASE_TIME);
+	BIND_ENUM_CONSTANT(INFO_NARROWPHASE_TIME);
+	BIND_ENUM_CONSTANT(INFO_ISLAND_GENERATION_TIME);
+	BIND_ENUM_CONSTANT(INFO_CONSTRAINT_SETUP_TIME);
+	BIND_ENUM_CONSTANT(INFO_CONSTRAINT_SOLVE_TIME);
+	BIND_ENUM_CONSTANT(INFO_INTEGRATION_TIME);
+	BIND_ENUM_CONSTANT(INFO_AREA_QUERY_TIME);
+	BIND_ENUM_CONSTANT(INFO_CALLBACK_TIME);
+	BIND_ENUM_CONSTANT(INFO_JOB_COUNT);
 
 	BIND_ENUM_CONSTANT(SPACE_PARAM_CONTACT_RECYCLE_RADIUS);
 	BIND_ENUM_CONSTANT(SPACE_PARAM_CONTACT_MAX_SEPARATION);
@@ -1135,6 +1260,62 @@ void PhysicsServer3D::_bind_methods() {
 #endif
 }
 
+void PhysicsServer3D::submit_commands(LocalVector<Command> &&p_commands) {
+	for (const Command &command : p_commands) {
+		switch (command.type) {
+			case COMMAND_BODY_SET_STATE: {
+				body_set_state(command.rid, BodyState(command.key), command.value);
+			} break;
+			case COMMAND_BODY_SET_PARAM: {
+				body_set_param(command.rid, BodyParameter(command.key), command.value);
+			} break;
+			case COMMAND_AREA_SET_PARAM: {
+				area_set_param(command.rid, AreaParameter(command.key), command.value);
+			} break;
+			case COMMAND_AREA_SET_TRANSFORM: {
+				area_set_transform(command.rid, command.value);
+			} break;
+		}
+	}
+}
+
+void PhysicsServer3D::_submit_command_buffer(RequiredParam<PhysicsCommandBuffer3D> rp_command_buffer) {
+	EXTRACT_PARAM_OR_FAIL(p_command_buffer, rp_command_buffer);
+
+	if (p_command_buffer->get_command_count() == 0) {
+		return;
+	}
+
+	submit_commands(p_command_buffer->take_commands());
+}
+
+PackedInt32Array PhysicsServer3D::get_process_info_history(ProcessInfo p_info) const {
+	ERR_FAIL_INDEX_V(p_info, INFO_MAX, PackedInt32Array());
+
+	MutexLock lock(process_info_history_mutex);
+
+	PackedInt32Array history;
+	history.resize(process_info_history_count);
+	int32_t *w = history.ptrw();
+	int first = (process_info_history_next - process_info_history_count + PROCESS_INFO_HISTORY_SIZE) % PROCESS_INFO_HISTORY_SIZE;
+	for (int i = 0; i < process_info_history_count; i++) {
+		w[i] = process_info_history[(first + i) % PROCESS_INFO_HISTORY_SIZE][p_info];
+	}
+	return history;
+}
+
+void PhysicsServer3D::_record_process_info() {
+	int info[INFO_MAX];
+	for (int i = 0; i < INFO_MAX; i++) {
+		info[i] = get_process_info(ProcessInfo(i));
+	}
+
+	MutexLock lock(process_info_history_mutex);
+	memcpy(process_info_history[process_info_history_next], info, sizeof(info));
+	process_info_history_next = (process_info_history_next + 1) % PROCESS_INFO_HISTORY_SIZE;
+	process_info_history_count = MIN(process_info_history_count + 1, PROCESS_INFO_HISTORY_SIZE);
+}
+
 PhysicsServer3D::PhysicsServer3D() {
 	singleton = this;
 
@@ -1149,6 +1330,7 @@ PhysicsServer3D::PhysicsServer3D() {
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/sleep_threshold_angular", PROPERTY_HINT_RANGE, "0,90,0.1,radians_as_degrees"), Math::deg_to_rad(8.0));
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/time_before_sleep", PROPERTY_HINT_RANGE, "0,5,0.01,or_greater"), 0.5);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "physics/3d/solver/solver_iterations", PROPERTY_HINT_RANGE, "1,32,1,or_greater"), 16);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "physics/3d/solver/large_island_constraint_count", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), 512);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_recycle_radius", PROPERTY_HINT_RANGE, "0,0.1,0.001,or_greater"), 0.01);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_max_separation", PROPERTY_HINT_RANGE, "0,0.1,0.001,or_greater"), 0.05);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_max_allowed_penetration", PROPERTY_HINT_RANGE, "0.001,0.1,0.001,or_greater"), 0.01);
@@ -32,6 +32,7 @@
 
 #include "core/io/resource.h"
 #include "core/object/gdvirtual.gen.h"
+#include "core/templates/local_vector.h"
 
 constexpr int MAX_CONTACTS_REPORTED_3D_MAX = 4096;
 
@@ -118,6 +119,7 @@ public:
 	PhysicsDirectBodyState3D();
 };
 
+class PhysicsCommandBuffer3D;
 class PhysicsRayQueryParameters3D;
 class PhysicsPointQueryParameters3D;
 class PhysicsShapeQueryParameters3D;
@@ -127,6 +129,7 @@ class PhysicsDirectSpaceState3D : public Object {
 
 private:
 	Dictionary _intersect_ray(RequiredParam<PhysicsRayQueryParameters3D> rp_ray_query);
+	Dictionary _intersect_rays(RequiredParam<PhysicsRayQueryParameters3D> rp_ray_query, const PackedVector3Array &p_from, const PackedVector3Array &p_to);
 	TypedArray<Dictionary> _intersect_point(RequiredParam<PhysicsPointQueryParameters3D> rp_point_query, int p_max_results = 32);
 	TypedArray<Dictionary> _intersect_shape(RequiredParam<PhysicsShapeQueryParameters3D> rp_shape_query, int p_max_results = 32);
 	Vector<real_t> _cast_motion(RequiredParam<PhysicsShapeQueryParameters3D> rp_shape_query);
@@ -163,6 +166,9 @@ public:
 	};
 
 	virtual bool intersect_ray(const RayParameters &p_parameters, RayResult &r_result) = 0;
+	// Casts `p_count` rays sharing `p_parameters` except for their ends, which are taken from `p_from` and `p_to`.
+	// `r_hits[i]` is set to whether ray `i` hit something, in which case `r_results[i]` holds the closest hit.
+	virtual void intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_hits);
 
 	struct ShapeResult {
 		RID rid;
@@ -311,6 +317,9 @@ public:
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const = 0;
 	virtual int space_get_contact_count(RID p_space) const = 0;
 
+	virtual PackedByteArray space_save_state(RID p_space) const = 0;
+	virtual bool space_restore_state(RID p_space, const PackedByteArray &p_state) = 0;
+
 	//missing space parameters
 
 	/* AREA API */
@@ -519,6 +528,31 @@ public:
 	virtual void body_set_state_sync_callback(RID p_body, const Callable &p_callable) = 0;
 	virtual void body_set_force_integration_callback(RID p_body, const Callable &p_callable, const Variant &p_udata = Variant()) = 0;
 
+	struct BodyStateSync {
+		ObjectID instance_id;
+		Transform3D transform;
+		Vector3 linear_velocity;
+		Vector3 angular_velocity;
+		Basis inverse_inertia_tensor;
+		bool sleeping = false;
+	};
+
+	typedef void (*BodyStateSyncBatchCallback)(const BodyStateSync *p_states, uint32_t p_count);
+
+private:
+	inline static BodyStateSyncBatchCallback body_state_sync_batch_callback = nullptr;
+
+public:
+	// Bodies with batched state sync don't call their state sync callback when they move. Their state is collected instead,
+	// and passed to the batch callback in a single call per space when flushing queries. This avoids going through a
+	// `Callable` and a direct body state for every body, which is where most of the sync time goes with many bodies.
+	// The batch callback runs once every moved body went through its own queries, so batched bodies are only moved after
+	// all the force integration and state sync callbacks of the space ran, and still see the other batched bodies' old state.
+	virtual void body_set_state_sync_batched(RID p_body, bool p_batched) = 0;
+
+	static void set_body_state_sync_batch_callback(BodyStateSyncBatchCallback p_callback) { body_state_sync_batch_callback = p_callback; }
+	static BodyStateSyncBatchCallback get_body_state_sync_batch_callback() { return body_state_sync_batch_callback; }
+
 	virtual void body_set_ray_pickable(RID p_body, bool p_enable) = 0;
 
 	// this function only works on physics process, errors and returns null otherwise
@@ -820,18 +854,89 @@ public:
 
 	virtual bool is_flushing_queries() const = 0;
 
+	/* COMMAND BUFFER API */
+
+	enum CommandType {
+		COMMAND_BODY_SET_STATE,
+		COMMAND_BODY_SET_PARAM,
+		COMMAND_AREA_SET_PARAM,
+		COMMAND_AREA_SET_TRANSFORM,
+	};
+
+	struct Command {
+		CommandType type = COMMAND_BODY_SET_STATE;
+		int key = 0; // The `BodyState`, `BodyParameter` or `AreaParameter` to set.
+		RID rid;
+		Variant value;
+	};
+
+	// Runs the commands in order. Servers that queue their calls can take over the whole list instead of queuing each command.
+	virtual void submit_commands(LocalVector<Command> &&p_commands);
+
+private:
+	void _submit_command_buffer(RequiredParam<PhysicsCommandBuffer3D> rp_command_buffer);
+
+public:
 	enum ProcessInfo {
 		INFO_ACTIVE_OBJECTS,
 		INFO_COLLISION_PAIRS,
-		INFO_ISLAND_COUNT
+		INFO_ISLAND_COUNT,
+		INFO_STEP_TIME,
+		INFO_BROADPHASE_TIME,
+		INFO_NARROWPHASE_TIME,
+		INFO_ISLAND_GENERATION_TIME,
+		INFO_CONSTRAINT_SETUP_TIME,
+		INFO_CONSTRAINT_SOLVE_TIME,
+		INFO_INTEGRATION_TIME,
+		INFO_AREA_QUERY_TIME,
+		INFO_CALLBACK_TIME,
+		INFO_JOB_COUNT,
+		INFO_MAX,
 	};
 
 	virtual int get_process_info(ProcessInfo p_info) = 0;
+	virtual PackedInt32Array get_process_info_history(ProcessInfo p_info) const;
+
+protected:
+	// Number of physics steps kept by `get_process_info_history()`.
+	static constexpr int PROCESS_INFO_HISTORY_SIZE = 120;
+
+	mutable Mutex process_info_history_mutex;
+	int process_info_history[PROCESS_INFO_HISTORY_SIZE][INFO_MAX] = {};
+	int process_info_history_next = 0;
+	int process_info_history_count = 0;
 
+	// Called by the implementations once per step, after the process info has been updated.
+	void _record_process_info();
+
+public:
 	PhysicsServer3D();
 	~PhysicsServer3D();
 };
 
+class PhysicsCommandBuffer3D : public RefCounted {
+	GDCLASS(PhysicsCommandBuffer3D, RefCounted);
+
+	LocalVector<PhysicsServer3D::Command> commands;
+
+	void _record(PhysicsServer3D::CommandType p_type, RID p_rid, int p_key, const Variant &p_value);
+
+protected:
+	static void _bind_methods();
+
+public:
+	void body_set_state(RID p_body, PhysicsServer3D::BodyState p_state, const Variant &p_value);
+	void body_set_param(RID p_body, PhysicsServer3D::BodyParameter p_param, const Variant &p_value);
+	void area_set_param(RID p_area, PhysicsServer3D::AreaParameter p_param, const Variant &p_value);
+	void area_set_transform(RID p_area, const Transform3D &p_transform);
+
+	int get_command_count() const { return commands.size(); }
+	void clear() { commands.clear(); }
+
+	// Leaves the buffer empty.
+	LocalVector<PhysicsServer3D::Command> take_commands() { return std::move(commands); }
+};
+
 class PhysicsRayQueryParameters3D : public RefCounted {
 	GDCLASS(PhysicsRayQueryParameters3D, RefCounted);
 
@@ -172,6 +172,9 @@ public:
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const override { return Vector<Vector3>(); }
 	virtual int space_get_contact_count(RID p_space) const override { return 0; }
 
+	virtual PackedByteArray space_save_state(RID p_space) const override { return PackedByteArray(); }
+	virtual bool space_restore_state(RID p_space, const PackedByteArray &p_state) override { return false; }
+
 	/* AREA API */
 
 	virtual RID area_create() override { return RID(); }
@@ -301,6 +304,7 @@ public:
 
 	virtual void body_set_state_sync_callback(RID p_body, const Callable &p_callable) override {}
 	virtual void body_set_force_integration_callback(RID p_body, const Callable &p_callable, const Variant &p_udata = Variant()) override {}
+	virtual void body_set_state_sync_batched(RID p_body, bool p_batched) override {}
 
 	virtual void body_set_ray_pickable(RID p_body, bool p_enable) override {}
 
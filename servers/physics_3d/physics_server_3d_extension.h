@@ -247,6 +247,25 @@ public:
 	EXBIND1RC(Vector<Vector3>, space_get_contacts, RID)
 	EXBIND1RC(int, space_get_contact_count, RID)
 
+	GDVIRTUAL1RC(PackedByteArray, _space_save_state, RID)
+	GDVIRTUAL2R(bool, _space_restore_state, RID, const PackedByteArray &)
+
+	virtual PackedByteArray space_save_state(RID p_space) const override {
+		PackedByteArray ret;
+		if (GDVIRTUAL_CALL(_space_save_state, p_space, ret)) {
+			return ret;
+		}
+		ERR_FAIL_V_MSG(PackedByteArray(), "This physics server doesn't support saving space states.");
+	}
+
+	virtual bool space_restore_state(RID p_space, const PackedByteArray &p_state) override {
+		bool ret = false;
+		if (GDVIRTUAL_CALL(_space_restore_state, p_space, p_state, ret)) {
+			return ret;
+		}
+		ERR_FAIL_V_MSG(false, "This physics server doesn't support restoring space states.");
+	}
+
 	/* AREA API */
 
 	//EXBIND0RID(area);
@@ -385,6 +404,9 @@ public:
 	EXBIND2(body_set_state_sync_callback, RID, const Callable &)
 	EXBIND3(body_set_force_integration_callback, RID, const Callable &, const Variant &)
 
+	// Batched state sync is only available to the built-in servers, extensions keep calling the state sync callback of each body.
+	void body_set_state_sync_batched(RID p_body, bool p_batched) override {}
+
 	EXBIND2(body_set_ray_pickable, RID, bool)
 
 	GDVIRTUAL8RC_REQUIRED(bool, _body_test_motion, RID, const Transform3D &, const Vector3 &, real_t, int, bool, bool, GDExtensionPtr<PhysicsServer3DExtensionMotionResult>)
@@ -55,8 +55,41 @@ void PhysicsServer3DWrapMT::_thread_sync() {
 	doing_sync.set();
 }
 
+void PhysicsServer3DWrapMT::_thread_submit_commands(LocalVector<Command> *p_commands) {
+	{
+		MutexLock lock(pending_commands_mutex);
+		pending_commands.erase(p_commands);
+	}
+
+	physics_server_3d->submit_commands(std::move(*p_commands));
+	memdelete(p_commands);
+}
+
+void PhysicsServer3DWrapMT::_free_pending_commands() {
+	MutexLock lock(pending_commands_mutex);
+	for (LocalVector<Command> *commands : pending_commands) {
+		memdelete(commands);
+	}
+	pending_commands.clear();
+}
+
 /* EVENT QUEUING */
 
+void PhysicsServer3DWrapMT::submit_commands(LocalVector<Command> &&p_commands) {
+	if (ASYNC_COND_PUSH) {
+		// Queue the whole list as a single command, instead of one command for each change.
+		LocalVector<Command> *commands = memnew(LocalVector<Command>(std::move(p_commands)));
+		{
+			MutexLock lock(pending_commands_mutex);
+			pending_commands.insert(commands);
+		}
+		command_queue.push(this, &PhysicsServer3DWrapMT::_thread_submit_commands, commands);
+	} else {
+		command_queue.flush_if_pending();
+		physics_server_3d->submit_commands(std::move(p_commands));
+	}
+}
+
 void PhysicsServer3DWrapMT::step(real_t p_step) {
 	if (create_thread) {
 		command_queue.push(physics_server_3d, &PhysicsServer3D::step, p_step);
@@ -111,6 +144,9 @@ void PhysicsServer3DWrapMT::finish() {
 	} else {
 		physics_server_3d->finish();
 	}
+
+	// Whatever is still queued won't run anymore.
+	_free_pending_commands();
 }
 
 PhysicsServer3DWrapMT::PhysicsServer3DWrapMT(PhysicsServer3D *p_contained, bool p_create_thread) {
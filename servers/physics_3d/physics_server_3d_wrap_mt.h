@@ -33,6 +33,7 @@
 #include "core/object/worker_thread_pool.h"
 #include "core/os/thread.h"
 #include "core/templates/command_queue_mt.h"
+#include "core/templates/hash_set.h"
 #include "servers/physics_3d/physics_server_3d.h"
 
 #define ASYNC_COND_PUSH (Thread::get_caller_id() != server_thread && !(doing_sync.is_set() && Thread::is_main_thread()))
@@ -73,11 +74,17 @@ class PhysicsServer3DWrapMT : public PhysicsServer3D {
 	bool create_thread = false;
 	SafeFlag doing_sync;
 
+	// Command lists pushed to the queue that didn't run yet, freed on `finish()` if the queue is never flushed again.
+	Mutex pending_commands_mutex;
+	HashSet<LocalVector<Command> *> pending_commands;
+
 	void _assign_mt_ids(WorkerThreadPool::TaskID p_pump_task_id);
 	void _thread_exit();
 	void _thread_step(real_t p_delta);
 	void _thread_loop();
 	void _thread_sync();
+	void _thread_submit_commands(LocalVector<Command> *p_commands);
+	void _free_pending_commands();
 
 public:
 	//FUNC1RID(shape,ShapeType); todo fix
@@ -101,6 +108,8 @@ public:
 	FUNC1RC(ShapeType, shape_get_type, RID);
 	FUNC1RC(Variant, shape_get_data, RID);
 	FUNC1RC(real_t, shape_get_custom_solver_bias, RID);
+
+	virtual void submit_commands(LocalVector<Command> &&p_commands) override;
 #if 0
 	//these work well, but should be used from the main thread only
 	bool shape_collide(RID p_shape_A, const Transform &p_xform_A, const Vector3 &p_motion_A, RID p_shape_B, const Transform &p_xform_B, const Vector3 &p_motion_B, Vector3 *r_results, int p_result_max, int &r_result_count) {
@@ -134,6 +143,9 @@ public:
 		return physics_server_3d->space_get_contact_count(p_space);
 	}
 
+	FUNC1RC(PackedByteArray, space_save_state, RID);
+	FUNC2R(bool, space_restore_state, RID, const PackedByteArray &);
+
 	/* AREA API */
 
 	//FUNC0RID(area);
@@ -267,6 +279,7 @@ public:
 
 	FUNC2(body_set_state_sync_callback, RID, const Callable &);
 	FUNC3(body_set_force_integration_callback, RID, const Callable &, const Variant &);
+	FUNC2(body_set_state_sync_batched, RID, bool);
 
 	FUNC2(body_set_ray_pickable, RID, bool);
 
@@ -411,6 +424,10 @@ public:
 		return physics_server_3d->get_process_info(p_info);
 	}
 
+	PackedInt32Array get_process_info_history(ProcessInfo p_info) const override {
+		return physics_server_3d->get_process_info_history(p_info);
+	}
+
 	PhysicsServer3DWrapMT(PhysicsServer3D *p_contained, bool p_create_thread);
 	~PhysicsServer3DWrapMT();
 };
@@ -0,0 +1,136 @@
+/**************************************************************************/
+/*  test_bvh.cpp                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_bvh)
+
+#include "core/math/bvh.h"
+
+namespace TestBVH {
+
+struct TestItem {
+	int id = 0;
+};
+
+template <typename T>
+class TestPairFunction {
+public:
+	static bool user_pair_check(const T *p_a, const T *p_b) {
+		return true;
+	}
+};
+
+template <typename T>
+class TestCullFunction {
+public:
+	static bool user_cull_check(const T *p_a, const T *p_b) {
+		return true;
+	}
+};
+
+typedef BVH_Manager<TestItem, 2, true, 32, TestPairFunction<TestItem>, TestCullFunction<TestItem>> TestBVHManager;
+
+struct PairLog {
+	LocalVector<Vector3i> events; // x: 1 for pair, 0 for unpair; y, z: item IDs.
+
+	static void *pair(void *p_self, uint32_t p_a, TestItem *p_item_a, int p_subindex_a, uint32_t p_b, TestItem *p_item_b, int p_subindex_b) {
+		static_cast<PairLog *>(p_self)->events.push_back(Vector3i(1, p_item_a->id, p_item_b->id));
+		return p_item_a;
+	}
+
+	static void unpair(void *p_self, uint32_t p_a, TestItem *p_item_a, int p_subindex_a, uint32_t p_b, TestItem *p_item_b, int p_subindex_b, void *p_pair_data) {
+		static_cast<PairLog *>(p_self)->events.push_back(Vector3i(0, p_item_a->id, p_item_b->id));
+	}
+};
+
+static AABB item_aabb(int p_index, real_t p_offset) {
+	// Items on a grid, each overlapping its neighbors.
+	return AABB(Vector3((p_index % 16) * 0.9 + p_offset, (p_index / 16) * 0.9, 0), Vector3(1, 1, 1));
+}
+
+static bool same_events(const PairLog &p_a, const PairLog &p_b) {
+	if (p_a.events.size() != p_b.events.size()) {
+		return false;
+	}
+	for (uint32_t i = 0; i < p_a.events.size(); i++) {
+		if (p_a.events[i] != p_b.events[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+TEST_CASE("[BVH] Parallel pair checks send the same callbacks as serial ones") {
+	const int item_count = 256;
+	TestItem items[item_count];
+	for (int i = 0; i < item_count; i++) {
+		items[i].id = i;
+	}
+
+	PairLog logs[2];
+	TestBVHManager bvhs[2];
+	LocalVector<BVHHandle> handles[2];
+
+	for (int b = 0; b < 2; b++) {
+		bvhs[b].set_pair_callback(PairLog::pair, &logs[b]);
+		bvhs[b].set_unpair_callback(PairLog::unpair, &logs[b]);
+		bvhs[b].params_set_parallel_pair_checks(b == 1);
+		for (int i = 0; i < item_count; i++) {
+			handles[b].push_back(bvhs[b].create(&items[i], true, 1, 3, item_aabb(i, 0.0)));
+		}
+		bvhs[b].update();
+	}
+
+	CHECK_MESSAGE(logs[0].events.size() > 0, "Overlapping items should be paired.");
+	CHECK(same_events(logs[0], logs[1]));
+
+	// Move every other row far enough to change the pairs.
+	for (int b = 0; b < 2; b++) {
+		logs[b].events.clear();
+		for (int i = 0; i < item_count; i++) {
+			if ((i / 16) % 2) {
+				bvhs[b].move(handles[b][i], item_aabb(i, 20.0));
+			}
+		}
+		bvhs[b].update();
+	}
+
+	CHECK_MESSAGE(logs[0].events.size() > 0, "Moved items should be unpaired.");
+	CHECK(same_events(logs[0], logs[1]));
+
+	for (int b = 0; b < 2; b++) {
+		for (const BVHHandle &h : handles[b]) {
+			bvhs[b].erase(h);
+		}
+	}
+}
+
+} // namespace TestBVH
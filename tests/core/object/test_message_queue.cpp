@@ -0,0 +1,110 @@
+/**************************************************************************/
+/*  test_message_queue.cpp                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_message_queue)
+
+#include "core/object/callable_mp.h"
+#include "core/object/message_queue.h"
+#include "core/os/thread.h"
+
+namespace TestMessageQueue {
+
+static LocalVector<int> call_order;
+static SafeNumeric<uint32_t> call_count;
+
+static void record_call(int p_value) {
+	call_order.push_back(p_value);
+}
+
+static void count_call(int p_value) {
+	call_count.add(p_value);
+}
+
+TEST_CASE("[MessageQueue] Calls are flushed in order") {
+	CallQueue queue;
+	call_order.clear();
+
+	for (int i = 0; i < 1000; i++) {
+		queue.push_callable(callable_mp_static(&record_call), i);
+	}
+	CHECK(queue.has_messages());
+	CHECK(queue.get_message_count() == 1000);
+	CHECK(queue.get_buffer_usage() > 0);
+
+	CHECK(queue.flush() == OK);
+	CHECK_FALSE(queue.has_messages());
+	CHECK(queue.get_message_count() == 0);
+	CHECK(queue.get_buffer_usage() == 0);
+
+	REQUIRE(call_order.size() == 1000);
+	bool in_order = true;
+	for (int i = 0; i < 1000; i++) {
+		in_order = in_order && call_order[i] == i;
+	}
+	CHECK(in_order);
+}
+
+#ifdef THREADS_ENABLED
+static SafeNumeric<uint32_t> threads_done;
+
+static void push_calls(void *p_queue) {
+	CallQueue *queue = (CallQueue *)p_queue;
+	for (int i = 0; i < 2000; i++) {
+		queue->push_callable(callable_mp_static(&count_call), 1);
+	}
+	threads_done.increment();
+}
+
+TEST_CASE("[MessageQueue] Calls pushed from several threads while flushing") {
+	CallQueue queue;
+	call_count.set(0);
+	threads_done.set(0);
+
+	Thread threads[4];
+	for (Thread &thread : threads) {
+		thread.start(&push_calls, &queue);
+	}
+	// Flush concurrently with the threads pushing.
+	while (threads_done.get() < 4) {
+		queue.flush();
+	}
+	for (Thread &thread : threads) {
+		thread.wait_to_finish();
+	}
+	queue.flush();
+
+	CHECK(call_count.get() == 4 * 2000);
+	CHECK(queue.get_message_count() == 0);
+}
+#endif // THREADS_ENABLED
+
+} // namespace TestMessageQueue
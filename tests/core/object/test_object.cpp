@@ -326,6 +326,29 @@ public:
 	void callback3(Variant p_arg1, Variant p_arg2, Variant p_arg3) {
 		received_args = Vector<Variant>{ p_arg1, p_arg2, p_arg3 };
 	}
+
+	int call_count = 0;
+
+	void counted_callback() {
+		call_count++;
+	}
+};
+
+class SignalConnectionChanger : public Object {
+	GDCLASS(SignalConnectionChanger, Object);
+
+public:
+	Object *source = nullptr;
+	SignalReceiver *to_disconnect = nullptr;
+	SignalReceiver *to_connect = nullptr;
+
+	void callback() {
+		if (to_disconnect) {
+			source->disconnect("my_custom_signal", callable_mp(to_disconnect, &SignalReceiver::counted_callback));
+			source->connect("my_custom_signal", callable_mp(to_connect, &SignalReceiver::counted_callback));
+			to_disconnect = nullptr;
+		}
+	}
 };
 
 TEST_CASE("[Object] Signals") {
@@ -468,6 +491,30 @@ TEST_CASE("[Object] Signals") {
 		CHECK(signal_connections.size() == 0);
 	}
 
+	SUBCASE("Changing connections while emitting should only affect the next emissions") {
+		SignalReceiver disconnected_receiver;
+		SignalReceiver connected_receiver;
+		SignalConnectionChanger changer;
+		changer.source = &object;
+		changer.to_disconnect = &disconnected_receiver;
+		changer.to_connect = &connected_receiver;
+
+		object.connect("my_custom_signal", callable_mp(&changer, &SignalConnectionChanger::callback));
+		object.connect("my_custom_signal", callable_mp(&disconnected_receiver, &SignalReceiver::counted_callback));
+
+		object.emit_signal("my_custom_signal");
+		CHECK(disconnected_receiver.call_count == 1);
+		CHECK(connected_receiver.call_count == 0);
+
+		object.emit_signal("my_custom_signal");
+		object.emit_signal("my_custom_signal");
+		CHECK(disconnected_receiver.call_count == 1);
+		CHECK(connected_receiver.call_count == 2);
+
+		object.disconnect("my_custom_signal", callable_mp(&changer, &SignalConnectionChanger::callback));
+		object.disconnect("my_custom_signal", callable_mp(&connected_receiver, &SignalReceiver::counted_callback));
+	}
+
 	SUBCASE("Connecting with CONNECT_APPEND_SOURCE_OBJECT flag") {
 		SignalReceiver target;
 
@@ -0,0 +1,153 @@
+/**************************************************************************/
+/*  test_performance.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_performance)
+
+#include "core/config/project_settings.h"
+#include "core/variant/typed_array.h"
+#include "main/performance.h"
+
+namespace TestPerformance {
+
+static Performance *create_performance(int p_history_size, double p_hitch_budget_msec, int p_max_hitches) {
+	ProjectSettings *ps = ProjectSettings::get_singleton();
+	ps->set_setting("debug/settings/frame_timing/history_size", p_history_size);
+	ps->set_setting("debug/settings/frame_timing/hitch_budget_msec", p_hitch_budget_msec);
+	ps->set_setting("debug/settings/frame_timing/max_hitches", p_max_hitches);
+	ps->set_setting("debug/settings/frame_timing/profile_scripts", false);
+	ps->set_setting("debug/settings/stdout/print_hitches", false);
+
+	Performance *performance = memnew(Performance);
+	performance->setup_frame_timing(false);
+	return performance;
+}
+
+static Performance::FrameTiming make_frame_timing(uint64_t p_frame, uint64_t p_total_usec) {
+	Performance::FrameTiming timing;
+	timing.frame = p_frame;
+	timing.total_usec = p_total_usec;
+	timing.physics_usec = p_total_usec / 2;
+	timing.physics_steps = 2;
+	timing.process_usec = p_total_usec / 4;
+	return timing;
+}
+
+TEST_CASE("[Performance] Frame timings are returned oldest first") {
+	Performance *performance = create_performance(4, 0.0, 16);
+
+	CHECK(performance->get_frame_timings().is_empty());
+
+	for (uint64_t i = 1; i <= 3; i++) {
+		performance->add_frame_timing(make_frame_timing(i, i * 1000));
+	}
+
+	TypedArray<Dictionary> timings = performance->get_frame_timings();
+	REQUIRE(timings.size() == 3);
+	for (int i = 0; i < 3; i++) {
+		const Dictionary timing = timings[i];
+		CHECK(uint64_t(timing["frame"]) == uint64_t(i + 1));
+		CHECK(double(timing["total"]) == doctest::Approx((i + 1) * 0.001));
+		CHECK(double(timing["physics"]) == doctest::Approx((i + 1) * 0.0005));
+		CHECK(int(timing["physics_steps"]) == 2);
+		CHECK(double(timing["process"]) == doctest::Approx((i + 1) * 0.00025));
+	}
+
+	memdelete(performance);
+}
+
+TEST_CASE("[Performance] Frame timing ring buffer keeps the most recent frames") {
+	Performance *performance = create_performance(4, 0.0, 16);
+
+	// Wrap around the ring buffer more than once.
+	for (uint64_t i = 1; i <= 10; i++) {
+		performance->add_frame_timing(make_frame_timing(i, 1000));
+	}
+
+	TypedArray<Dictionary> timings = performance->get_frame_timings();
+	REQUIRE(timings.size() == 4);
+	for (int i = 0; i < 4; i++) {
+		const Dictionary timing = timings[i];
+		CHECK(uint64_t(timing["frame"]) == uint64_t(7 + i));
+	}
+
+	memdelete(performance);
+
+	// A history size of zero disables recording.
+	performance = create_performance(0, 0.0, 16);
+	performance->add_frame_timing(make_frame_timing(1, 1000));
+	CHECK(performance->get_frame_timings().is_empty());
+	memdelete(performance);
+}
+
+TEST_CASE("[Performance] Frames over the hitch budget are captured") {
+	Performance *performance = create_performance(4, 0.0, 2);
+
+	// No budget, no hitches.
+	performance->add_frame_timing(make_frame_timing(1, 100000));
+	CHECK(performance->get_hitches().is_empty());
+
+	performance->set_hitch_budget(10.0);
+	CHECK(performance->get_hitch_budget() == doctest::Approx(10.0));
+
+	performance->add_frame_timing(make_frame_timing(2, 5000));
+	performance->add_frame_timing(make_frame_timing(3, 10000));
+	CHECK_MESSAGE(performance->get_hitches().is_empty(), "Frames within the budget shouldn't be captured.");
+
+	performance->add_frame_timing(make_frame_timing(4, 20000));
+	TypedArray<Dictionary> hitches = performance->get_hitches();
+	REQUIRE(hitches.size() == 1);
+	Dictionary hitch = hitches[0];
+	CHECK(uint64_t(hitch["frame"]) == 4);
+	CHECK(double(hitch["total"]) == doctest::Approx(0.02));
+	CHECK(double(hitch["budget"]) == doctest::Approx(0.01));
+	CHECK(Array(hitch["script_functions"]).is_empty());
+
+	// Only the most recent hitches are kept.
+	performance->add_frame_timing(make_frame_timing(5, 30000));
+	performance->add_frame_timing(make_frame_timing(6, 40000));
+	hitches = performance->get_hitches();
+	REQUIRE(hitches.size() == 2);
+	CHECK(uint64_t(Dictionary(hitches[0])["frame"]) == 5);
+	CHECK(uint64_t(Dictionary(hitches[1])["frame"]) == 6);
+
+	performance->clear_hitches();
+	CHECK(performance->get_hitches().is_empty());
+
+	ERR_PRINT_OFF;
+	performance->set_hitch_budget(-1.0);
+	ERR_PRINT_ON;
+	CHECK_MESSAGE(performance->get_hitch_budget() == doctest::Approx(10.0), "A negative budget should be rejected.");
+
+	memdelete(performance);
+}
+
+} // namespace TestPerformance
@@ -117,6 +117,31 @@ TEST_CASE("[SceneTree][HeightMapShape3D] update_map_data_from_image") {
 	CHECK(height_map_shape->get_max_height() == 10.0);
 }
 
+TEST_CASE("[SceneTree][HeightMapShape3D] update_map_data_region") {
+	Ref<HeightMapShape3D> height_map_shape = memnew(HeightMapShape3D);
+	height_map_shape->set_map_width(4);
+	height_map_shape->set_map_depth(3);
+
+	height_map_shape->update_map_data_region(Rect2i(1, 1, 2, 2), Vector<real_t>{ 1.0, 2.0, -3.0, 4.0 });
+
+	Vector<real_t> expected_map_data = {
+		0.0, 0.0, 0.0, 0.0,
+		0.0, 1.0, 2.0, 0.0,
+		0.0, -3.0, 4.0, 0.0
+	};
+	CHECK(height_map_shape->get_map_data() == expected_map_data);
+	CHECK(height_map_shape->get_min_height() == -3.0);
+	CHECK(height_map_shape->get_max_height() == 4.0);
+
+	ERR_PRINT_OFF;
+	// Regions outside of the heightmap, or with mismatched data, are rejected.
+	height_map_shape->update_map_data_region(Rect2i(3, 0, 2, 1), Vector<real_t>{ 5.0, 5.0 });
+	height_map_shape->update_map_data_region(Rect2i(0, 0, 2, 1), Vector<real_t>{ 5.0 });
+	ERR_PRINT_ON;
+
+	CHECK(height_map_shape->get_map_data() == expected_map_data);
+}
+
 } // namespace TestHeightMapShape3D
 
 #endif // PHYSICS_3D_DISABLED
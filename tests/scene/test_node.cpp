@@ -37,6 +37,7 @@ TEST_FORCE_LINK(test_node)
 #include "core/object/class_db.h"
 #include "scene/main/node.h"
 #include "scene/main/scene_tree.h"
+#include "scene/main/timer.h"
 #include "scene/main/window.h"
 #include "scene/resources/packed_scene.h"
 #include "tests/test_utils.h"
@@ -847,6 +848,516 @@ TEST_CASE("[SceneTree][Node] Test the processing") {
 	memdelete(node);
 }
 
+class TestBatchNode : public Node {
+	GDCLASS(TestBatchNode, Node);
+
+	static void _process_batch(Span<Node *> p_nodes, double p_delta) {
+		batch_sizes.push_back(p_nodes.size());
+		for (Node *node : p_nodes) {
+			static_cast<TestBatchNode *>(node)->batch_counter++;
+			events.push_back("process " + String(node->get_name()));
+		}
+	}
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_INTERNAL_PROCESS) {
+			events.push_back("internal " + String(get_name()));
+		}
+	}
+
+public:
+	static inline LocalVector<uint64_t> batch_sizes;
+	static inline Vector<String> events;
+	int batch_counter = 0;
+
+	TestBatchNode() {
+		set_process_batch_func(&_process_batch);
+		set_physics_process_batch_func(&_process_batch);
+	}
+};
+
+TEST_CASE("[SceneTree][Node] Test batch processing") {
+	TestBatchNode *batch_nodes[4];
+	for (int i = 0; i < 4; i++) {
+		batch_nodes[i] = memnew(TestBatchNode);
+		batch_nodes[i]->set_process(true);
+		batch_nodes[i]->set_physics_process(true);
+		SceneTree::get_singleton()->get_root()->add_child(batch_nodes[i]);
+	}
+	TestBatchNode::batch_sizes.clear();
+
+	SUBCASE("Consecutive nodes sharing a batch function are processed at once") {
+		SceneTree::get_singleton()->process(0);
+		CHECK_EQ(TestBatchNode::batch_sizes.size(), 1);
+		CHECK_EQ(TestBatchNode::batch_sizes[0], 4);
+
+		SceneTree::get_singleton()->physics_process(0);
+		CHECK_EQ(TestBatchNode::batch_sizes.size(), 2);
+		CHECK_EQ(TestBatchNode::batch_sizes[1], 4);
+
+		for (TestBatchNode *node : batch_nodes) {
+			CHECK_EQ(node->batch_counter, 2);
+		}
+	}
+
+	SUBCASE("Nodes that are not processing don't split the batch") {
+		batch_nodes[1]->set_process(false);
+
+		SceneTree::get_singleton()->process(0);
+		CHECK_EQ(TestBatchNode::batch_sizes.size(), 1);
+		CHECK_EQ(TestBatchNode::batch_sizes[0], 3);
+		CHECK_EQ(batch_nodes[1]->batch_counter, 0);
+	}
+
+	SUBCASE("Nodes that can't process don't change the process list") {
+		batch_nodes[1]->set_process_mode(Node::PROCESS_MODE_DISABLED);
+
+		SceneTree::get_singleton()->process(0);
+		CHECK_EQ(TestBatchNode::batch_sizes.size(), 1);
+		CHECK_EQ(TestBatchNode::batch_sizes[0], 3);
+		CHECK_EQ(batch_nodes[1]->batch_counter, 0);
+
+		// Every node is still in the list once, in the same order.
+		batch_nodes[1]->set_process_mode(Node::PROCESS_MODE_INHERIT);
+		SceneTree::get_singleton()->process(0);
+		CHECK_EQ(TestBatchNode::batch_sizes.size(), 2);
+		CHECK_EQ(TestBatchNode::batch_sizes[1], 4);
+		CHECK_EQ(batch_nodes[0]->batch_counter, 2);
+		CHECK_EQ(batch_nodes[1]->batch_counter, 1);
+		CHECK_EQ(batch_nodes[2]->batch_counter, 2);
+		CHECK_EQ(batch_nodes[3]->batch_counter, 2);
+	}
+
+	SUBCASE("Nodes processed individually in between split the batch") {
+		List<Node *> process_order;
+		TestNode *node = memnew(TestNode);
+		node->callback_list = &process_order;
+		node->set_process(true);
+		SceneTree::get_singleton()->get_root()->add_child(node);
+		SceneTree::get_singleton()->get_root()->move_child(node, batch_nodes[2]->get_index());
+
+		SceneTree::get_singleton()->process(0);
+		CHECK_EQ(TestBatchNode::batch_sizes.size(), 2);
+		CHECK_EQ(TestBatchNode::batch_sizes[0], 2);
+		CHECK_EQ(TestBatchNode::batch_sizes[1], 2);
+		CHECK_EQ(node->process_counter, 1);
+
+		memdelete(node);
+	}
+
+	SUBCASE("Internal notifications are sent right before each node is processed") {
+		for (int i = 0; i < 4; i++) {
+			batch_nodes[i]->set_name(itos(i));
+		}
+		batch_nodes[0]->set_process_internal(true);
+		batch_nodes[2]->set_process_internal(true);
+		TestBatchNode::events.clear();
+
+		SceneTree::get_singleton()->process(0);
+		const Vector<String> expected = { "internal 0", "process 0", "process 1", "internal 2", "process 2", "process 3" };
+		CHECK(TestBatchNode::events == expected);
+
+		// Only the first node of a run can process internally.
+		CHECK_EQ(TestBatchNode::batch_sizes.size(), 2);
+		CHECK_EQ(TestBatchNode::batch_sizes[0], 2);
+		CHECK_EQ(TestBatchNode::batch_sizes[1], 2);
+	}
+
+	SUBCASE("Process priority is respected") {
+		batch_nodes[0]->set_process_priority(10);
+
+		SceneTree::get_singleton()->process(0);
+		CHECK_EQ(TestBatchNode::batch_sizes.size(), 2);
+		CHECK_EQ(TestBatchNode::batch_sizes[0], 3);
+		CHECK_EQ(TestBatchNode::batch_sizes[1], 1);
+	}
+
+	for (TestBatchNode *node : batch_nodes) {
+		memdelete(node);
+	}
+}
+
+class TestThreadGroupNode : public Node {
+	GDCLASS(TestThreadGroupNode, Node);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_PROCESS) {
+			processed_in_group = Node::is_group_processing();
+			parent_accessible = get_parent()->is_accessible_from_caller_thread();
+		}
+	}
+
+public:
+	bool processed_in_group = false;
+	bool parent_accessible = false;
+};
+
+TEST_CASE("[SceneTree][Node] Test sub-thread process groups") {
+	Node *parent = memnew(Node);
+	TestThreadGroupNode *child = memnew(TestThreadGroupNode);
+	child->set_process(true);
+	parent->add_child(child);
+
+	SUBCASE("Sub-thread group inside a main thread group gets its own group") {
+		parent->set_process_thread_group(Node::PROCESS_THREAD_GROUP_MAIN_THREAD);
+		child->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+		SceneTree::get_singleton()->get_root()->add_child(parent);
+
+		SceneTree::get_singleton()->process(0);
+		CHECK(child->processed_in_group);
+		CHECK_FALSE(child->parent_accessible);
+	}
+
+	SUBCASE("Inheriting node joins the sub-thread group of its parent") {
+		parent->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+		SceneTree::get_singleton()->get_root()->add_child(parent);
+
+		SceneTree::get_singleton()->process(0);
+		CHECK(child->processed_in_group);
+		CHECK(child->parent_accessible);
+	}
+
+	SUBCASE("Groups follow changes of the thread group mode") {
+		parent->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+		SceneTree::get_singleton()->get_root()->add_child(parent);
+
+		child->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+		SceneTree::get_singleton()->process(0);
+		CHECK(child->processed_in_group);
+		CHECK_FALSE(child->parent_accessible);
+
+		// The group of the child is removed, and freed on the next process.
+		child->set_process_thread_group(Node::PROCESS_THREAD_GROUP_INHERIT);
+		SceneTree::get_singleton()->process(0);
+		CHECK(child->processed_in_group);
+		CHECK(child->parent_accessible);
+	}
+
+	memdelete(parent);
+}
+
+class TestAutoThreadGroupNode : public Node {
+	GDCLASS(TestAutoThreadGroupNode, Node);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_PROCESS) {
+			process_order = process_counter.increment();
+			processed_in_group = Node::is_group_processing();
+			if (target) {
+				target_readable = target->is_readable_from_caller_thread();
+			}
+		}
+	}
+
+public:
+	static inline SafeNumeric<uint32_t> process_counter{ 0 };
+
+	Node *target = nullptr;
+	uint32_t process_order = 0;
+	bool processed_in_group = false;
+	bool target_readable = false;
+
+	TestAutoThreadGroupNode(ProcessThreadAccess p_access = PROCESS_THREAD_ACCESS_SUBTREE) {
+		set_process_thread_group(PROCESS_THREAD_GROUP_AUTO);
+		set_process_thread_access(p_access);
+		set_process(true);
+	}
+};
+
+TEST_CASE("[SceneTree][Node] Test automatic process thread groups") {
+	Window *root = SceneTree::get_singleton()->get_root();
+	TestAutoThreadGroupNode::process_counter.set(0);
+
+	SUBCASE("Automatic group outside of a threaded group gets its own group") {
+		Node *parent = memnew(Node);
+		parent->set_process_thread_group(Node::PROCESS_THREAD_GROUP_MAIN_THREAD);
+		TestThreadGroupNode *agent = memnew(TestThreadGroupNode);
+		agent->set_process_thread_group(Node::PROCESS_THREAD_GROUP_AUTO);
+		agent->set_process(true);
+		parent->add_child(agent);
+		root->add_child(parent);
+
+		SceneTree::get_singleton()->process(0);
+		CHECK(agent->processed_in_group);
+		CHECK_FALSE(agent->parent_accessible);
+
+		// Once the parent is processed in a sub-thread, the automatic group joins it.
+		parent->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+		SceneTree::get_singleton()->process(0);
+		CHECK(agent->processed_in_group);
+		CHECK(agent->parent_accessible);
+
+		memdelete(parent);
+	}
+
+	SUBCASE("Groups are scheduled from the declared access") {
+		TestAutoThreadGroupNode *independent = memnew(TestAutoThreadGroupNode);
+		TestAutoThreadGroupNode *reader = memnew(TestAutoThreadGroupNode(Node::PROCESS_THREAD_ACCESS_READ_OUTSIDE));
+		TestAutoThreadGroupNode *writer = memnew(TestAutoThreadGroupNode(Node::PROCESS_THREAD_ACCESS_WRITE_OUTSIDE));
+		reader->target = independent;
+		writer->target = independent;
+		root->add_child(writer);
+		root->add_child(reader);
+		root->add_child(independent);
+
+		SceneTree::get_singleton()->process(0);
+		CHECK(independent->processed_in_group);
+		CHECK(reader->processed_in_group);
+		CHECK(reader->target_readable);
+		// Groups writing outside of themselves are processed on the main thread.
+		CHECK_FALSE(writer->processed_in_group);
+		CHECK(writer->target_readable);
+
+		CHECK_LT(independent->process_order, reader->process_order);
+		CHECK_LT(reader->process_order, writer->process_order);
+
+		// Changing the declaration moves the group to another phase.
+		writer->set_process_thread_access(Node::PROCESS_THREAD_ACCESS_SUBTREE);
+		writer->target = nullptr;
+		SceneTree::get_singleton()->process(0);
+		CHECK(writer->processed_in_group);
+		CHECK_LT(writer->process_order, reader->process_order);
+
+		memdelete(independent);
+		memdelete(reader);
+		memdelete(writer);
+	}
+
+#ifdef DEBUG_ENABLED
+	SUBCASE("Undeclared reads outside of the group are reported") {
+		TestAutoThreadGroupNode *first = memnew(TestAutoThreadGroupNode);
+		TestAutoThreadGroupNode *second = memnew(TestAutoThreadGroupNode);
+		first->target = second;
+		root->add_child(first);
+		root->add_child(second);
+
+		ERR_PRINT_OFF;
+		SceneTree::get_singleton()->process(0);
+		ERR_PRINT_ON;
+		CHECK(first->processed_in_group);
+		CHECK_FALSE(first->target_readable);
+
+		memdelete(first);
+		memdelete(second);
+	}
+
+	SUBCASE("Reads between groups processed at the same time are reported") {
+		TestAutoThreadGroupNode *first = memnew(TestAutoThreadGroupNode(Node::PROCESS_THREAD_ACCESS_READ_OUTSIDE));
+		TestAutoThreadGroupNode *second = memnew(TestAutoThreadGroupNode(Node::PROCESS_THREAD_ACCESS_READ_OUTSIDE));
+		first->target = second;
+		second->target = root;
+		root->add_child(first);
+		root->add_child(second);
+
+		ERR_PRINT_OFF;
+		SceneTree::get_singleton()->process(0);
+		ERR_PRINT_ON;
+		CHECK_FALSE(first->target_readable);
+		// Nodes outside of any automatic group can still be read.
+		CHECK(second->target_readable);
+
+		memdelete(first);
+		memdelete(second);
+	}
+#endif // DEBUG_ENABLED
+}
+
+TEST_CASE("[Node] Cached node path resolution follows tree changes") {
+	Node *root = memnew(Node);
+	Node *a = memnew(Node);
+	a->set_name("A");
+	root->add_child(a);
+	Node *b = memnew(Node);
+	b->set_name("B");
+	a->add_child(b);
+	Node *c = memnew(Node);
+	c->set_name("C");
+	b->add_child(c);
+
+	const NodePath path("A/B/C");
+	CHECK(root->get_node_or_null(path) == c);
+	CHECK(root->get_node_or_null(path) == c);
+
+	// Renaming a node along the path.
+	b->set_name("B2");
+	CHECK(root->get_node_or_null(path) == nullptr);
+	b->set_name("B");
+	CHECK(root->get_node_or_null(path) == c);
+
+	// Replacing the node at the end of the path.
+	b->remove_child(c);
+	Node *other_c = memnew(Node);
+	other_c->set_name("C");
+	b->add_child(other_c);
+	CHECK(root->get_node_or_null(path) == other_c);
+
+	// Moving a node along the path somewhere else.
+	root->remove_child(a);
+	CHECK(root->get_node_or_null(path) == nullptr);
+	CHECK(a->get_node_or_null(NodePath("B/C")) == other_c);
+
+	// Freeing the cached node.
+	memdelete(other_c);
+	CHECK(a->get_node_or_null(NodePath("B/C")) == nullptr);
+
+	memdelete(c);
+	memdelete(a);
+	memdelete(root);
+}
+
+TEST_CASE("[SceneTree][Node] Calling methods on groups of mixed classes") {
+	Node *root = SceneTree::get_singleton()->get_root();
+	Node *parent = memnew(Node);
+	root->add_child(parent);
+
+	Vector<Node *> nodes;
+	for (int i = 0; i < 6; i++) {
+		Node *node = (i % 3 == 2) ? memnew(Timer) : memnew(Node);
+		parent->add_child(node);
+		node->add_to_group("mixed_nodes");
+		nodes.push_back(node);
+	}
+
+	SceneTree::get_singleton()->call_group("mixed_nodes", "set_process_priority", 5);
+	for (Node *node : nodes) {
+		CHECK(node->get_process_priority() == 5);
+	}
+
+	// Calling a method only some classes have is not an error.
+	SceneTree::get_singleton()->call_group("mixed_nodes", "nonexistent_method");
+
+	// The first node is found without sorting, and follows the order changes.
+	CHECK(SceneTree::get_singleton()->get_first_node_in_group("mixed_nodes") == nodes[0]);
+	parent->move_child(nodes[3], 0);
+	CHECK(SceneTree::get_singleton()->get_first_node_in_group("mixed_nodes") == nodes[3]);
+	nodes[3]->remove_from_group("mixed_nodes");
+	CHECK(SceneTree::get_singleton()->get_first_node_in_group("mixed_nodes") == nodes[0]);
+
+	// Moving the first node after its siblings.
+	parent->move_child(nodes[0], -1);
+	CHECK(SceneTree::get_singleton()->get_first_node_in_group("mixed_nodes") == nodes[1]);
+
+	// Moving a subtree with nodes of the group before the first one.
+	Node *nested = memnew(Node);
+	nodes[4]->add_child(nested);
+	nested->add_to_group("mixed_nodes");
+	CHECK(SceneTree::get_singleton()->get_first_node_in_group("mixed_nodes") == nodes[1]);
+	parent->move_child(nodes[4], 0);
+	CHECK(SceneTree::get_singleton()->get_first_node_in_group("mixed_nodes") == nodes[4]);
+	nodes[4]->remove_from_group("mixed_nodes");
+	CHECK(SceneTree::get_singleton()->get_first_node_in_group("mixed_nodes") == nested);
+
+	// Moving the subtree holding the first node after other nodes of the group.
+	parent->move_child(nodes[4], nodes[1]->get_index() + 1);
+	CHECK(SceneTree::get_singleton()->get_first_node_in_group("mixed_nodes") == nodes[1]);
+
+	// Moving a node without nodes of the group doesn't change the first one.
+	parent->move_child(nodes[3], -1);
+	CHECK(SceneTree::get_singleton()->get_first_node_in_group("mixed_nodes") == nodes[1]);
+
+	memdelete(parent);
+}
+
+TEST_CASE("[SceneTree][Node] Groups of subtrees entering and leaving the tree") {
+	Node *root = SceneTree::get_singleton()->get_root();
+	Node *first = memnew(Node);
+	Node *second = memnew(Node);
+	for (Node *subtree : { first, second }) {
+		subtree->add_to_group("subtree_nodes");
+		for (int i = 0; i < 3; i++) {
+			Node *child = memnew(Node);
+			child->add_to_group("subtree_nodes");
+			child->set_process_input(true);
+			subtree->add_child(child);
+		}
+	}
+
+	root->add_child(first);
+	root->add_child(second);
+	CHECK(SceneTree::get_singleton()->get_nodes_in_group("subtree_nodes").size() == 8);
+	const StringName input_group = "_vp_input" + itos(root->get_viewport()->get_instance_id());
+	CHECK(SceneTree::get_singleton()->get_nodes_in_group(input_group).has(second->get_child(2)));
+
+	// Removing a subtree from the middle of the group keeps the other nodes in tree order.
+	root->remove_child(first);
+	Vector<Node *> nodes = SceneTree::get_singleton()->get_nodes_in_group("subtree_nodes");
+	REQUIRE(nodes.size() == 4);
+	CHECK(nodes[0] == second);
+	for (int i = 0; i < 3; i++) {
+		CHECK(nodes[i + 1] == second->get_child(i));
+	}
+	CHECK_FALSE(SceneTree::get_singleton()->get_nodes_in_group(input_group).has(first->get_child(0)));
+
+	root->remove_child(second);
+	CHECK_FALSE(SceneTree::get_singleton()->has_group("subtree_nodes"));
+
+	memdelete(first);
+	memdelete(second);
+}
+
+class TestEnterTreeGroupNode : public Node {
+	GDCLASS(TestEnterTreeGroupNode, Node);
+
+protected:
+	void _notification(int p_what) {
+		switch (p_what) {
+			case NOTIFICATION_ENTER_TREE: {
+				count_on_enter = get_tree()->get_node_count_in_group("entering_nodes");
+			} break;
+			case NOTIFICATION_PROCESS: {
+				process_order->push_back(this);
+			} break;
+		}
+	}
+
+public:
+	int count_on_enter = 0;
+	List<Node *> *process_order = nullptr;
+};
+
+TEST_CASE("[SceneTree][Node] Groups and process lists of a subtree entering the tree") {
+	List<Node *> process_order;
+	TestEnterTreeGroupNode *parent = memnew(TestEnterTreeGroupNode);
+	parent->process_order = &process_order;
+	parent->add_to_group("entering_nodes");
+	parent->set_process(true);
+	for (int i = 0; i < 3; i++) {
+		TestEnterTreeGroupNode *child = memnew(TestEnterTreeGroupNode);
+		child->process_order = &process_order;
+		child->add_to_group("entering_nodes");
+		child->set_process(true);
+		child->set_process_priority(-i);
+		parent->add_child(child);
+	}
+
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+
+	// Nodes already entered are in the group when a node reads it while entering.
+	CHECK_EQ(parent->count_on_enter, 1);
+	for (int i = 0; i < 3; i++) {
+		CHECK_EQ(Object::cast_to<TestEnterTreeGroupNode>(parent->get_child(i))->count_on_enter, i + 2);
+	}
+
+	Vector<Node *> nodes = SceneTree::get_singleton()->get_nodes_in_group("entering_nodes");
+	REQUIRE_EQ(nodes.size(), 4);
+	CHECK_EQ(nodes[0], parent);
+	for (int i = 0; i < 3; i++) {
+		CHECK_EQ(nodes[i + 1], parent->get_child(i));
+	}
+
+	SceneTree::get_singleton()->process(0);
+	REQUIRE_EQ(process_order.size(), 4);
+	CHECK_EQ(process_order.get(0), parent->get_child(2));
+	CHECK_EQ(process_order.get(1), parent->get_child(1));
+	CHECK_EQ(process_order.get(2), parent);
+	CHECK_EQ(process_order.get(3), parent->get_child(0));
+
+	memdelete(parent);
+}
+
 TEST_CASE("[SceneTree][Node] Test the process priority") {
 	List<Node *> process_order;
 
@@ -33,6 +33,7 @@
 TEST_FORCE_LINK(test_packed_scene)
 
 #include "core/object/callable_mp.h"
+#include "core/variant/typed_array.h"
 #include "scene/resources/packed_scene.h"
 
 namespace TestPackedScene {
@@ -216,6 +217,46 @@ TEST_CASE("[PackedScene] Instantiate Packed Scene With Children") {
 	memdelete(instance);
 }
 
+TEST_CASE("[PackedScene] Instantiate Multiple Copies Of Packed Scene") {
+	// Create a scene with non-default properties to pack.
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+	scene->set_process_priority(7);
+
+	Node *child = memnew(Node);
+	child->set_name("Child");
+	child->set_process_mode(Node::PROCESS_MODE_ALWAYS);
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	// Pack the scene.
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+
+	// Instantiate several copies at once; property values must be applied to each copy.
+	TypedArray<Node> instances = packed_scene.instantiate_multiple(3);
+	REQUIRE(instances.size() == 3);
+	for (int i = 0; i < instances.size(); i++) {
+		Node *instance = Object::cast_to<Node>(instances[i]);
+		REQUIRE(instance != nullptr);
+		CHECK(instance->get_name() == "TestScene");
+		CHECK(instance->get_process_priority() == 7);
+		REQUIRE(instance->get_child_count() == 1);
+		CHECK(instance->get_child(0)->get_process_mode() == Node::PROCESS_MODE_ALWAYS);
+		CHECK(instance->get_child(0)->get_owner() == instance);
+#ifdef TOOLS_ENABLED
+		// Properties are set through cached setters, which must mark nodes as edited like `Object::set()`.
+		CHECK(instance->is_edited());
+		CHECK(instance->get_child(0)->is_edited());
+#endif // TOOLS_ENABLED
+		memdelete(instance);
+	}
+
+	CHECK(packed_scene.instantiate_multiple(0).is_empty());
+
+	memdelete(scene);
+}
+
 TEST_CASE("[PackedScene] Set Path") {
 	// Create a scene to pack.
 	Node *scene = memnew(Node);
@@ -0,0 +1,161 @@
+/**************************************************************************/
+/*  test_rigid_body_2d.cpp                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_rigid_body_2d)
+
+#ifndef PHYSICS_2D_DISABLED
+
+#include "scene/2d/physics/collision_shape_2d.h"
+#include "scene/2d/physics/rigid_body_2d.h"
+#include "scene/2d/physics/static_body_2d.h"
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
+#include "scene/resources/2d/rectangle_shape_2d.h"
+#include "tests/signal_watcher.h"
+
+namespace TestRigidBody2D {
+
+// Counts the batched states delivered to a body, then forwards them to the regular batch callback.
+static ObjectID batched_body_id;
+static int batched_body_sync_count = 0;
+
+static void count_batched_body_states(const PhysicsServer2D::BodyStateSync *p_states, uint32_t p_count) {
+	for (uint32_t i = 0; i < p_count; i++) {
+		if (p_states[i].instance_id == batched_body_id) {
+			batched_body_sync_count++;
+		}
+	}
+	RigidBody2D::sync_batched_body_states(p_states, p_count);
+}
+
+static void step_physics(int p_steps) {
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+	for (int i = 0; i < p_steps; i++) {
+		ps->step(1.0 / 60.0);
+		ps->flush_queries();
+	}
+}
+
+static void add_rectangle_shape(CollisionObject2D *p_body, const Vector2 &p_size) {
+	Ref<RectangleShape2D> shape;
+	shape.instantiate();
+	shape->set_size(p_size);
+	CollisionShape2D *collision_shape = memnew(CollisionShape2D);
+	collision_shape->set_shape(shape);
+	p_body->add_child(collision_shape);
+}
+
+static void check_body_synced(RigidBody2D *p_body) {
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+	RID rid = p_body->get_rid();
+	CHECK(p_body->get_global_transform().is_equal_approx(ps->body_get_state(rid, PhysicsServer2D::BODY_STATE_TRANSFORM)));
+	CHECK(p_body->get_linear_velocity().is_equal_approx(ps->body_get_state(rid, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY)));
+	CHECK(Math::is_equal_approx(p_body->get_angular_velocity(), real_t(ps->body_get_state(rid, PhysicsServer2D::BODY_STATE_ANGULAR_VELOCITY))));
+	CHECK(p_body->is_sleeping() == bool(ps->body_get_state(rid, PhysicsServer2D::BODY_STATE_SLEEPING)));
+}
+
+TEST_CASE("[SceneTree][RigidBody2D] Batched state sync") {
+	PhysicsServer2D::get_singleton()->set_active(true);
+	Window *root = SceneTree::get_singleton()->get_root();
+
+	StaticBody2D *floor = memnew(StaticBody2D);
+	add_rectangle_shape(floor, Vector2(2000, 20));
+	floor->set_position(Vector2(0, 10));
+	root->add_child(floor);
+
+	// Without `_integrate_forces()` or contact monitoring, the body goes through the batch callback.
+	RigidBody2D *body = memnew(RigidBody2D);
+	add_rectangle_shape(body, Vector2(20, 20));
+	body->set_position(Vector2(0, -30));
+	root->add_child(body);
+
+	const PhysicsServer2D::BodyStateSyncBatchCallback batch_callback = PhysicsServer2D::get_body_state_sync_batch_callback();
+	PhysicsServer2D::set_body_state_sync_batch_callback(count_batched_body_states);
+	batched_body_id = body->get_instance_id();
+	batched_body_sync_count = 0;
+
+	SUBCASE("The body gets its transform, velocities and sleeping state") {
+		body->set_linear_velocity(Vector2(50, 0));
+		body->set_angular_velocity(1);
+		SIGNAL_WATCH(body, SceneStringName(sleeping_state_changed));
+
+		step_physics(1);
+		CHECK_MESSAGE(batched_body_sync_count == 1, "The body state should have been synced through the batch callback.");
+		CHECK(body->get_position().x > 0);
+		CHECK(body->get_position().y > -30);
+		CHECK(body->get_linear_velocity().y > 0);
+		CHECK_FALSE(body->is_sleeping());
+		check_body_synced(body);
+
+		for (int i = 0; i < 600 && !body->is_sleeping(); i++) {
+			step_physics(1);
+		}
+		CHECK(body->is_sleeping());
+		check_body_synced(body);
+
+		// Sleeping bodies don't move, so they aren't synced anymore.
+		const int sync_count = batched_body_sync_count;
+		CHECK(sync_count > 1);
+		step_physics(10);
+		CHECK(batched_body_sync_count == sync_count);
+
+		Array empty_signal_args = { Array() };
+		SIGNAL_CHECK(SceneStringName(sleeping_state_changed), empty_signal_args);
+		SIGNAL_UNWATCH(body, SceneStringName(sleeping_state_changed));
+	}
+
+	SUBCASE("Enabling the contact monitor at runtime still reports contacts") {
+		step_physics(2);
+		CHECK(batched_body_sync_count == 2);
+		check_body_synced(body);
+
+		body->set_contact_monitor(true);
+		body->set_max_contacts_reported(4);
+		SIGNAL_WATCH(body, SceneStringName(body_entered));
+
+		step_physics(60);
+		CHECK_MESSAGE(batched_body_sync_count == 2, "Bodies reporting contacts should go through the regular callback.");
+		SIGNAL_CHECK(SceneStringName(body_entered), { { floor } });
+		CHECK(body->get_colliding_bodies().has(floor));
+		check_body_synced(body);
+		SIGNAL_UNWATCH(body, SceneStringName(body_entered));
+	}
+
+	PhysicsServer2D::set_body_state_sync_batch_callback(batch_callback);
+	memdelete(body);
+	memdelete(floor);
+	PhysicsServer2D::get_singleton()->set_active(false);
+}
+
+} // namespace TestRigidBody2D
+
+#endif // PHYSICS_2D_DISABLED
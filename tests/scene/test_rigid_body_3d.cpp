@@ -0,0 +1,161 @@
+/**************************************************************************/
+/*  test_rigid_body_3d.cpp                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_rigid_body_3d)
+
+#ifndef PHYSICS_3D_DISABLED
+
+#include "scene/3d/physics/collision_shape_3d.h"
+#include "scene/3d/physics/rigid_body_3d.h"
+#include "scene/3d/physics/static_body_3d.h"
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
+#include "scene/resources/3d/box_shape_3d.h"
+#include "tests/signal_watcher.h"
+
+namespace TestRigidBody3D {
+
+// Counts the batched states delivered to a body, then forwards them to the regular batch callback.
+static ObjectID batched_body_id;
+static int batched_body_sync_count = 0;
+
+static void count_batched_body_states(const PhysicsServer3D::BodyStateSync *p_states, uint32_t p_count) {
+	for (uint32_t i = 0; i < p_count; i++) {
+		if (p_states[i].instance_id == batched_body_id) {
+			batched_body_sync_count++;
+		}
+	}
+	RigidBody3D::sync_batched_body_states(p_states, p_count);
+}
+
+static void step_physics(int p_steps) {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	for (int i = 0; i < p_steps; i++) {
+		ps->step(1.0 / 60.0);
+		ps->flush_queries();
+	}
+}
+
+static void add_box_shape(CollisionObject3D *p_body, const Vector3 &p_size) {
+	Ref<BoxShape3D> shape;
+	shape.instantiate();
+	shape->set_size(p_size);
+	CollisionShape3D *collision_shape = memnew(CollisionShape3D);
+	collision_shape->set_shape(shape);
+	p_body->add_child(collision_shape);
+}
+
+static void check_body_synced(RigidBody3D *p_body) {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID rid = p_body->get_rid();
+	CHECK(p_body->get_global_transform().is_equal_approx(ps->body_get_state(rid, PhysicsServer3D::BODY_STATE_TRANSFORM)));
+	CHECK(p_body->get_linear_velocity().is_equal_approx(ps->body_get_state(rid, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY)));
+	CHECK(p_body->get_angular_velocity().is_equal_approx(ps->body_get_state(rid, PhysicsServer3D::BODY_STATE_ANGULAR_VELOCITY)));
+	CHECK(p_body->is_sleeping() == bool(ps->body_get_state(rid, PhysicsServer3D::BODY_STATE_SLEEPING)));
+}
+
+TEST_CASE("[SceneTree][RigidBody3D] Batched state sync") {
+	PhysicsServer3D::get_singleton()->set_active(true);
+	Window *root = SceneTree::get_singleton()->get_root();
+
+	StaticBody3D *floor = memnew(StaticBody3D);
+	add_box_shape(floor, Vector3(20, 1, 20));
+	floor->set_position(Vector3(0, -0.5, 0));
+	root->add_child(floor);
+
+	// Without `_integrate_forces()` or contact monitoring, the body goes through the batch callback.
+	RigidBody3D *body = memnew(RigidBody3D);
+	add_box_shape(body, Vector3(1, 1, 1));
+	body->set_position(Vector3(0, 1.5, 0));
+	root->add_child(body);
+
+	const PhysicsServer3D::BodyStateSyncBatchCallback batch_callback = PhysicsServer3D::get_body_state_sync_batch_callback();
+	PhysicsServer3D::set_body_state_sync_batch_callback(count_batched_body_states);
+	batched_body_id = body->get_instance_id();
+	batched_body_sync_count = 0;
+
+	SUBCASE("The body gets its transform, velocities and sleeping state") {
+		body->set_linear_velocity(Vector3(1, 0, 0));
+		body->set_angular_velocity(Vector3(0, 1, 0));
+		SIGNAL_WATCH(body, SceneStringName(sleeping_state_changed));
+
+		step_physics(1);
+		CHECK_MESSAGE(batched_body_sync_count == 1, "The body state should have been synced through the batch callback.");
+		CHECK(body->get_position().x > 0);
+		CHECK(body->get_position().y < 1.5);
+		CHECK(body->get_linear_velocity().y < 0);
+		CHECK_FALSE(body->is_sleeping());
+		check_body_synced(body);
+
+		for (int i = 0; i < 600 && !body->is_sleeping(); i++) {
+			step_physics(1);
+		}
+		CHECK(body->is_sleeping());
+		check_body_synced(body);
+
+		// Sleeping bodies don't move, so they aren't synced anymore.
+		const int sync_count = batched_body_sync_count;
+		CHECK(sync_count > 1);
+		step_physics(10);
+		CHECK(batched_body_sync_count == sync_count);
+
+		Array empty_signal_args = { Array() };
+		SIGNAL_CHECK(SceneStringName(sleeping_state_changed), empty_signal_args);
+		SIGNAL_UNWATCH(body, SceneStringName(sleeping_state_changed));
+	}
+
+	SUBCASE("Enabling the contact monitor at runtime still reports contacts") {
+		step_physics(2);
+		CHECK(batched_body_sync_count == 2);
+		check_body_synced(body);
+
+		body->set_contact_monitor(true);
+		body->set_max_contacts_reported(4);
+		SIGNAL_WATCH(body, SceneStringName(body_entered));
+
+		step_physics(60);
+		CHECK_MESSAGE(batched_body_sync_count == 2, "Bodies reporting contacts should go through the regular callback.");
+		SIGNAL_CHECK(SceneStringName(body_entered), { { floor } });
+		CHECK(body->get_colliding_bodies().has(floor));
+		check_body_synced(body);
+		SIGNAL_UNWATCH(body, SceneStringName(body_entered));
+	}
+
+	PhysicsServer3D::set_body_state_sync_batch_callback(batch_callback);
+	memdelete(body);
+	memdelete(floor);
+	PhysicsServer3D::get_singleton()->set_active(false);
+}
+
+} // namespace TestRigidBody3D
+
+#endif // PHYSICS_3D_DISABLED
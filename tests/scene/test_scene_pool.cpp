@@ -0,0 +1,133 @@
+/**************************************************************************/
+/*  test_scene_pool.cpp                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_scene_pool)
+
+#include "scene/resources/scene_pool.h"
+
+namespace TestScenePool {
+
+static Ref<PackedScene> _create_packed_scene() {
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+	scene->set_process_priority(3);
+
+	Node *child = memnew(Node);
+	child->set_name("Child");
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+	memdelete(scene);
+	return packed_scene;
+}
+
+TEST_CASE("[ScenePool] Acquire and release instances") {
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(_create_packed_scene());
+
+	Node *instance = pool->acquire();
+	REQUIRE(instance != nullptr);
+	CHECK(instance->get_name() == "TestScene");
+	CHECK(instance->get_process_priority() == 3);
+	CHECK(pool->get_available_count() == 0);
+
+	// Modify the instance while it is in use.
+	Node *parent = memnew(Node);
+	parent->add_child(instance);
+	instance->set_process_priority(10);
+	instance->get_node(NodePath("Child"))->set_process_mode(Node::PROCESS_MODE_DISABLED);
+	Node *added = memnew(Node);
+	instance->add_child(added);
+	Node *added_to_child = memnew(Node);
+	instance->get_node(NodePath("Child"))->add_child(added_to_child);
+	const ObjectID added_id = added->get_instance_id();
+	const ObjectID added_to_child_id = added_to_child->get_instance_id();
+
+	pool->release(instance);
+	CHECK(instance->get_parent() == nullptr);
+	CHECK(parent->get_child_count() == 0);
+	CHECK(pool->get_available_count() == 1);
+
+	// Children added at runtime are freed, the ones from the scene are kept.
+	CHECK(ObjectDB::get_instance(added_id) == nullptr);
+	CHECK(ObjectDB::get_instance(added_to_child_id) == nullptr);
+	CHECK(instance->get_child_count() == 1);
+	CHECK(instance->get_node(NodePath("Child"))->get_child_count() == 0);
+
+	// The same instance is handed out again, reset to its packed state.
+	Node *reused = pool->acquire();
+	CHECK(reused == instance);
+	CHECK(reused->get_process_priority() == 3);
+	CHECK(reused->get_node(NodePath("Child"))->get_process_mode() == Node::PROCESS_MODE_INHERIT);
+	CHECK(pool->get_available_count() == 0);
+
+	SUBCASE("Releasing twice or releasing foreign nodes fails") {
+		pool->release(reused);
+		ERR_PRINT_OFF;
+		pool->release(reused);
+		Node *foreign = memnew(Node);
+		pool->release(foreign);
+		ERR_PRINT_ON;
+		CHECK(pool->get_available_count() == 1);
+		memdelete(foreign);
+	}
+
+	SUBCASE("Instances in use are not freed by the pool") {
+		pool->clear();
+		CHECK(ObjectDB::get_instance(reused->get_instance_id()) == reused);
+		memdelete(reused);
+	}
+
+	memdelete(parent);
+}
+
+TEST_CASE("[ScenePool] Prewarm and maximum size") {
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(_create_packed_scene());
+	pool->set_max_size(4);
+
+	pool->prewarm(8);
+	CHECK(pool->get_available_count() == 4);
+
+	pool->set_max_size(2);
+	CHECK(pool->get_available_count() == 2);
+
+	pool->clear();
+	CHECK(pool->get_available_count() == 0);
+}
+
+} // namespace TestScenePool
@@ -0,0 +1,447 @@
+/**************************************************************************/
+/*  test_physics_server_2d.cpp                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_physics_server_2d)
+
+#ifndef PHYSICS_2D_DISABLED
+
+#include "core/object/callable_mp.h"
+#include "servers/physics_2d/physics_server_2d.h"
+
+namespace TestPhysicsServer2D {
+
+static RID create_body(RID p_space, RID p_shape, const Vector2 &p_position, PhysicsServer2D::BodyMode p_mode = PhysicsServer2D::BODY_MODE_STATIC) {
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+	RID body = ps->body_create();
+	ps->body_set_mode(body, p_mode);
+	ps->body_add_shape(body, p_shape);
+	ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(0, p_position));
+	ps->body_set_space(body, p_space);
+	return body;
+}
+
+TEST_CASE("[SceneTree][PhysicsServer2D] Batched ray casts match single ray casts") {
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+	RID shape = ps->rectangle_shape_create();
+	ps->shape_set_data(shape, Vector2(0.5, 0.5));
+
+	LocalVector<RID> bodies;
+	for (int i = 0; i < 8; i++) {
+		bodies.push_back(create_body(space, shape, Vector2(i * 2.0, 0)));
+	}
+
+	PhysicsDirectSpaceState2D *space_state = ps->space_get_direct_state(space);
+	REQUIRE(space_state);
+
+	PhysicsDirectSpaceState2D::RayParameters parameters;
+
+	// Batches are split in chunks of 64 rays.
+	for (int count : { 1, 63, 64, 65, 129 }) {
+		CAPTURE(count);
+
+		LocalVector<Vector2> from;
+		LocalVector<Vector2> to;
+		for (int i = 0; i < count; i++) {
+			// Sweep over the rectangles and the gaps between them.
+			const real_t x = 0.25 + i * 16.0 / count;
+			from.push_back(Vector2(x, 5));
+			to.push_back(Vector2(x, -5));
+		}
+
+		LocalVector<PhysicsDirectSpaceState2D::RayResult> results;
+		results.resize(count);
+		LocalVector<bool> hits;
+		hits.resize(count);
+		space_state->intersect_rays(parameters, from.ptr(), to.ptr(), count, results.ptr(), hits.ptr());
+
+		int hit_count = 0;
+		for (int i = 0; i < count; i++) {
+			parameters.from = from[i];
+			parameters.to = to[i];
+			PhysicsDirectSpaceState2D::RayResult expected;
+			const bool hit = space_state->intersect_ray(parameters, expected);
+			CHECK_EQ(hits[i], hit);
+			if (!hit || !hits[i]) {
+				continue;
+			}
+
+			hit_count++;
+			CHECK(results[i].position.is_equal_approx(expected.position));
+			CHECK(results[i].normal.is_equal_approx(expected.normal));
+			CHECK(results[i].rid == expected.rid);
+			CHECK_EQ(results[i].shape, expected.shape);
+		}
+
+		CHECK(hit_count > 0);
+		if (count > 1) {
+			CHECK(hit_count < count);
+		}
+	}
+
+	for (const RID &body : bodies) {
+		ps->free_rid(body);
+	}
+	ps->free_rid(shape);
+	ps->free_rid(space);
+}
+
+struct BodyState {
+	Transform2D transform;
+	Vector2 linear_velocity;
+	real_t angular_velocity = 0;
+};
+
+static BodyState get_body_state(RID p_body) {
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+	BodyState state;
+	state.transform = ps->body_get_state(p_body, PhysicsServer2D::BODY_STATE_TRANSFORM);
+	state.linear_velocity = ps->body_get_state(p_body, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY);
+	state.angular_velocity = ps->body_get_state(p_body, PhysicsServer2D::BODY_STATE_ANGULAR_VELOCITY);
+	return state;
+}
+
+static void check_body_state(RID p_body, const BodyState &p_expected) {
+	const BodyState state = get_body_state(p_body);
+	CHECK(state.transform.is_equal_approx(p_expected.transform));
+	CHECK(state.linear_velocity.is_equal_approx(p_expected.linear_velocity));
+	CHECK(Math::is_equal_approx(state.angular_velocity, p_expected.angular_velocity));
+}
+
+static void check_body_state_exact(RID p_body, const BodyState &p_expected) {
+	const BodyState state = get_body_state(p_body);
+	CHECK(state.transform == p_expected.transform);
+	CHECK(state.linear_velocity == p_expected.linear_velocity);
+	CHECK(state.angular_velocity == p_expected.angular_velocity);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer2D] Space states can be saved and restored") {
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+	ps->set_active(true);
+
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+	RID floor_shape = ps->rectangle_shape_create();
+	ps->shape_set_data(floor_shape, Vector2(200, 10));
+	RID box_shape = ps->rectangle_shape_create();
+	ps->shape_set_data(box_shape, Vector2(10, 10));
+
+	// The y axis points down in 2D.
+	RID floor = create_body(space, floor_shape, Vector2(0, 10));
+	RID boxes[2];
+	for (int i = 0; i < 2; i++) {
+		boxes[i] = create_body(space, box_shape, Vector2(i * 40.0, -20), PhysicsServer2D::BODY_MODE_RIGID);
+		ps->body_set_state(boxes[i], PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY, Vector2(20, 60));
+		ps->body_set_state(boxes[i], PhysicsServer2D::BODY_STATE_ANGULAR_VELOCITY, 2.0);
+	}
+
+	const real_t step = 1.0 / 60.0;
+	// Let the boxes land, so the saved state includes contacts.
+	for (int i = 0; i < 30; i++) {
+		ps->step(step);
+	}
+
+	const PackedByteArray state = ps->space_save_state(space);
+	REQUIRE_FALSE(state.is_empty());
+	BodyState saved[2];
+	for (int i = 0; i < 2; i++) {
+		saved[i] = get_body_state(boxes[i]);
+	}
+
+	SUBCASE("Stepping again after restoring gives the same results") {
+		for (int i = 0; i < 30; i++) {
+			ps->step(step);
+		}
+		BodyState stepped[2];
+		for (int i = 0; i < 2; i++) {
+			stepped[i] = get_body_state(boxes[i]);
+		}
+
+		CHECK(ps->space_restore_state(space, state));
+		for (int i = 0; i < 2; i++) {
+			check_body_state(boxes[i], saved[i]);
+		}
+
+		for (int i = 0; i < 30; i++) {
+			ps->step(step);
+		}
+		for (int i = 0; i < 2; i++) {
+			check_body_state(boxes[i], stepped[i]);
+		}
+	}
+
+	SUBCASE("Contacts lost and regained since saving don't change the results") {
+		for (int i = 0; i < 30; i++) {
+			ps->step(step);
+		}
+		BodyState stepped[2];
+		for (int i = 0; i < 2; i++) {
+			stepped[i] = get_body_state(boxes[i]);
+		}
+
+		// Lift the boxes off the floor, so their pairs are freed, and restore while they are still in the air.
+		for (int i = 0; i < 2; i++) {
+			ps->body_set_state(boxes[i], PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(0, Vector2(i * 40.0, -200)));
+		}
+		ps->step(step);
+		CHECK(ps->space_restore_state(space, state));
+		for (int i = 0; i < 30; i++) {
+			ps->step(step);
+		}
+		for (int i = 0; i < 2; i++) {
+			check_body_state_exact(boxes[i], stepped[i]);
+		}
+
+		// Land them again one after the other, so their pairs are created in the opposite order.
+		for (int i = 1; i >= 0; i--) {
+			ps->body_set_state(boxes[i], PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(0, Vector2(i * 40.0, -200)));
+			ps->step(step);
+			ps->body_set_state(boxes[i], PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(0, Vector2(i * 40.0, -10)));
+			ps->step(step);
+		}
+		CHECK(ps->space_restore_state(space, state));
+		for (int i = 0; i < 30; i++) {
+			ps->step(step);
+		}
+		for (int i = 0; i < 2; i++) {
+			check_body_state_exact(boxes[i], stepped[i]);
+		}
+	}
+
+	SUBCASE("Saving the same state gives the same bytes") {
+		CHECK(ps->space_save_state(space) == state);
+	}
+
+	SUBCASE("Invalid states are rejected") {
+		ERR_PRINT_OFF;
+		CHECK_FALSE(ps->space_restore_state(space, PackedByteArray()));
+
+		PackedByteArray wrong_magic = state;
+		wrong_magic.set(0, wrong_magic[0] ^ 0xFF);
+		CHECK_FALSE(ps->space_restore_state(space, wrong_magic));
+
+		PackedByteArray truncated = state.slice(0, state.size() - 1);
+		CHECK_FALSE(ps->space_restore_state(space, truncated));
+		ERR_PRINT_ON;
+
+		// The space is left untouched.
+		for (int i = 0; i < 2; i++) {
+			check_body_state(boxes[i], saved[i]);
+		}
+	}
+
+	for (const RID &box : boxes) {
+		ps->free_rid(box);
+	}
+	ps->free_rid(floor);
+	ps->free_rid(box_shape);
+	ps->free_rid(floor_shape);
+	ps->free_rid(space);
+	ps->set_active(false);
+}
+
+class MonitorRecorder : public Object {
+	GDCLASS(MonitorRecorder, Object);
+
+	void _append_event(PackedInt64Array &r_events, int64_t p_status, RID p_rid, int64_t p_instance_id, int64_t p_other_shape, int64_t p_area_shape) {
+		// RIDs differ from one run to the other, so record which of the created objects it is instead.
+		r_events.push_back(p_status);
+		r_events.push_back(objects.find(p_rid));
+		r_events.push_back(p_instance_id);
+		r_events.push_back(p_other_shape);
+		r_events.push_back(p_area_shape);
+	}
+
+public:
+	LocalVector<RID> objects;
+	PackedInt64Array body_events;
+	PackedInt64Array area_events;
+	int batch_calls = 0;
+
+	void body_monitor_event(int64_t p_status, RID p_rid, int64_t p_instance_id, int64_t p_body_shape, int64_t p_area_shape) {
+		_append_event(body_events, p_status, p_rid, p_instance_id, p_body_shape, p_area_shape);
+	}
+
+	void area_monitor_event(int64_t p_status, RID p_rid, int64_t p_instance_id, int64_t p_other_shape, int64_t p_area_shape) {
+		_append_event(area_events, p_status, p_rid, p_instance_id, p_other_shape, p_area_shape);
+	}
+
+	void monitor_batch(const PackedInt64Array &p_body_events, const PackedInt64Array &p_area_events) {
+		batch_calls++;
+		for (int i = 0; i < p_body_events.size(); i += PhysicsServer2D::AREA_MONITOR_EVENT_SIZE) {
+			_append_event(body_events, p_body_events[i], RID::from_uint64(p_body_events[i + 1]), p_body_events[i + 2], p_body_events[i + 3], p_body_events[i + 4]);
+		}
+		for (int i = 0; i < p_area_events.size(); i += PhysicsServer2D::AREA_MONITOR_EVENT_SIZE) {
+			_append_event(area_events, p_area_events[i], RID::from_uint64(p_area_events[i + 1]), p_area_events[i + 2], p_area_events[i + 3], p_area_events[i + 4]);
+		}
+	}
+};
+
+struct MonitorStep {
+	PackedInt64Array body_events;
+	PackedInt64Array area_events;
+};
+
+static bool has_monitor_status(const PackedInt64Array &p_events, PhysicsServer2D::AreaBodyStatus p_status) {
+	for (int i = 0; i < p_events.size(); i += PhysicsServer2D::AREA_MONITOR_EVENT_SIZE) {
+		if (p_events[i] == p_status) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// Moves two bodies and an area in and out of a monitoring area, and records the events reported at each step.
+static LocalVector<MonitorStep> record_monitor_events(bool p_batched, int &r_batch_calls, int &r_suppressed_events) {
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+	ps->set_active(true);
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+	RID shape = ps->rectangle_shape_create();
+	ps->shape_set_data(shape, Vector2(1, 1));
+
+	MonitorRecorder recorder;
+	MonitorRecorder suppressed;
+
+	RID area = ps->area_create();
+	ps->area_add_shape(area, shape);
+	ps->area_add_shape(area, shape, Transform2D(0, Vector2(1, 0)));
+	ps->area_set_space(area, space);
+	ps->area_set_monitor_callback(area, callable_mp(p_batched ? &suppressed : &recorder, &MonitorRecorder::body_monitor_event));
+	ps->area_set_area_monitor_callback(area, callable_mp(p_batched ? &suppressed : &recorder, &MonitorRecorder::area_monitor_event));
+	if (p_batched) {
+		ps->area_set_monitor_batch_callback(area, callable_mp(&recorder, &MonitorRecorder::monitor_batch));
+	}
+
+	const Vector2 outside(100, 100);
+	RID body_a = create_body(space, shape, outside);
+	ps->body_add_shape(body_a, shape, Transform2D(0, Vector2(0, 1)));
+	ps->body_attach_object_instance_id(body_a, ObjectID(uint64_t(10)));
+	RID body_b = create_body(space, shape, outside);
+	ps->body_attach_object_instance_id(body_b, ObjectID(uint64_t(20)));
+
+	RID other_area = ps->area_create();
+	ps->area_add_shape(other_area, shape);
+	ps->area_set_transform(other_area, Transform2D(0, outside));
+	ps->area_set_monitorable(other_area, true);
+	ps->area_attach_object_instance_id(other_area, ObjectID(uint64_t(30)));
+	ps->area_set_space(other_area, space);
+
+	for (const RID &object : { body_a, body_b, other_area }) {
+		recorder.objects.push_back(object);
+		suppressed.objects.push_back(object);
+	}
+
+	LocalVector<MonitorStep> steps;
+	for (int i = 0; i < 4; i++) {
+		switch (i) {
+			case 0: {
+				ps->body_set_state(body_a, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D());
+				ps->area_set_transform(other_area, Transform2D(0, Vector2(1, 0)));
+			} break;
+			case 1: {
+				ps->body_set_state(body_a, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(0, outside));
+				ps->body_set_state(body_b, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(0, Vector2(0.5, 0)));
+			} break;
+			case 2: {
+				ps->area_set_transform(other_area, Transform2D(0, outside));
+			} break;
+			case 3: {
+				ps->body_set_state(body_b, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(0, outside));
+			} break;
+		}
+
+		ps->step(1.0 / 60.0);
+		ps->flush_queries();
+
+		MonitorStep step;
+		step.body_events = recorder.body_events;
+		step.area_events = recorder.area_events;
+		steps.push_back(step);
+		recorder.body_events.clear();
+		recorder.area_events.clear();
+	}
+
+	r_batch_calls = recorder.batch_calls;
+	r_suppressed_events = suppressed.body_events.size() + suppressed.area_events.size();
+
+	ps->free_rid(other_area);
+	ps->free_rid(body_b);
+	ps->free_rid(body_a);
+	ps->free_rid(area);
+	ps->free_rid(shape);
+	ps->free_rid(space);
+	ps->set_active(false);
+
+	return steps;
+}
+
+TEST_CASE("[SceneTree][PhysicsServer2D] Batched area monitoring matches the per-event callbacks") {
+	int batch_calls = 0;
+	int suppressed_events = 0;
+	const LocalVector<MonitorStep> expected = record_monitor_events(false, batch_calls, suppressed_events);
+	CHECK_EQ(batch_calls, 0);
+
+	const LocalVector<MonitorStep> batched = record_monitor_events(true, batch_calls, suppressed_events);
+	// Every step reports at least one event, so the batch callback is called once per step.
+	CHECK_EQ(batch_calls, 4);
+	CHECK_MESSAGE(suppressed_events == 0, "The per-event callbacks should not be called while the batch callback is set.");
+
+	REQUIRE_EQ(batched.size(), expected.size());
+	for (uint32_t i = 0; i < expected.size(); i++) {
+		CAPTURE(i);
+		CHECK(expected[i].body_events.size() + expected[i].area_events.size() > 0);
+		// Same events, in the same order and with the same values.
+		CHECK(batched[i].body_events == expected[i].body_events);
+		CHECK(batched[i].area_events == expected[i].area_events);
+		for (const PackedInt64Array &events : { batched[i].body_events, batched[i].area_events }) {
+			for (int j = 0; j < events.size(); j += PhysicsServer2D::AREA_MONITOR_EVENT_SIZE) {
+				// The raw RID decodes back to the object that has the reported instance ID.
+				CHECK(events[j + 1] >= 0);
+				CHECK_EQ(events[j + 2], (events[j + 1] + 1) * 10);
+			}
+		}
+	}
+
+	// Entering and exiting is reported with the right status.
+	CHECK(has_monitor_status(expected[0].body_events, PhysicsServer2D::AREA_BODY_ADDED));
+	CHECK(has_monitor_status(expected[0].area_events, PhysicsServer2D::AREA_BODY_ADDED));
+	CHECK(has_monitor_status(expected[1].body_events, PhysicsServer2D::AREA_BODY_ADDED));
+	CHECK(has_monitor_status(expected[1].body_events, PhysicsServer2D::AREA_BODY_REMOVED));
+	CHECK(has_monitor_status(expected[2].area_events, PhysicsServer2D::AREA_BODY_REMOVED));
+	CHECK(has_monitor_status(expected[3].body_events, PhysicsServer2D::AREA_BODY_REMOVED));
+}
+
+} // namespace TestPhysicsServer2D
+
+#endif // PHYSICS_2D_DISABLED
@@ -0,0 +1,433 @@
+/**************************************************************************/
+/*  test_physics_server_3d.cpp                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_physics_server_3d)
+
+#ifndef PHYSICS_3D_DISABLED
+
+#include "core/config/project_settings.h"
+#include "servers/physics_3d/physics_server_3d.h"
+
+namespace TestPhysicsServer3D {
+
+static RID create_body(RID p_space, RID p_shape, const Vector3 &p_position, PhysicsServer3D::BodyMode p_mode = PhysicsServer3D::BODY_MODE_STATIC) {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID body = ps->body_create();
+	ps->body_set_mode(body, p_mode);
+	ps->body_add_shape(body, p_shape);
+	ps->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), p_position));
+	ps->body_set_space(body, p_space);
+	return body;
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Batched ray casts match single ray casts") {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+	RID shape = ps->box_shape_create();
+	ps->shape_set_data(shape, Vector3(0.5, 0.5, 0.5));
+
+	LocalVector<RID> bodies;
+	for (int i = 0; i < 8; i++) {
+		bodies.push_back(create_body(space, shape, Vector3(i * 2.0, 0, 0)));
+	}
+
+	PhysicsDirectSpaceState3D *space_state = ps->space_get_direct_state(space);
+	REQUIRE(space_state);
+
+	PhysicsDirectSpaceState3D::RayParameters parameters;
+
+	// Batches are split in chunks of 64 rays.
+	for (int count : { 1, 63, 64, 65, 129 }) {
+		CAPTURE(count);
+
+		LocalVector<Vector3> from;
+		LocalVector<Vector3> to;
+		for (int i = 0; i < count; i++) {
+			// Sweep over the boxes and the gaps between them.
+			const real_t x = 0.25 + i * 16.0 / count;
+			from.push_back(Vector3(x, 5, 0.1 * (i % 3)));
+			to.push_back(Vector3(x, -5, 0.1 * (i % 3)));
+		}
+
+		LocalVector<PhysicsDirectSpaceState3D::RayResult> results;
+		results.resize(count);
+		LocalVector<bool> hits;
+		hits.resize(count);
+		space_state->intersect_rays(parameters, from.ptr(), to.ptr(), count, results.ptr(), hits.ptr());
+
+		int hit_count = 0;
+		for (int i = 0; i < count; i++) {
+			parameters.from = from[i];
+			parameters.to = to[i];
+			PhysicsDirectSpaceState3D::RayResult expected;
+			const bool hit = space_state->intersect_ray(parameters, expected);
+			CHECK_EQ(hits[i], hit);
+			if (!hit || !hits[i]) {
+				continue;
+			}
+
+			hit_count++;
+			CHECK(results[i].position.is_equal_approx(expected.position));
+			CHECK(results[i].normal.is_equal_approx(expected.normal));
+			CHECK(results[i].rid == expected.rid);
+			CHECK_EQ(results[i].shape, expected.shape);
+		}
+
+		CHECK(hit_count > 0);
+		if (count > 1) {
+			CHECK(hit_count < count);
+		}
+	}
+
+	for (const RID &body : bodies) {
+		ps->free_rid(body);
+	}
+	ps->free_rid(shape);
+	ps->free_rid(space);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Large concave shapes can be queried right after their creation") {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+
+	// Enough faces for the BVH to be built on a worker thread when replacing a previous mesh.
+	const int grid_size = 48;
+	PackedVector3Array faces;
+	for (int x = 0; x < grid_size; x++) {
+		for (int z = 0; z < grid_size; z++) {
+			const Vector3 corner(x - grid_size * 0.5, 0, z - grid_size * 0.5);
+			faces.push_back(corner);
+			faces.push_back(corner + Vector3(1, 0, 0));
+			faces.push_back(corner + Vector3(0, 0, 1));
+			faces.push_back(corner + Vector3(1, 0, 0));
+			faces.push_back(corner + Vector3(1, 0, 1));
+			faces.push_back(corner + Vector3(0, 0, 1));
+		}
+	}
+	REQUIRE(faces.size() / 3 >= 4096);
+
+	RID shape = ps->concave_polygon_shape_create();
+	Dictionary data;
+	data["faces"] = faces;
+	data["backface_collision"] = false;
+	ps->shape_set_data(shape, data);
+	RID body = create_body(space, shape, Vector3());
+
+	PhysicsDirectSpaceState3D *space_state = ps->space_get_direct_state(space);
+	REQUIRE(space_state);
+	PhysicsDirectSpaceState3D::RayParameters parameters;
+	parameters.from = Vector3(0.25, 5, 0.25);
+	parameters.to = Vector3(0.25, -5, 0.25);
+	PhysicsDirectSpaceState3D::RayResult result;
+	// No step happened, the mesh must be usable without one.
+	CHECK(space_state->intersect_ray(parameters, result));
+	CHECK(result.position.is_equal_approx(Vector3(0.25, 0, 0.25)));
+
+	ps->free_rid(body);
+	ps->free_rid(shape);
+	ps->free_rid(space);
+}
+
+struct BodyState {
+	Transform3D transform;
+	Vector3 linear_velocity;
+	Vector3 angular_velocity;
+};
+
+static BodyState get_body_state(RID p_body) {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	BodyState state;
+	state.transform = ps->body_get_state(p_body, PhysicsServer3D::BODY_STATE_TRANSFORM);
+	state.linear_velocity = ps->body_get_state(p_body, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY);
+	state.angular_velocity = ps->body_get_state(p_body, PhysicsServer3D::BODY_STATE_ANGULAR_VELOCITY);
+	return state;
+}
+
+static void check_body_state(RID p_body, const BodyState &p_expected) {
+	const BodyState state = get_body_state(p_body);
+	CHECK(state.transform.is_equal_approx(p_expected.transform));
+	CHECK(state.linear_velocity.is_equal_approx(p_expected.linear_velocity));
+	CHECK(state.angular_velocity.is_equal_approx(p_expected.angular_velocity));
+}
+
+static void check_body_state_exact(RID p_body, const BodyState &p_expected) {
+	const BodyState state = get_body_state(p_body);
+	CHECK(state.transform == p_expected.transform);
+	CHECK(state.linear_velocity == p_expected.linear_velocity);
+	CHECK(state.angular_velocity == p_expected.angular_velocity);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Space states can be saved and restored") {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	ps->set_active(true);
+
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+	RID floor_shape = ps->box_shape_create();
+	ps->shape_set_data(floor_shape, Vector3(10, 0.5, 10));
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+
+	RID floor = create_body(space, floor_shape, Vector3(0, -0.5, 0));
+	RID boxes[2];
+	for (int i = 0; i < 2; i++) {
+		boxes[i] = create_body(space, box_shape, Vector3(i * 2.0, 1.0, 0), PhysicsServer3D::BODY_MODE_RIGID);
+		ps->body_set_state(boxes[i], PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY, Vector3(1, -3, 0));
+		ps->body_set_state(boxes[i], PhysicsServer3D::BODY_STATE_ANGULAR_VELOCITY, Vector3(0, 2, 1));
+	}
+
+	const real_t step = 1.0 / 60.0;
+	// Let the boxes land, so the saved state includes contacts.
+	for (int i = 0; i < 30; i++) {
+		ps->step(step);
+	}
+
+	const PackedByteArray state = ps->space_save_state(space);
+	REQUIRE_FALSE(state.is_empty());
+	BodyState saved[2];
+	for (int i = 0; i < 2; i++) {
+		saved[i] = get_body_state(boxes[i]);
+	}
+
+	SUBCASE("Stepping again after restoring gives the same results") {
+		for (int i = 0; i < 30; i++) {
+			ps->step(step);
+		}
+		BodyState stepped[2];
+		for (int i = 0; i < 2; i++) {
+			stepped[i] = get_body_state(boxes[i]);
+		}
+
+		CHECK(ps->space_restore_state(space, state));
+		for (int i = 0; i < 2; i++) {
+			check_body_state(boxes[i], saved[i]);
+		}
+
+		for (int i = 0; i < 30; i++) {
+			ps->step(step);
+		}
+		for (int i = 0; i < 2; i++) {
+			check_body_state(boxes[i], stepped[i]);
+		}
+	}
+
+	SUBCASE("Contacts lost and regained since saving don't change the results") {
+		for (int i = 0; i < 30; i++) {
+			ps->step(step);
+		}
+		BodyState stepped[2];
+		for (int i = 0; i < 2; i++) {
+			stepped[i] = get_body_state(boxes[i]);
+		}
+
+		// Lift the boxes off the floor, so their pairs are freed, and restore while they are still in the air.
+		for (int i = 0; i < 2; i++) {
+			ps->body_set_state(boxes[i], PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(i * 2.0, 10.0, 0)));
+		}
+		ps->step(step);
+		CHECK(ps->space_restore_state(space, state));
+		for (int i = 0; i < 30; i++) {
+			ps->step(step);
+		}
+		for (int i = 0; i < 2; i++) {
+			check_body_state_exact(boxes[i], stepped[i]);
+		}
+
+		// Land them again one after the other, so their pairs are created in the opposite order.
+		for (int i = 1; i >= 0; i--) {
+			ps->body_set_state(boxes[i], PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(i * 2.0, 10.0, 0)));
+			ps->step(step);
+			ps->body_set_state(boxes[i], PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(i * 2.0, 0.5, 0)));
+			ps->step(step);
+		}
+		CHECK(ps->space_restore_state(space, state));
+		for (int i = 0; i < 30; i++) {
+			ps->step(step);
+		}
+		for (int i = 0; i < 2; i++) {
+			check_body_state_exact(boxes[i], stepped[i]);
+		}
+	}
+
+	SUBCASE("Saving the same state gives the same bytes") {
+		CHECK(ps->space_save_state(space) == state);
+	}
+
+	SUBCASE("Invalid states are rejected") {
+		ERR_PRINT_OFF;
+		CHECK_FALSE(ps->space_restore_state(space, PackedByteArray()));
+
+		PackedByteArray wrong_magic = state;
+		wrong_magic.set(0, wrong_magic[0] ^ 0xFF);
+		CHECK_FALSE(ps->space_restore_state(space, wrong_magic));
+
+		PackedByteArray truncated = state.slice(0, state.size() - 1);
+		CHECK_FALSE(ps->space_restore_state(space, truncated));
+		ERR_PRINT_ON;
+
+		// The space is left untouched.
+		for (int i = 0; i < 2; i++) {
+			check_body_state(boxes[i], saved[i]);
+		}
+	}
+
+	for (const RID &box : boxes) {
+		ps->free_rid(box);
+	}
+	ps->free_rid(floor);
+	ps->free_rid(box_shape);
+	ps->free_rid(floor_shape);
+	ps->free_rid(space);
+	ps->set_active(false);
+}
+
+// Steps a few layers of boxes stacked on a floor, all touching each other so they form a single island.
+static LocalVector<BodyState> simulate_box_stack(int p_large_island_constraint_count) {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	ps->set_active(true);
+
+	// Read by the space when it is created.
+	const StringName setting = "physics/3d/solver/large_island_constraint_count";
+	const Variant previous_setting = GLOBAL_GET(setting);
+	ProjectSettings::get_singleton()->set_setting(setting, p_large_island_constraint_count);
+	RID space = ps->space_create();
+	ProjectSettings::get_singleton()->set_setting(setting, previous_setting);
+	ps->space_set_active(space, true);
+
+	RID floor_shape = ps->box_shape_create();
+	ps->shape_set_data(floor_shape, Vector3(10, 0.5, 10));
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+	RID floor = create_body(space, floor_shape, Vector3(0, -0.5, 0));
+
+	const int size = 6;
+	const int layers = 4;
+	LocalVector<RID> boxes;
+	for (int y = 0; y < layers; y++) {
+		for (int x = 0; x < size; x++) {
+			for (int z = 0; z < size; z++) {
+				boxes.push_back(create_body(space, box_shape, Vector3(x - size * 0.5, y + 0.5, z - size * 0.5), PhysicsServer3D::BODY_MODE_RIGID));
+			}
+		}
+	}
+	// Knock a corner of the top layer, so the stack doesn't just rest.
+	ps->body_set_state(boxes[boxes.size() - 1], PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY, Vector3(-1, 0, -1));
+
+	for (int i = 0; i < 30; i++) {
+		ps->step(1.0 / 60.0);
+	}
+
+	LocalVector<BodyState> states;
+	for (const RID &box : boxes) {
+		states.push_back(get_body_state(box));
+		ps->free_rid(box);
+	}
+	ps->free_rid(floor);
+	ps->free_rid(box_shape);
+	ps->free_rid(floor_shape);
+	ps->free_rid(space);
+	ps->set_active(false);
+	return states;
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Large islands solved across threads match the single-threaded solve") {
+	// 0 solves every island on a single thread, 1 colors every island, whatever its size.
+	const LocalVector<BodyState> serial = simulate_box_stack(0);
+	const LocalVector<BodyState> colored = simulate_box_stack(1);
+	REQUIRE_EQ(serial.size(), colored.size());
+
+	// Constraints are solved in another order, so the results are close but not equal.
+	for (uint32_t i = 0; i < serial.size(); i++) {
+		CAPTURE(i);
+		CHECK(serial[i].transform.origin.distance_to(colored[i].transform.origin) < 0.01);
+		CHECK(serial[i].transform.basis.get_rotation_quaternion().angle_to(colored[i].transform.basis.get_rotation_quaternion()) < 0.01);
+		CHECK(serial[i].linear_velocity.distance_to(colored[i].linear_velocity) < 0.05);
+		CHECK(serial[i].angular_velocity.distance_to(colored[i].angular_velocity) < 0.05);
+	}
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Command buffers run their commands in order") {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID space = ps->space_create();
+	RID shape = ps->box_shape_create();
+	ps->shape_set_data(shape, Vector3(0.5, 0.5, 0.5));
+	RID body = create_body(space, shape, Vector3(), PhysicsServer3D::BODY_MODE_RIGID);
+	RID area = ps->area_create();
+	ps->area_set_space(area, space);
+
+	const Transform3D first_transform(Basis(), Vector3(1, 2, 3));
+	const Transform3D last_transform(Basis(), Vector3(4, 5, 6));
+	const Transform3D area_transform(Basis(), Vector3(-1, 0, 1));
+
+	Ref<PhysicsCommandBuffer3D> command_buffer;
+	command_buffer.instantiate();
+	command_buffer->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, first_transform);
+	command_buffer->area_set_param(area, PhysicsServer3D::AREA_PARAM_GRAVITY, 4.0);
+	command_buffer->body_set_param(body, PhysicsServer3D::BODY_PARAM_MASS, 2.0);
+	command_buffer->area_set_transform(area, area_transform);
+	command_buffer->area_set_param(area, PhysicsServer3D::AREA_PARAM_GRAVITY, 8.0);
+	command_buffer->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, last_transform);
+	command_buffer->body_set_state(body, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY, Vector3(0, 1, 0));
+	CHECK_EQ(command_buffer->get_command_count(), 7);
+
+	// Recording doesn't touch the server.
+	CHECK(Transform3D(ps->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM)).is_equal_approx(Transform3D()));
+	CHECK(ps->area_get_transform(area).is_equal_approx(Transform3D()));
+
+	ps->call(SNAME("submit_command_buffer"), command_buffer);
+	CHECK_EQ(command_buffer->get_command_count(), 0);
+
+	// The last value set for each property wins.
+	CHECK(Transform3D(ps->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM)).is_equal_approx(last_transform));
+	CHECK(Vector3(ps->body_get_state(body, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY)).is_equal_approx(Vector3(0, 1, 0)));
+	CHECK(Math::is_equal_approx(real_t(ps->body_get_param(body, PhysicsServer3D::BODY_PARAM_MASS)), real_t(2.0)));
+	CHECK(ps->area_get_transform(area).is_equal_approx(area_transform));
+	CHECK(Math::is_equal_approx(real_t(ps->area_get_param(area, PhysicsServer3D::AREA_PARAM_GRAVITY)), real_t(8.0)));
+
+	// The emptied buffer can be reused.
+	command_buffer->body_set_param(body, PhysicsServer3D::BODY_PARAM_MASS, 3.0);
+	CHECK_EQ(command_buffer->get_command_count(), 1);
+	ps->call(SNAME("submit_command_buffer"), command_buffer);
+	CHECK_EQ(command_buffer->get_command_count(), 0);
+	CHECK(Math::is_equal_approx(real_t(ps->body_get_param(body, PhysicsServer3D::BODY_PARAM_MASS)), real_t(3.0)));
+
+	ps->free_rid(area);
+	ps->free_rid(body);
+	ps->free_rid(shape);
+	ps->free_rid(space);
+}
+
+} // namespace TestPhysicsServer3D
+
+#endif // PHYSICS_3D_DISABLED